@@ -21,6 +21,14 @@ namespace LightWeaver {
         uint8_t B;
 
         static RgbColor linearBlend(const RgbColor& start, const RgbColor& end, float progress);
+
+        bool operator==(const RgbColor& other) const {
+            return R == other.R && G == other.G && B == other.B;
+        }
+
+        bool operator!=(const RgbColor& other) const {
+            return !(*this == other);
+        }
     };
 
     struct RgbaColor {
@@ -36,6 +44,14 @@ namespace LightWeaver {
         uint8_t A;
 
         static RgbaColor linearBlend(const RgbaColor& start, const RgbaColor& end, float progress);
+
+        bool operator==(const RgbaColor& other) const {
+            return R == other.R && G == other.G && B == other.B && A == other.A;
+        }
+
+        bool operator!=(const RgbaColor& other) const {
+            return !(*this == other);
+        }
     };
 
     struct HsvaColor {
@@ -49,6 +65,14 @@ namespace LightWeaver {
         float S;
         float V;
         uint8_t A;
+
+        bool operator==(const HsvaColor& other) const {
+            return H == other.H && S == other.S && V == other.V && A == other.A;
+        }
+
+        bool operator!=(const HsvaColor& other) const {
+            return !(*this == other);
+        }
     };
 
     struct HslaColor {
@@ -21,5 +21,28 @@ namespace LightWeaver {
 
         ColorSet(): size(0), colors(nullptr) {}
         ColorSet(const ColorSet& other): ColorSet(other.size, other.colors.get()) {}
+
+        ColorSet& operator=(const ColorSet& other) {
+            if (this != &other) {
+                size = other.size;
+                colors = std::unique_ptr<RgbaColor[]>(new RgbaColor[size]);
+                for (uint8_t i = 0; i < size; i++) {
+                    colors[i] = other.colors[i];
+                }
+            }
+            return *this;
+        }
+
+        bool operator==(const ColorSet& other) const {
+            if (size != other.size) return false;
+            for (uint8_t i = 0; i < size; i++) {
+                if (colors[i] != other.colors[i]) return false;
+            }
+            return true;
+        }
+
+        bool operator!=(const ColorSet& other) const {
+            return !(*this == other);
+        }
     };
 }
\ No newline at end of file
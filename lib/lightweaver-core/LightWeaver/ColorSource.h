@@ -7,22 +7,52 @@
 namespace LightWeaver {
     class ColorSource {
         public: 
+            enum class Type : uint8_t {
+                Solid,
+                Fade,
+                Overlay,
+                Gradient,
+                HsvMeander
+            };
+
             // A unique identifier for the color source
             // Used internally to compare and identify color sources
             uint32_t uid;
 
+            // Key frames closer together than this are not worth the cost of interpolating them
+            static const uint16_t MINIMUM_KEY_FRAME_INTERVAL = 20;
+
             ColorSource(uint32_t uid): uid(uid) {}
 
             virtual ~ColorSource() {}
             
             virtual RgbaColor getColor() const = 0;
 
-            virtual RgbaColor getColor(uint8_t index, uint8_t count) const {
+            virtual RgbaColor getColor(uint16_t index, uint16_t count) const {
                 return getColor();
             }
 
+            // Number of evenly spaced pixels, including the first and last, that need to be evaluated for
+            // the color to be accurate across count pixels. The pixels in between are interpolated, so
+            // ColorSources that vary smoothly along the strip can return far fewer than count
+            virtual uint16_t getControlPointCount(uint16_t count) const {
+                return count;
+            }
+
+            // Time between evaluations of the ColorSource in milliseconds, frames in between are interpolated
+            // from the two latest evaluations. Returns 0 if the ColorSource must be evaluated every frame
+            virtual uint16_t getKeyFrameInterval() const {
+                return 0;
+            }
+
             virtual ColorSource* clone() const = 0;
 
+            virtual Type getType() const = 0;
+
+            // Updates the parameters of this ColorSource in place from another ColorSource of the same type,
+            // without restarting its animation. Returns false if no parameters were changed
+            virtual bool patch(const ColorSource& other) = 0;
+
             virtual const Animation* getAnimation() const {
                 return nullptr;
             }
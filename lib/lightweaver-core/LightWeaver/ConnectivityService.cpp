@@ -0,0 +1,104 @@
+#include "ConnectivityService.h"
+#include "util/Trace.h"
+
+namespace LightWeaver {
+    void ConnectivityService::begin() {
+        gotIPHandler = WiFi.onStationModeGotIP([this](const WiFiEventStationModeGotIP& event) {
+            if (!isStationConnected) {
+                queueEvent(ConnectivityEvent::Type::Connected, event.ip);
+            } else if (stationIP != event.ip) {
+                queueEvent(ConnectivityEvent::Type::IPChanged, event.ip);
+            }
+            isStationConnected = true;
+            stationIP = event.ip;
+        });
+
+        disconnectedHandler = WiFi.onStationModeDisconnected([this](const WiFiEventStationModeDisconnected& event) {
+            // The SDK raises a disconnect for every failed connection attempt, only a lost connection is an event
+            if (isStationConnected) {
+                queueEvent(ConnectivityEvent::Type::Disconnected, IPAddress());
+            }
+            isStationConnected = false;
+        });
+
+        // The connection may already be up, e.g. when WiFi was started before the core
+        if (WiFi.status() == WL_CONNECTED) {
+            isStationConnected = true;
+            stationIP = WiFi.localIP();
+            queueEvent(ConnectivityEvent::Type::Connected, stationIP);
+        }
+    }
+
+    void ConnectivityService::queueEvent(ConnectivityEvent::Type type, const IPAddress& ip) {
+        switch (type) {
+            case ConnectivityEvent::Type::Connected: TRACE_EVENT(TraceEvent::WifiConnected, TracePhase::Instant, 0); break;
+            case ConnectivityEvent::Type::Disconnected: TRACE_EVENT(TraceEvent::WifiDisconnected, TracePhase::Instant, 0); break;
+            case ConnectivityEvent::Type::IPChanged: TRACE_EVENT(TraceEvent::WifiIPChanged, TracePhase::Instant, 0); break;
+        }
+        uint8_t next = (eventQueueTail + 1) % EVENT_QUEUE_SIZE;
+        if (next == eventQueueHead) {
+            // The oldest event is dropped, the latest state is still dispatched correctly
+            eventQueueHead = (eventQueueHead + 1) % EVENT_QUEUE_SIZE;
+        }
+        ConnectivityEvent& event = eventQueue[eventQueueTail];
+        event.type = type;
+        event.timestamp = millis();
+        event.ip = ip;
+        eventQueueTail = next;
+    }
+
+    void ConnectivityService::loop() {
+        while (eventQueueHead != eventQueueTail) {
+            ConnectivityEvent event = eventQueue[eventQueueHead];
+            eventQueueHead = (eventQueueHead + 1) % EVENT_QUEUE_SIZE;
+
+            // Skip events that do not change the dispatched state, e.g. if the queue overflowed
+            if (event.type == ConnectivityEvent::Type::Connected && isConnectedState) {
+                if (event.ip == ipState) continue;
+                event.type = ConnectivityEvent::Type::IPChanged;
+            } else if (event.type == ConnectivityEvent::Type::Disconnected && !isConnectedState) {
+                continue;
+            } else if (event.type == ConnectivityEvent::Type::IPChanged && !isConnectedState) {
+                event.type = ConnectivityEvent::Type::Connected;
+            }
+
+            isConnectedState = event.type != ConnectivityEvent::Type::Disconnected;
+            ipState = event.ip;
+            dispatch(event);
+        }
+    }
+
+    void ConnectivityService::dispatch(const ConnectivityEvent& event) {
+        for (uint8_t i = 0; i < MAXIMUM_LISTENERS; i++) {
+            if (listeners[i]) {
+                listeners[i]->onConnectivityEvent(event);
+            }
+        }
+    }
+
+    bool ConnectivityService::subscribe(ConnectivityListener* listener) {
+        for (uint8_t i = 0; i < MAXIMUM_LISTENERS; i++) {
+            if (!listeners[i]) {
+                listeners[i] = listener;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void ConnectivityService::unsubscribe(ConnectivityListener* listener) {
+        for (uint8_t i = 0; i < MAXIMUM_LISTENERS; i++) {
+            if (listeners[i] == listener) {
+                listeners[i] = nullptr;
+            }
+        }
+    }
+
+    bool ConnectivityService::isConnected() const {
+        return isConnectedState;
+    }
+
+    const IPAddress& ConnectivityService::getIP() const {
+        return ipState;
+    }
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include <Arduino.h>
+#include <ESP8266WiFi.h>
+
+namespace LightWeaver {
+    struct ConnectivityEvent {
+        enum class Type : uint8_t {
+            Connected,
+            Disconnected,
+            IPChanged
+        };
+
+        Type type;
+        // millis() when the event was raised by the WiFi stack, rather than when it was dispatched
+        uint32_t timestamp;
+        IPAddress ip;
+    };
+
+    class ConnectivityListener {
+        public:
+            virtual ~ConnectivityListener() {}
+            virtual void onConnectivityEvent(const ConnectivityEvent& event) = 0;
+    };
+
+    /**
+     * Tracks the WiFi station connection using the ESP8266 WiFi event callbacks, and dispatches
+     * connectivity changes to subscribed listeners from the main loop
+     *
+     * Events are raised by the SDK outside of loop(), so they are queued and only dispatched
+     * from loop(). Listeners can therefore safely start or stop servers in response to an event.
+     */
+    class ConnectivityService {
+        public:
+            static const uint8_t MAXIMUM_LISTENERS = 8;
+            static const uint8_t EVENT_QUEUE_SIZE = 8;
+        private:
+            ConnectivityListener* listeners[MAXIMUM_LISTENERS] = {};
+
+            ConnectivityEvent eventQueue[EVENT_QUEUE_SIZE];
+            volatile uint8_t eventQueueHead = 0;
+            volatile uint8_t eventQueueTail = 0;
+
+            WiFiEventHandler gotIPHandler;
+            WiFiEventHandler disconnectedHandler;
+
+            // State as seen by the WiFi stack, updated when events are raised
+            bool isStationConnected = false;
+            IPAddress stationIP;
+            // State as last dispatched to listeners
+            bool isConnectedState = false;
+            IPAddress ipState;
+
+            void queueEvent(ConnectivityEvent::Type type, const IPAddress& ip);
+            void dispatch(const ConnectivityEvent& event);
+        public:
+            void begin();
+            void loop();
+
+            bool subscribe(ConnectivityListener* listener);
+            void unsubscribe(ConnectivityListener* listener);
+
+            bool isConnected() const;
+            const IPAddress& getIP() const;
+    };
+}
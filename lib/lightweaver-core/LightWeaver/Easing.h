@@ -1,11 +1,70 @@
 #pragma once
+#include <Arduino.h>
 
 /**
  * Easing functions, adapated from
  * http://gizma.com/easing/
  */
 namespace LightWeaver {
-    typedef std::function<float(float)> EasingFunction;
+    typedef float (*EasingCurve)(float);
+
+    /**
+     * An easing curve along with any Mirror/Reverse modifiers applied to it
+     * Stored by value rather than as a std::function so that easing functions can be copied 
+     * without allocating, compared, and identified by name when serialized
+     */
+    struct EasingFunction {
+        enum class Modifier : uint8_t {
+            None,
+            Reverse,
+            Mirror
+        };
+
+        static const uint8_t MAXIMUM_MODIFIERS = 4;
+
+        EasingCurve curve;
+        // Modifiers are applied outermost first, and the list is terminated by Modifier::None
+        Modifier modifiers[MAXIMUM_MODIFIERS];
+
+        EasingFunction(EasingCurve curve): curve(curve), modifiers{} {}
+        EasingFunction(std::nullptr_t): EasingFunction((EasingCurve)nullptr) {}
+        EasingFunction(): EasingFunction(nullptr) {}
+
+        float operator()(float p) const {
+            for (uint8_t i = 0; i < MAXIMUM_MODIFIERS && modifiers[i] != Modifier::None; i++) {
+                if (modifiers[i] == Modifier::Reverse) {
+                    p = 1.0f - p;
+                } else {
+                    p = p > 0.5f ? 2.0f * (1.0f - p) : 2.0f * p;
+                }
+            }
+            return curve(p);
+        }
+
+        explicit operator bool() const {
+            return curve != nullptr;
+        }
+
+        bool operator==(const EasingFunction& other) const {
+            return curve == other.curve && memcmp(modifiers, other.modifiers, sizeof(modifiers)) == 0;
+        }
+
+        bool operator!=(const EasingFunction& other) const {
+            return !(*this == other);
+        }
+
+        // Returns this easing function wrapped in an additional outermost modifier
+        // If the maximum number of modifiers is already applied the innermost modifier is discarded
+        EasingFunction withModifier(Modifier modifier) const {
+            EasingFunction result = *this;
+            for (uint8_t i = MAXIMUM_MODIFIERS - 1; i > 0; i--) {
+                result.modifiers[i] = modifiers[i - 1];
+            }
+            result.modifiers[0] = modifier;
+            return result;
+        }
+    };
+
     namespace Easing {
         inline float Linear(float p) {
             return p;
@@ -110,19 +169,11 @@ namespace LightWeaver {
         }        
 
         inline EasingFunction Reverse(EasingFunction originalFunction) {
-            return [originalFunction](float p) {
-                return originalFunction(1.0f - p);
-            };
+            return originalFunction.withModifier(EasingFunction::Modifier::Reverse);
         }
 
         inline EasingFunction Mirror(EasingFunction originalFunction) {
-            return [originalFunction](float p) {
-                if (p > 0.5f) {
-                    return originalFunction(2.0f * (1.0f - p));
-                } else {
-                    return originalFunction(2.0f * p);
-                }
-            };
+            return originalFunction.withModifier(EasingFunction::Modifier::Mirror);
         }
     }
 }
\ No newline at end of file
@@ -0,0 +1,42 @@
+#pragma once
+#include <Arduino.h>
+
+#include "Color.h"
+
+namespace LightWeaver {
+#ifdef LIGHTWEAVER_DITHERING
+    // Bits below the 8-bit levels kept by each channel of a FrameColor
+    static const uint8_t FRAME_COLOR_FRACTION_BITS = 8;
+
+    /**
+     * Color of a rendered pixel, with 16 bits per channel so that transitions and interpolated pixels
+     * keep the levels between 8-bit steps. They are dithered down to 8 bits when shown.
+     */
+    struct FrameColor {
+        FrameColor(uint16_t r, uint16_t g, uint16_t b) : R(r), G(g), B(b) {};
+        FrameColor(): FrameColor(0,0,0) {};
+        FrameColor(const RgbColor& color): FrameColor(color.R << 8, color.G << 8, color.B << 8) {};
+
+        uint16_t R;
+        uint16_t G;
+        uint16_t B;
+
+        static FrameColor linearBlend(const FrameColor& start, const FrameColor& end, float progress) {
+            return FrameColor((end.R - start.R) * progress + start.R,
+                (end.G - start.G) * progress + start.G,
+                (end.B - start.B) * progress + start.B);
+        }
+    };
+
+    // Part of the level not yet shown by each channel of a pixel, carried into its next frame
+    struct DitherError {
+        uint8_t R = 0;
+        uint8_t G = 0;
+        uint8_t B = 0;
+    };
+#else
+    static const uint8_t FRAME_COLOR_FRACTION_BITS = 0;
+
+    typedef RgbColor FrameColor;
+#endif
+}
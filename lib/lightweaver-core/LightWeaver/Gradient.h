@@ -29,7 +29,7 @@ namespace LightWeaver {
                 return partialProg < 0 ? 0 : partialProg > 1 ? 1 : partialProg;
             }
         public:
-            const ColorSet colorSet;
+            ColorSet colorSet;
             std::unique_ptr<uint8_t[]> colorPositions;
             EasingFunction easing;
             Gradient(const ColorSet& colorSet, const uint8_t* colorPositions, EasingFunction easing = Easing::Linear): 
@@ -54,6 +54,30 @@ namespace LightWeaver {
                 Gradient(colorSet, nullptr, easing) {};
             Gradient(const Gradient& other): Gradient(other.colorSet, other.colorPositions.get(), other.easing) {}
 
+            Gradient& operator=(const Gradient& other) {
+                if (this != &other) {
+                    colorSet = other.colorSet;
+                    colorPositions = std::unique_ptr<uint8_t[]>(new uint8_t[colorSet.size]);
+                    for (uint8_t i = 0; i < colorSet.size; i++) {
+                        colorPositions[i] = other.colorPositions[i];
+                    }
+                    easing = other.easing;
+                }
+                return *this;
+            }
+
+            bool operator==(const Gradient& other) const {
+                if (colorSet != other.colorSet || easing != other.easing) return false;
+                for (uint8_t i = 0; i < colorSet.size; i++) {
+                    if (colorPositions[i] != other.colorPositions[i]) return false;
+                }
+                return true;
+            }
+
+            bool operator!=(const Gradient& other) const {
+                return !(*this == other);
+            }
+
             RgbaColor getColor(const float progress) const {
                 if (colorSet.size == 0) return RgbColor();
                 if (colorSet.size == 1) return colorSet.colors[0];
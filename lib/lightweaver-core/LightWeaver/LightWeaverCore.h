@@ -1,10 +1,58 @@
 #pragma once
+#include <memory>
 #include <Arduino.h>
 #include "ColorSource.h"
+#include "ConnectivityService.h"
+#include "QualityGovernor.h"
+#include "OutputLut.h"
+#include "PixelMap.h"
 #include "Features.h"
 
+// Number of segments the core can show at once, each uses three animator slots
+#ifndef LIGHTWEAVER_MAXIMUM_SEGMENTS
+#define LIGHTWEAVER_MAXIMUM_SEGMENTS 8
+#endif
+
 namespace LightWeaver {
     class LightWeaverPlugin;
+
+    // Identifies a plugin class without RTTI, using the address of a per-class static
+    typedef const void* PluginTypeId;
+
+    template <typename PLUGIN>
+    struct PluginTypeTag {
+        static char id;
+    };
+
+    template <typename PLUGIN>
+    char PluginTypeTag<PLUGIN>::id = 0;
+
+    template <typename PLUGIN>
+    PluginTypeId getPluginTypeId() {
+        return &PluginTypeTag<PLUGIN>::id;
+    }
+
+    struct BootMetrics {
+        // Time from boot until the first frame was sent to the driver, in microseconds
+        uint32_t firstFrameTime = 0;
+        // Time spent reading and decoding the scene snapshot, in microseconds
+        uint32_t restoreDuration = 0;
+        bool isSceneRestored = false;
+    };
+
+    struct SegmentInfo {
+        uint8_t id;
+        uint16_t start;
+        uint16_t length;
+        uint8_t brightness;
+        const ColorSource* colorSource;
+
+        // Every segment covers at least one pixel, so a SegmentInfo without any pixels is used when there is no segment
+        bool isValid() const {
+            return length > 0;
+        }
+    };
+
     class LightWeaverCore {
         public:
             virtual ~LightWeaverCore() {};
@@ -12,9 +60,59 @@ namespace LightWeaver {
             virtual void setBrightness(uint8_t brightness) = 0;
             virtual uint8_t getBrightness() = 0;
             virtual void setColorSource(const ColorSource& cs) = 0;
+            // Takes ownership of cs instead of copying it, for ColorSources with large offset lists
+            virtual void setColorSource(std::unique_ptr<ColorSource> cs) = 0;
             virtual void clearColorSource() = 0;
+            virtual const ColorSource* getColorSource() = 0;
+            // Updates the current ColorSource in place, without a transition or restarting its animation
+            // A ColorSource that is set but not yet shown is patched instead
+            // Returns false if the current ColorSource does not have the same uid and type as cs
+            virtual bool patchColorSource(const ColorSource& cs) = 0;
+
+            // Changes made between beginTransaction() and commitTransaction() are held back and then
+            // applied together at the start of the next frame, so that they share a single transition
+            virtual void beginTransaction() = 0;
+            virtual void commitTransaction() = 0;
+            // Incremented whenever the displayed brightness or ColorSource changes, allowing
+            // consumers to cache anything derived from the current scene
+            virtual uint32_t getSceneVersion() = 0;
+            virtual const BootMetrics& getBootMetrics() = 0;
+            virtual ConnectivityService& getConnectivityService() = 0;
+            virtual const QualityGovernor& getQualityGovernor() = 0;
             virtual int getSupportedFeatures() = 0;
+
+            // Replaces how rendered pixels are laid out on the strip, and persists it
+            // Returns false if the map does not fit the pixel count and group size the core was created with
+            virtual bool setPixelMap(const PixelMap& pixelMap) = 0;
+            // Restores the map set by the pixel group size, and removes the persisted map
+            virtual void resetPixelMap() = 0;
+            virtual const PixelMap& getPixelMap() = 0;
+            // Gamma and white balance applied to every pixel shown, along with the brightness
+            virtual void setColorCalibration(const ColorCalibration& calibration) = 0;
+            virtual const ColorCalibration& getColorCalibration() = 0;
+
+            // Segments show their own ColorSource and brightness on a range of pixels, in place of the
+            // main ColorSource. Segment changes are not held back by transactions, and are not persisted
+            // Adds or moves a segment, returns false if the range is outside the strip, overlaps another
+            // segment, or every segment is already in use
+            virtual bool setSegment(uint8_t id, uint16_t start, uint16_t length) = 0;
+            // Returns false if there is no segment with the id, as do the other segment methods
+            virtual bool removeSegment(uint8_t id) = 0;
+            virtual bool setSegmentColorSource(uint8_t id, const ColorSource& cs) = 0;
+            // Takes ownership of cs instead of copying it, cs is released if there is no segment with the id
+            virtual bool setSegmentColorSource(uint8_t id, std::unique_ptr<ColorSource> cs) = 0;
+            virtual bool clearSegmentColorSource(uint8_t id) = 0;
+            virtual bool setSegmentBrightness(uint8_t id, uint8_t brightness) = 0;
+            virtual uint8_t getSegmentCount() = 0;
+            // Segments are listed in order of their first pixel
+            // Returns a SegmentInfo that is not valid if index is not less than getSegmentCount()
+            virtual SegmentInfo getSegment(uint8_t index) = 0;
             
-            virtual const LightWeaverPlugin* getPluginOfType(const String& type) = 0;
+            virtual LightWeaverPlugin* getPluginOfType(PluginTypeId type) = 0;
+
+            template <typename PLUGIN>
+            PLUGIN* getPlugin() {
+                return static_cast<PLUGIN*>(getPluginOfType(getPluginTypeId<PLUGIN>()));
+            }
     };
 }
\ No newline at end of file
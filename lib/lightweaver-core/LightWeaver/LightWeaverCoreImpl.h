@@ -1,10 +1,21 @@
 #pragma once
+#include <algorithm>
 #include <memory>
 #include "LightWeaverCore.h"
 #include "LightWeaverPlugin.h"
+#include "PluginSet.h"
+#include "QualityGovernor.h"
 #include "ColorSource.h"
 #include "Features.h"
+#include "FrameColor.h"
+#include "OutputLut.h"
+#include "PixelMap.h"
 #include "animation/Animator.h"
+#include "drivers/UpdateDriver.h"
+#include "persistence/PixelMapStore.h"
+#include "persistence/SceneSnapshot.h"
+#include "util/AllocationAudit.h"
+#include "util/Trace.h"
 
 namespace LightWeaver {
     /**
@@ -16,9 +27,14 @@ namespace LightWeaver {
      * determine the final display color and handles smoothly transitioning colors when 
      * the ColorSource is changed. Brightness changes are also handled via smooth transitions.
      * 
+     * Segments replace the primary ColorSource on ranges of pixels with their own ColorSource,
+     * brightness and transitions. Every frame is rendered in a single pass over runs of pixels
+     * that each belong to either a segment or the primary ColorSource.
      * 
+     * Plugins are listed as template parameters, and are constructed, set up and looped
+     * in that order.
      */
-    template <typename T_DRIVER, uint8_t MAXIMUM_PLUGINS = 0>
+    template <typename T_DRIVER, typename... PLUGINS>
     class LightWeaverCoreImpl : public LightWeaverCore
     {
     private:
@@ -61,6 +77,84 @@ namespace LightWeaver {
 
         };
 
+        // Scene changes staged by an open or committed transaction
+        struct PendingScene {
+            bool hasColorSource = false;
+            // A null ColorSource clears the current one
+            std::unique_ptr<ColorSource> colorSource;
+            bool hasBrightness = false;
+            uint8_t brightness = 0;
+
+            void clear() {
+                hasColorSource = false;
+                colorSource.reset();
+                hasBrightness = false;
+            }
+        };
+
+        // A ColorSource rendered onto a range of pixels, with its own color transition and key frames
+        struct Layer {
+            // Pixels the ColorSource is evaluated over, the background covers the whole strip
+            uint16_t start = 0;
+            uint16_t length = 0;
+            ColorSource* colorSource = nullptr;
+            // Incremented whenever the ColorSource is replaced or patched. Brightness and other layers
+            // don't change what the ColorSource renders, so they leave the key frames as they are
+            uint32_t sourceVersion = 0;
+            Transition<std::unique_ptr<FrameColor[]>>* colorTransition = nullptr;
+            // Animator slot of the ColorSource's animation, the color transition uses the next slot
+            uint16_t animationIndex = 0;
+            // Control points evaluated this frame, over all of the layer's runs
+            uint16_t controlPointCount = 0;
+
+            // The two latest evaluations of each control point, for ColorSources with a key frame interval.
+            // Frames are interpolated from the previous towards the next key frame, so the output trails
+            // the ColorSource by up to one key frame interval
+            std::unique_ptr<RgbColor[]> previousKeyFrame;
+            std::unique_ptr<RgbColor[]> nextKeyFrame;
+            uint16_t keyFrameInterval = 0;
+            uint32_t keyFrameTime = 0;
+            uint32_t keyFrameSourceVersion = 0;
+            uint16_t keyFrameControlPointCount = 0;
+            // Whether the current frame evaluates the ColorSource, and whether both key frames are replaced
+            bool isKeyFrame = false;
+            bool isKeyFrameReset = false;
+            // Progress from the previous to the next key frame, out of 256
+            uint16_t keyFrameProgress = 0;
+
+            ~Layer() {
+                delete colorSource;
+                delete colorTransition;
+            }
+        };
+
+        struct Segment : Layer {
+            uint8_t id = 0;
+            bool isUsed = false;
+            uint8_t brightness = 255;
+            // Uses the animator slot after the color transition
+            Transition<uint8_t>* brightnessTransition = nullptr;
+            // ColorSource set while a frame was being rendered, shown from the next frame. A null ColorSource clears it
+            bool hasPendingColorSource = false;
+            std::unique_ptr<ColorSource> pendingColorSource;
+
+            ~Segment() {
+                delete brightnessTransition;
+            }
+        };
+
+        // Consecutive pixels rendered from the same layer
+        struct Run {
+            Layer* layer;
+            uint16_t start;
+            uint16_t length;
+            // Brightness of the run's segment, fixed for the duration of a frame
+            uint8_t brightness;
+            // Index of the run's first control point among all of the layer's control points
+            uint16_t firstControlPoint;
+            uint16_t controlPointCount;
+        };
+
     // Todo: Compile time optimization of features
     //     static const bool supportsBrightness = static_cast<bool>(T_DRIVER::SupportedFeatures & SupportedFeature::BRIGHTNESS);
     //     static const bool supportsColor = static_cast<bool>(T_DRIVER::SupportedFeatures & SupportedFeature::COLOR);
@@ -68,35 +162,250 @@ namespace LightWeaver {
     //     static const bool supportsAddressable = static_cast<bool>(T_DRIVER::SupportedFeatures & SupportedFeature::ADDRESSABLE);
 
         T_DRIVER driver;
-        uint8_t pixelCount;
+        uint16_t pixelCount;
         uint8_t pixelGroupSize;
         uint8_t brightness;
 
-        LightWeaverPlugin** plugins = new LightWeaverPlugin*[MAXIMUM_PLUGINS];
-        uint8_t currentPlugins = 0;
+        // Pixels are rendered in logical order, and only mapped onto the driver once the frame is complete
+        PixelMap pixelMap;
+        // Physical pixels no longer covered by the map are cleared on the next frame
+        bool isPixelMapChanged = false;
+        // Calibration and brightness are applied as pixels are mapped onto the driver
+        OutputLut outputLut;
 
         static const int BACKGROUND_ANIMATION = 0;
-        static const int COLOR_TRANSITION_ANIMATION = 1;
         static const int BRIGHTNESS_TRANSITION_ANIMATION = 2;
-        Animator animator{3, Animator::AnimatorTimescale::MILLISECOND};
+        // Each segment has its own ColorSource animation, color transition and brightness transition
+        static const int FIRST_SEGMENT_ANIMATION = 3;
+        static const uint8_t MAXIMUM_SEGMENTS = LIGHTWEAVER_MAXIMUM_SEGMENTS;
+        Animator animator{FIRST_SEGMENT_ANIMATION + 3 * MAXIMUM_SEGMENTS, Animator::AnimatorTimescale::MILLISECOND};
 
-        std::unique_ptr<RgbColor[]> cachedColors;
+        std::unique_ptr<FrameColor[]> cachedColors;
+#ifdef LIGHTWEAVER_DITHERING
+        std::unique_ptr<DitherError[]> ditherErrors;
+        // The last frame is shown again with new dithering while no frame is being rendered
+        static const uint32_t DITHER_FRAME_INTERVAL = 10000;
+        uint32_t lastShowMicros = 0;
+#endif
 
-        ColorSource* backgroundColorSource = nullptr;
-        Transition<std::unique_ptr<RgbColor[]>>* colorTransition = nullptr;
+        Layer background;
         Transition<uint8_t>* brightnessTransition = nullptr;
 
-        RgbColor getDisplayColor(uint8_t pixel = 0) {
-            RgbColor backgroundColor = backgroundColorSource ? backgroundColorSource->getColor(pixel, pixelCount) : RgbaColor(0,0,0,255);
+        // Segments keep their slot, and so their animator slots, for as long as they exist
+        Segment segments[MAXIMUM_SEGMENTS];
+        // Slots of the segments in use, in order of their first pixel
+        uint8_t segmentOrder[MAXIMUM_SEGMENTS];
+        uint8_t segmentCount = 0;
+        // Runs cover the whole strip in order, alternating between the background and the segments
+        Run runs[2 * MAXIMUM_SEGMENTS + 1];
+        uint8_t runCount = 0;
+        // Incremented whenever the runs are rebuilt
+        uint32_t layoutVersion = 0;
+
+        PendingScene pendingScene;
+        bool isTransactionOpen = false;
+        bool isTransactionCommitted = false;
+
+        uint32_t sceneVersion = 0;
+
+        SceneSnapshot snapshot;
+        uint32_t snapshotVersion = 0;
+        BootMetrics bootMetrics;
+
+        // Frames are rendered in slices of at most renderBudget microseconds per loop(), so that
+        // long strips or expensive ColorSources do not starve the network stack
+        uint32_t renderBudget = DEFAULT_RENDER_BUDGET;
+        // Next pixel to render, frames are only shown once every pixel has been rendered
+        uint16_t renderPosition = 0;
+        uint32_t renderLayoutVersion = 0;
+        // Pixels between evaluated pixels are interpolated, fixed for the duration of a frame
+        uint8_t renderStride = 1;
+        uint8_t renderRun = 0;
+        // Control point within the current run
+        uint16_t renderControlPoint = 0;
+        uint16_t lastControlPointPosition = 0;
+        FrameColor lastControlPointColor;
+        uint32_t frameStartTime = 0;
+        // Time spent rendering and showing the current frame, in microseconds. The time between
+        // slices is spent on the network and plugins, so it is not counted against the frame
+        uint32_t frameRenderTime = 0;
+
+        QualityGovernor governor;
+
+        ConnectivityService connectivity;
+
+        // Declared last so that plugins are destroyed before the services they use
+        PluginSet<PLUGINS...> plugins;
+
+        RgbColor getSourceColor(const Layer& layer, uint16_t pixel) {
+            return layer.colorSource ? layer.colorSource->getColor(pixel - layer.start, layer.length) : RgbaColor(0,0,0,255);
+        }
+
+        // Transitions are blended per pixel, so a transition from a detailed scene stays accurate
+        // even if the new ColorSource is interpolated between control points
+        FrameColor getDisplayColor(Layer& layer, uint16_t pixel, const FrameColor& sourceColor) {
+            Transition<std::unique_ptr<FrameColor[]>>*& colorTransition = layer.colorTransition;
             if (colorTransition) {
                 if (colorTransition->progress < 1.0f) {
-                    return RgbColor::linearBlend(colorTransition->originalValue[pixel], backgroundColor, colorTransition->progress);
+                    return FrameColor::linearBlend(colorTransition->originalValue[pixel - layer.start], sourceColor, colorTransition->progress);
                 } else if (colorTransition->progress == 1.0f) {
                     delete colorTransition;
                     colorTransition = nullptr;
                 }
             }
-            return backgroundColor;
+            return sourceColor;
+        }
+
+        void setDisplayColor(Layer& layer, uint16_t pixel, const FrameColor& sourceColor) {
+            cachedColors[pixel] = getDisplayColor(layer, pixel, sourceColor);
+        }
+
+        static FrameColor dim(const FrameColor& color, uint8_t brightness) {
+            return FrameColor(
+                (uint32_t)color.R * brightness / 255,
+                (uint32_t)color.G * brightness / 255,
+                (uint32_t)color.B * brightness / 255);
+        }
+
+        void showPixels() {
+            if (isPixelMapChanged) {
+                driver.setColor(RgbColor(0, 0, 0), 0, pixelCount * pixelGroupSize);
+                isPixelMapChanged = false;
+            }
+            outputLut.setBrightness(getDisplayBrightness());
+#ifdef LIGHTWEAVER_DITHERING
+            pixelMap.apply(driver, pixelCount, [this](uint16_t pixel) { return outputLut.apply(cachedColors[pixel], ditherErrors[pixel]); });
+            lastShowMicros = micros();
+#else
+            pixelMap.apply(driver, pixelCount, [this](uint16_t pixel) { return outputLut.apply(cachedColors[pixel]); });
+#endif
+        }
+
+        void showFrame() {
+            showPixels();
+            TRACE_EVENT(TraceEvent::Show, TracePhase::Begin, pixelCount);
+            driver.loop();
+            TRACE_EVENT(TraceEvent::Show, TracePhase::End, pixelCount);
+        }
+
+        void restorePixelMap() {
+            PixelMap restoredPixelMap = pixelMap;
+            if (PixelMapStore::restore(restoredPixelMap) && restoredPixelMap.fits(pixelCount, pixelCount * pixelGroupSize)) {
+                pixelMap = std::move(restoredPixelMap);
+            }
+        }
+
+        // Pixel of the given control point, the first and last control points are the ends of the run
+        uint16_t getControlPointPosition(const Run& run, uint16_t controlPoint) {
+            if (run.controlPointCount <= 1) return run.start;
+            return run.start + (uint32_t)controlPoint * (run.length - 1) / (run.controlPointCount - 1);
+        }
+
+        uint16_t getControlPointCount(const Layer& layer, uint16_t length) {
+            uint16_t count = layer.colorSource ? layer.colorSource->getControlPointCount(layer.length) : 1;
+            // A run covering part of the layer gets its share of the control points, rounded up
+            if (length < layer.length && count > 1) {
+                count = ((uint32_t)(count - 1) * (length - 1) + layer.length - 2) / (layer.length - 1) + 1;
+            }
+            // The governor's pixel stride caps the number of evaluated pixels when frames overrun
+            uint16_t maximumCount = (length - 1) / renderStride + 1;
+            count = std::min(count, maximumCount);
+            return count == 0 ? 1 : count;
+        }
+
+        uint8_t getSegmentBrightness(Segment& segment) {
+            Transition<uint8_t>*& transition = segment.brightnessTransition;
+            if (transition) {
+                if (transition->progress < 1.0f) {
+                    return (segment.brightness - transition->originalValue) * transition->progress + transition->originalValue;
+                } else if (transition->progress == 1.0f) {
+                    delete transition;
+                    transition = nullptr;
+                }
+            }
+            return segment.brightness;
+        }
+
+        // Decides whether this frame evaluates the ColorSource or interpolates between key frames
+        void startKeyFrame(Layer& layer) {
+            layer.keyFrameInterval = layer.colorSource ? layer.colorSource->getKeyFrameInterval() : 0;
+            if (layer.keyFrameInterval == 0 || layer.controlPointCount == 0) return;
+
+            bool isAllocated = false;
+            if (!layer.previousKeyFrame) {
+                layer.previousKeyFrame = std::unique_ptr<RgbColor[]>{new RgbColor[layer.length]};
+                layer.nextKeyFrame = std::unique_ptr<RgbColor[]>{new RgbColor[layer.length]};
+                isAllocated = true;
+            }
+
+            uint32_t now = millis();
+            layer.isKeyFrameReset = isAllocated || layer.keyFrameSourceVersion != layer.sourceVersion || layer.keyFrameControlPointCount != layer.controlPointCount;
+            layer.isKeyFrame = layer.isKeyFrameReset || now - layer.keyFrameTime >= layer.keyFrameInterval;
+            if (layer.isKeyFrame) {
+                layer.keyFrameTime = now;
+                layer.keyFrameSourceVersion = layer.sourceVersion;
+                layer.keyFrameControlPointCount = layer.controlPointCount;
+            }
+            uint32_t elapsed = now - layer.keyFrameTime;
+            layer.keyFrameProgress = elapsed >= layer.keyFrameInterval ? 256 : elapsed * 256 / layer.keyFrameInterval;
+        }
+
+        // Fixes the control points and brightness of every run, and the key frames of every layer, for this frame
+        void startFrame() {
+            background.controlPointCount = 0;
+            for (uint8_t i = 0; i < segmentCount; i++) {
+                segments[segmentOrder[i]].controlPointCount = 0;
+            }
+            for (uint8_t i = 0; i < runCount; i++) {
+                Run& run = runs[i];
+                run.controlPointCount = getControlPointCount(*run.layer, run.length);
+                run.firstControlPoint = run.layer->controlPointCount;
+                run.layer->controlPointCount += run.controlPointCount;
+                run.brightness = run.layer == &background ? 255 : getSegmentBrightness(*static_cast<Segment*>(run.layer));
+            }
+            startKeyFrame(background);
+            for (uint8_t i = 0; i < segmentCount; i++) {
+                startKeyFrame(segments[segmentOrder[i]]);
+            }
+        }
+
+        FrameColor getControlPointColor(Layer& layer, uint16_t controlPoint, uint16_t position) {
+            if (layer.keyFrameInterval == 0) {
+                return getSourceColor(layer, position);
+            }
+
+            if (layer.isKeyFrame) {
+                RgbColor color = getSourceColor(layer, position);
+                layer.previousKeyFrame[controlPoint] = layer.isKeyFrameReset ? color : layer.nextKeyFrame[controlPoint];
+                layer.nextKeyFrame[controlPoint] = color;
+            }
+            const RgbColor& previous = layer.previousKeyFrame[controlPoint];
+            const RgbColor& next = layer.nextKeyFrame[controlPoint];
+            uint16_t keyFrameProgress = layer.keyFrameProgress;
+            return FrameColor(
+                (previous.R << FRAME_COLOR_FRACTION_BITS) + (((int16_t)next.R - previous.R) * keyFrameProgress * (1 << FRAME_COLOR_FRACTION_BITS) >> 8),
+                (previous.G << FRAME_COLOR_FRACTION_BITS) + (((int16_t)next.G - previous.G) * keyFrameProgress * (1 << FRAME_COLOR_FRACTION_BITS) >> 8),
+                (previous.B << FRAME_COLOR_FRACTION_BITS) + (((int16_t)next.B - previous.B) * keyFrameProgress * (1 << FRAME_COLOR_FRACTION_BITS) >> 8));
+        }
+
+        // Linearly interpolates the pixels after from up to and including to, in fixed point with
+        // 16 bits below the 8-bit levels
+        void interpolateControlPoints(Layer& layer, uint16_t from, const FrameColor& fromColor, uint16_t to, const FrameColor& toColor) {
+            const uint8_t shift = 16 - FRAME_COLOR_FRACTION_BITS;
+            uint16_t span = to - from;
+            int32_t stepR = ((int32_t)toColor.R - fromColor.R) * (1 << shift) / span;
+            int32_t stepG = ((int32_t)toColor.G - fromColor.G) * (1 << shift) / span;
+            int32_t stepB = ((int32_t)toColor.B - fromColor.B) * (1 << shift) / span;
+            int32_t r = ((int32_t)fromColor.R << shift) + (1 << (shift - 1));
+            int32_t g = ((int32_t)fromColor.G << shift) + (1 << (shift - 1));
+            int32_t b = ((int32_t)fromColor.B << shift) + (1 << (shift - 1));
+            for (uint16_t pixel = from + 1; pixel < to; pixel++) {
+                r += stepR;
+                g += stepG;
+                b += stepB;
+                setDisplayColor(layer, pixel, FrameColor(r >> shift, g >> shift, b >> shift));
+            }
+            setDisplayColor(layer, to, toColor);
         }
 
         uint8_t getDisplayBrightness() {
@@ -111,83 +420,297 @@ namespace LightWeaver {
             return brightness;
         }
 
+        Segment* findSegment(uint8_t id) {
+            for (uint8_t i = 0; i < segmentCount; i++) {
+                Segment& segment = segments[segmentOrder[i]];
+                if (segment.id == id) return &segment;
+            }
+            return nullptr;
+        }
+
+        // Sorts the segments in use by their first pixel, and splits the strip into runs around them
+        void updateRuns() {
+            segmentCount = 0;
+            for (uint8_t slot = 0; slot < MAXIMUM_SEGMENTS; slot++) {
+                if (!segments[slot].isUsed) continue;
+                uint8_t i = segmentCount++;
+                for (; i > 0 && segments[segmentOrder[i - 1]].start > segments[slot].start; i--) {
+                    segmentOrder[i] = segmentOrder[i - 1];
+                }
+                segmentOrder[i] = slot;
+            }
+
+            runCount = 0;
+            uint16_t position = 0;
+            for (uint8_t i = 0; i < segmentCount; i++) {
+                Segment& segment = segments[segmentOrder[i]];
+                if (segment.start > position) {
+                    runs[runCount++] = Run{&background, position, (uint16_t)(segment.start - position)};
+                }
+                runs[runCount++] = Run{&segment, segment.start, segment.length};
+                position = segment.start + segment.length;
+            }
+            if (position < pixelCount) {
+                runs[runCount++] = Run{&background, position, (uint16_t)(pixelCount - position)};
+            }
+            layoutVersion++;
+        }
+
+        void startColorTransition(Layer& layer) {
+            std::unique_ptr<FrameColor[]> colors = std::unique_ptr<FrameColor[]>{ new FrameColor[layer.length] };
+            memcpy(colors.get(), cachedColors.get() + layer.start, layer.length * sizeof(FrameColor));
+
+            animator.stopAnimation(layer.animationIndex + 1);
+            delete layer.colorTransition;
+            layer.colorTransition = new Transition<std::unique_ptr<FrameColor[]>>(std::move(colors));
+            animator.playAnimation(layer.animationIndex + 1, layer.colorTransition->animation);
+        }
+
+        // Takes ownership of colorSource, which may be null to show nothing
+        void replaceColorSource(Layer& layer, ColorSource* colorSource) {
+            startColorTransition(layer);
+            animator.stopAnimation(layer.animationIndex);
+            delete layer.colorSource;
+            layer.colorSource = colorSource;
+            if (colorSource) {
+                animator.playAnimation(layer.animationIndex, colorSource->getAnimation());
+            }
+            layer.sourceVersion++;
+            sceneVersion++;
+        }
+
+        void startBrightnessTransition(Transition<uint8_t>*& transition, uint8_t brightness, uint16_t animationIndex) {
+            animator.stopAnimation(animationIndex);
+            delete transition;
+            transition = new Transition<uint8_t>(brightness);
+            animator.playAnimation(animationIndex, transition->animation);
+        }
+
+        void releaseSegment(Segment& segment) {
+            for (uint16_t i = 0; i < 3; i++) {
+                animator.stopAnimation(segment.animationIndex + i);
+            }
+            delete segment.colorSource;
+            segment.colorSource = nullptr;
+            delete segment.colorTransition;
+            segment.colorTransition = nullptr;
+            delete segment.brightnessTransition;
+            segment.brightnessTransition = nullptr;
+            segment.previousKeyFrame.reset();
+            segment.nextKeyFrame.reset();
+            segment.hasPendingColorSource = false;
+            segment.pendingColorSource.reset();
+            segment.isUsed = false;
+        }
+
     public:
-        LightWeaverCoreImpl(uint8_t pixelCount, uint8_t pixelGroupSize, uint8_t brightness = 255) : 
+        // Default time spent rendering in each loop(), in microseconds
+        static const uint32_t DEFAULT_RENDER_BUDGET = 2000;
+
+        LightWeaverCoreImpl(uint16_t pixelCount, uint8_t pixelGroupSize, uint8_t brightness = 255) : 
             driver(T_DRIVER(pixelCount * pixelGroupSize)), 
             pixelCount(pixelCount),
             pixelGroupSize(pixelGroupSize),
             brightness(brightness),
-            cachedColors(std::unique_ptr<RgbColor[]>(new RgbColor[pixelCount] )) {}
+            pixelMap(PixelMap::withGroupSize(pixelCount, pixelGroupSize)),
+            cachedColors(std::unique_ptr<FrameColor[]>(new FrameColor[pixelCount] )),
+#ifdef LIGHTWEAVER_DITHERING
+            ditherErrors(std::unique_ptr<DitherError[]>(new DitherError[pixelCount])),
+#endif
+            plugins(*this) {
+            background.length = pixelCount;
+            background.animationIndex = BACKGROUND_ANIMATION;
+            for (uint8_t i = 0; i < MAXIMUM_SEGMENTS; i++) {
+                segments[i].animationIndex = FIRST_SEGMENT_ANIMATION + 3 * i;
+            }
+            updateRuns();
+        }
         virtual ~LightWeaverCoreImpl(){
-            delete backgroundColorSource;
-            backgroundColorSource = nullptr;
-            delete colorTransition;
-            colorTransition = nullptr;
             delete brightnessTransition;
             brightnessTransition = nullptr;
-            for (uint8_t i = 0; i < MAXIMUM_PLUGINS; i++) {
-                delete plugins[i];
-                plugins[i] = nullptr;
-            }
-            delete[] plugins;
-            plugins = nullptr;
         }
 
+        // Resolved at compile time, returns nullptr if PLUGIN was not listed
         template <typename PLUGIN>
-        bool addPlugin() {
-            if (currentPlugins >= MAXIMUM_PLUGINS) return false;
-            plugins[currentPlugins++] = new PLUGIN(*this);
-            return true;
+        PLUGIN* getPlugin() {
+            return plugins.template get<PLUGIN>();
+        }
+
+        LightWeaverPlugin* getPluginOfType(PluginTypeId type) {
+            return plugins.getOfType(type);
         }
 
-        const LightWeaverPlugin* getPluginOfType(const String& type) {
-            for (uint8_t i = 0; i < MAXIMUM_PLUGINS; i++) {
-                if (plugins[i] && plugins[i]->getType() == type) {
-                    return plugins[i];
+        // Sets the maximum time spent rendering in each loop(), in microseconds
+        // A budget of 0 renders every frame in a single loop()
+        void setRenderBudget(uint32_t budget) {
+            renderBudget = budget;
+        }
+
+        uint32_t getRenderBudget() {
+            return renderBudget;
+        }
+
+        virtual const QualityGovernor& getQualityGovernor() {
+            return governor;
+        }
+
+        // Displays the last persisted scene immediately, without a transition
+        void restoreScene() {
+            uint32_t restoreStart = micros();
+            std::unique_ptr<ColorSource> colorSource;
+            if (snapshot.begin() && snapshot.restore(brightness, colorSource)) {
+                bootMetrics.isSceneRestored = true;
+                if (colorSource) {
+                    background.colorSource = colorSource.release();
+                    animator.playAnimation(BACKGROUND_ANIMATION, background.colorSource->getAnimation());
                 }
             }
-            return nullptr;
+            bootMetrics.restoreDuration = micros() - restoreStart;
         }
 
-        void setup()
-        {
-            for (uint8_t i = 0; i < MAXIMUM_PLUGINS; i++) {
-                if (plugins[i]) {
-                    plugins[i]->setup();
+        // Renders pixels until the frame is complete or the budget is spent, and shows the frame
+        // once it is complete. A budget of 0 renders the whole frame. Returns true if the frame was shown
+        bool renderSlice(uint32_t budget) {
+            uint32_t sliceStart = micros();
+            // ColorSource changes wait for the next frame, but the runs of a frame in progress can't
+            // be continued once segments have been added, moved or removed
+            if (renderPosition > 0 && renderLayoutVersion != layoutVersion) {
+                renderPosition = 0;
+            }
+            if (renderPosition == 0) {
+                renderLayoutVersion = layoutVersion;
+                renderRun = 0;
+                renderControlPoint = 0;
+                startFrame();
+            }
+
+            TRACE_EVENT(TraceEvent::Render, TracePhase::Begin, renderPosition);
+            while (renderPosition < pixelCount) {
+                const Run& run = runs[renderRun];
+                Layer& layer = *run.layer;
+                uint16_t position = getControlPointPosition(run, renderControlPoint);
+                FrameColor color = getControlPointColor(layer, run.firstControlPoint + renderControlPoint, position);
+                // Dimming the control points dims the pixels interpolated between them
+                if (run.brightness < 255) {
+                    color = dim(color, run.brightness);
+                }
+                if (renderControlPoint == 0) {
+                    setDisplayColor(layer, position, color);
+                } else {
+                    interpolateControlPoints(layer, lastControlPointPosition, lastControlPointColor, position, color);
+                }
+                lastControlPointPosition = position;
+                lastControlPointColor = color;
+                renderControlPoint++;
+                renderPosition = position + 1;
+
+                uint16_t runEnd = run.start + run.length;
+                if (run.controlPointCount == 1) {
+                    // A single control point covers the whole run
+                    for (uint16_t i = position + 1; i < runEnd; i++) {
+                        setDisplayColor(layer, i, color);
+                    }
+                    renderPosition = runEnd;
+                }
+                if (renderPosition == runEnd) {
+                    renderRun++;
+                    renderControlPoint = 0;
+                }
+
+                if (budget && renderPosition < pixelCount && micros() - sliceStart >= budget) {
+                    TRACE_EVENT(TraceEvent::Render, TracePhase::End, renderPosition);
+                    frameRenderTime += micros() - sliceStart;
+                    return false;
                 }
             }
+            TRACE_EVENT(TraceEvent::Render, TracePhase::End, renderPosition);
+
+            showFrame();
+            renderPosition = 0;
+            frameRenderTime += micros() - sliceStart;
+            return true;
+        }
+
+        void render() {
+            renderSlice(0);
+        }
 
+        void setup()
+        {
+            // The restored scene is shown before any plugins are started, since plugins may
+            // take several seconds to start (e.g. while connecting to WiFi)
             driver.setup();
+            restoreScene();
+            restorePixelMap();
+            render();
+            bootMetrics.firstFrameTime = micros();
+
+            connectivity.begin();
+            plugins.setup();
         }
 
         void loop()
         {
-            for (uint8_t i = 0; i < MAXIMUM_PLUGINS; i++) {
-                if (plugins[i]) {
-                    plugins[i]->loop();
+            AUDIT_ALLOCATIONS("loop");
+            connectivity.loop();
+            {
+                AUDIT_ALLOCATIONS("loop/plugins");
+                plugins.loop(millis());
+            }
+            // Sends a frame that was waiting for the strip, before the next one is started
+            updateDriver(driver);
+
+            // Scene changes and animations only advance between frames, so every slice of a frame
+            // renders the same state
+            bool isRendering = renderPosition > 0;
+            if (!isRendering && millis() - frameStartTime >= governor.getFrameInterval()) {
+                frameStartTime = millis();
+                frameRenderTime = 0;
+                renderStride = governor.getPixelStride();
+                TRACE_EVENT(TraceEvent::Frame, TracePhase::Begin, renderStride);
+                if (isTransactionCommitted && !isTransactionOpen) {
+                    applyPendingScene();
                 }
+                applyPendingSegmentColorSources();
+                animator.loop();
+                isRendering = true;
+            }
+            if (isRendering && renderSlice(renderBudget)) {
+                TRACE_EVENT(TraceEvent::Frame, TracePhase::End, renderStride);
+                governor.onFrameRendered(frameRenderTime);
             }
+#ifdef LIGHTWEAVER_DITHERING
+            else if (!isRendering && micros() - lastShowMicros >= DITHER_FRAME_INTERVAL) {
+                showFrame();
+            }
+#endif
 
-            animator.loop();
-            for (uint8_t i = 0; i < pixelCount; i++) {
-                cachedColors[i] = getDisplayColor(i);
-                driver.setColor(cachedColors[i], i*pixelGroupSize, pixelGroupSize);
+            if (snapshotVersion != sceneVersion) {
+                snapshotVersion = sceneVersion;
+                snapshot.onSceneChanged();
+            }
+            {
+                AUDIT_ALLOCATIONS("loop/snapshot");
+                snapshot.loop(brightness, background.colorSource);
             }
-            driver.setBrightness(getDisplayBrightness());
-            driver.loop();
         }
 
         void startBrightnessTransition() {
-            uint8_t brightness = getDisplayBrightness();
-            animator.stopAnimation(BRIGHTNESS_TRANSITION_ANIMATION);
-            delete brightnessTransition;
-            brightnessTransition = new Transition<uint8_t>(brightness);
-            animator.playAnimation(BRIGHTNESS_TRANSITION_ANIMATION, brightnessTransition->animation);
+            startBrightnessTransition(brightnessTransition, getDisplayBrightness(), BRIGHTNESS_TRANSITION_ANIMATION);
         }
 
         virtual void setBrightness(uint8_t b) {
+            AUDIT_ALLOCATIONS("setBrightness");
+            // Brightness is only read when a frame is shown, so it only waits for the next frame to
+            // stay in order with a ColorSource that is waiting
+            if (isTransactionOpen || isTransactionCommitted) {
+                pendingScene.hasBrightness = true;
+                pendingScene.brightness = b;
+                return;
+            }
             startBrightnessTransition();
             brightness = b;
+            sceneVersion++;
         }
 
         virtual uint8_t getBrightness() {
@@ -195,32 +718,264 @@ namespace LightWeaver {
         }
 
         void startColorTransition() {
-            std::unique_ptr<RgbColor[]> colors = std::unique_ptr<RgbColor[]>{ new RgbColor[pixelCount] };
-            memcpy(colors.get(), cachedColors.get(), pixelCount * sizeof(RgbColor));
-
-            animator.stopAnimation(COLOR_TRANSITION_ANIMATION);
-            delete colorTransition;
-            colorTransition = new Transition<std::unique_ptr<RgbColor[]>>(std::move(colors));
-            animator.playAnimation(COLOR_TRANSITION_ANIMATION, colorTransition->animation);
+            startColorTransition(background);
         }
 
         virtual void clearColorSource() {
-            startColorTransition();
-            animator.stopAnimation(BACKGROUND_ANIMATION);
-            delete backgroundColorSource;
-            backgroundColorSource = nullptr;
+            AUDIT_ALLOCATIONS("clearColorSource");
+            applyColorSource(nullptr);
         }
 
         virtual void setColorSource(const ColorSource& cs) {
-            clearColorSource();
+            AUDIT_ALLOCATIONS("setColorSource");
+            applyColorSource(std::unique_ptr<ColorSource>(cs.clone()));
+        }
 
-            backgroundColorSource = cs.clone();
-            const Animation* anim = backgroundColorSource->getAnimation();
-            animator.playAnimation(BACKGROUND_ANIMATION, anim);
+        virtual void setColorSource(std::unique_ptr<ColorSource> cs) {
+            AUDIT_ALLOCATIONS("setColorSource");
+            applyColorSource(std::move(cs));
+        }
+
+        // Changes made while a frame is being rendered are applied at the start of the next frame,
+        // like a committed transaction, so that the slices already rendered are still shown
+        void applyColorSource(std::unique_ptr<ColorSource> cs) {
+            if (isTransactionOpen || isTransactionCommitted || renderPosition > 0) {
+                pendingScene.hasColorSource = true;
+                pendingScene.colorSource = std::move(cs);
+                if (!isTransactionOpen) {
+                    isTransactionCommitted = true;
+                }
+                return;
+            }
+            replaceColorSource(background, cs.release());
+        }
+
+        virtual const ColorSource* getColorSource() {
+            return background.colorSource;
+        }
+
+        virtual bool patchColorSource(const ColorSource& cs) {
+            AUDIT_ALLOCATIONS("patchColorSource");
+            // A ColorSource that is waiting for the next frame is patched before it is shown
+            ColorSource* colorSource = pendingScene.hasColorSource ? pendingScene.colorSource.get() : background.colorSource;
+            if (!colorSource || colorSource->uid != cs.uid || colorSource->getType() != cs.getType()) {
+                return false;
+            }
+
+            if (pendingScene.hasColorSource) {
+                colorSource->patch(cs);
+            } else if (colorSource->patch(cs)) {
+                animator.updateAnimation(BACKGROUND_ANIMATION, colorSource->getAnimation());
+                background.sourceVersion++;
+                sceneVersion++;
+            }
+            return true;
+        }
+
+        virtual void beginTransaction() {
+            // Any changes that are committed but not yet applied are kept, and merged with the new transaction
+            isTransactionOpen = true;
+        }
+
+        virtual void commitTransaction() {
+            isTransactionOpen = false;
+            isTransactionCommitted = true;
+        }
+
+        void applyPendingScene() {
+            AUDIT_ALLOCATIONS("applyPendingScene");
+            isTransactionCommitted = false;
+
+            // Both transitions are started on the same frame with the same timing, so a change 
+            // to both the color and brightness is displayed as one combined transition
+            if (pendingScene.hasColorSource) {
+                replaceColorSource(background, pendingScene.colorSource.release());
+            }
+            if (pendingScene.hasBrightness) {
+                setBrightness(pendingScene.brightness);
+            }
+
+            pendingScene.clear();
+        }
+
+        virtual uint32_t getSceneVersion() {
+            return sceneVersion;
+        }
+
+        virtual const BootMetrics& getBootMetrics() {
+            return bootMetrics;
+        }
+
+        virtual ConnectivityService& getConnectivityService() {
+            return connectivity;
         }
 
         virtual int getSupportedFeatures() {
             return T_DRIVER::SupportedFeatures;
         }
+
+        virtual bool setPixelMap(const PixelMap& map) {
+            if (!map.fits(pixelCount, pixelCount * pixelGroupSize)) {
+                return false;
+            }
+            if (map != pixelMap) {
+                pixelMap = map;
+                isPixelMapChanged = true;
+                // The map is still used if it cannot be persisted, it is only lost on restart
+                PixelMapStore::save(pixelMap);
+            }
+            return true;
+        }
+
+        virtual void resetPixelMap() {
+            PixelMap defaultPixelMap = PixelMap::withGroupSize(pixelCount, pixelGroupSize);
+            if (defaultPixelMap != pixelMap) {
+                pixelMap = std::move(defaultPixelMap);
+                isPixelMapChanged = true;
+            }
+            PixelMapStore::remove();
+        }
+
+        virtual const PixelMap& getPixelMap() {
+            return pixelMap;
+        }
+
+        virtual void setColorCalibration(const ColorCalibration& calibration) {
+            outputLut.setCalibration(calibration);
+        }
+
+        virtual const ColorCalibration& getColorCalibration() {
+            return outputLut.getCalibration();
+        }
+
+        virtual bool setSegment(uint8_t id, uint16_t start, uint16_t length) {
+            AUDIT_ALLOCATIONS("setSegment");
+            if (length == 0 || (uint32_t)start + length > pixelCount) {
+                return false;
+            }
+            Segment* segment = findSegment(id);
+            for (uint8_t i = 0; i < segmentCount; i++) {
+                const Segment& other = segments[segmentOrder[i]];
+                if (&other != segment && start < other.start + other.length && other.start < start + length) {
+                    return false;
+                }
+            }
+
+            if (!segment) {
+                for (uint8_t slot = 0; slot < MAXIMUM_SEGMENTS && !segment; slot++) {
+                    if (!segments[slot].isUsed) {
+                        segment = &segments[slot];
+                    }
+                }
+                if (!segment) {
+                    return false;
+                }
+                segment->isUsed = true;
+                segment->id = id;
+                segment->brightness = 255;
+            } else if (segment->start == start && segment->length == length) {
+                return true;
+            } else {
+                // Pixels the segment moves off fade back to the background
+                startColorTransition(background);
+                if (segment->length != length) {
+                    segment->previousKeyFrame.reset();
+                    segment->nextKeyFrame.reset();
+                }
+            }
+
+            segment->start = start;
+            segment->length = length;
+            startColorTransition(*segment);
+            updateRuns();
+            sceneVersion++;
+            return true;
+        }
+
+        virtual bool removeSegment(uint8_t id) {
+            AUDIT_ALLOCATIONS("removeSegment");
+            Segment* segment = findSegment(id);
+            if (!segment) {
+                return false;
+            }
+            startColorTransition(background);
+            releaseSegment(*segment);
+            updateRuns();
+            sceneVersion++;
+            return true;
+        }
+
+        virtual bool setSegmentColorSource(uint8_t id, const ColorSource& cs) {
+            AUDIT_ALLOCATIONS("setSegmentColorSource");
+            Segment* segment = findSegment(id);
+            if (!segment) {
+                return false;
+            }
+            applySegmentColorSource(*segment, std::unique_ptr<ColorSource>(cs.clone()));
+            return true;
+        }
+
+        virtual bool setSegmentColorSource(uint8_t id, std::unique_ptr<ColorSource> cs) {
+            AUDIT_ALLOCATIONS("setSegmentColorSource");
+            Segment* segment = findSegment(id);
+            if (!segment) {
+                return false;
+            }
+            applySegmentColorSource(*segment, std::move(cs));
+            return true;
+        }
+
+        virtual bool clearSegmentColorSource(uint8_t id) {
+            Segment* segment = findSegment(id);
+            if (!segment) {
+                return false;
+            }
+            applySegmentColorSource(*segment, nullptr);
+            return true;
+        }
+
+        // Like the primary ColorSource, waits for the next frame if a frame is being rendered
+        void applySegmentColorSource(Segment& segment, std::unique_ptr<ColorSource> cs) {
+            if (segment.hasPendingColorSource || renderPosition > 0) {
+                segment.hasPendingColorSource = true;
+                segment.pendingColorSource = std::move(cs);
+                return;
+            }
+            replaceColorSource(segment, cs.release());
+        }
+
+        void applyPendingSegmentColorSources() {
+            for (uint8_t i = 0; i < segmentCount; i++) {
+                Segment& segment = segments[segmentOrder[i]];
+                if (segment.hasPendingColorSource) {
+                    segment.hasPendingColorSource = false;
+                    replaceColorSource(segment, segment.pendingColorSource.release());
+                }
+            }
+        }
+
+        virtual bool setSegmentBrightness(uint8_t id, uint8_t b) {
+            AUDIT_ALLOCATIONS("setSegmentBrightness");
+            Segment* segment = findSegment(id);
+            if (!segment) {
+                return false;
+            }
+            startBrightnessTransition(segment->brightnessTransition, getSegmentBrightness(*segment), segment->animationIndex + 2);
+            segment->brightness = b;
+            sceneVersion++;
+            return true;
+        }
+
+        virtual uint8_t getSegmentCount() {
+            return segmentCount;
+        }
+
+        virtual SegmentInfo getSegment(uint8_t index) {
+            if (index >= segmentCount) {
+                return SegmentInfo{0, 0, 0, 0, nullptr};
+            }
+            const Segment& segment = segments[segmentOrder[index]];
+            return SegmentInfo{segment.id, segment.start, segment.length, segment.brightness, segment.colorSource};
+        }
     };
 };
\ No newline at end of file
@@ -8,6 +8,10 @@ namespace LightWeaver {
         LightWeaverCore * const lightWeaver;
 
         public:
+        // Minimum time between calls to loop() in milliseconds, plugins that need to be
+        // looped less often hide this with their own value
+        static const uint16_t LOOP_INTERVAL = 0;
+
         LightWeaverPlugin(): lightWeaver(nullptr) {};
         LightWeaverPlugin(LightWeaverCore& lightWeaver):
             lightWeaver(&lightWeaver) {};
@@ -15,7 +19,5 @@ namespace LightWeaver {
         virtual ~LightWeaverPlugin() {};
         virtual void setup() {};
         virtual void loop() {};
-
-        virtual const String& getType() = 0;
     };
 }
\ No newline at end of file
@@ -2,40 +2,49 @@
 #include <Arduino.h>
 #include <ESP8266WiFi.h>
 #include <LightWeaver/LightWeaverPlugin.h>
+#include <LightWeaver/ConnectivityService.h>
 
 namespace LightWeaver {
     /**
      * Utility class to simplify plugins that need to run code when the device
      * is connected to/disconnected from WiFi. Since that may not happen at startup
      * the plugin should not expect that WiFi is connect during setup()
+     *
+     * Connectivity changes are delivered by the core's ConnectivityService, so plugins
+     * do not need to poll the WiFi status in loop()
      */
-    class LightWeaverWebPlugin : public LightWeaverPlugin {
-        private:
-            bool _isConnected = false;
+    class LightWeaverWebPlugin : public LightWeaverPlugin, public ConnectivityListener {
         public:
             LightWeaverWebPlugin(LightWeaverCore& lightWeaver):
                 LightWeaverPlugin(lightWeaver) {};
-            virtual ~LightWeaverWebPlugin() {}
+            virtual ~LightWeaverWebPlugin() {
+                lightWeaver->getConnectivityService().unsubscribe(this);
+            }
 
             virtual void setup() {
-                if (WiFi.status() == WL_CONNECTED) {
-                    _isConnected = true;
+                ConnectivityService& connectivity = lightWeaver->getConnectivityService();
+                connectivity.subscribe(this);
+                if (connectivity.isConnected()) {
                     onWifiConnected();
                 }
             }
 
-            virtual void loop() {
-                wl_status_t status = WiFi.status();
-                if (!_isConnected && status == WL_CONNECTED) {
-                    _isConnected = true;
-                    onWifiConnected();
-                } else if (_isConnected && status != WL_CONNECTED) {
-                    _isConnected = false;
-                    onWifiDisconnected();
+            virtual void onConnectivityEvent(const ConnectivityEvent& event) {
+                switch (event.type) {
+                    case ConnectivityEvent::Type::Connected:
+                        onWifiConnected();
+                        break;
+                    case ConnectivityEvent::Type::Disconnected:
+                        onWifiDisconnected();
+                        break;
+                    case ConnectivityEvent::Type::IPChanged:
+                        onIPChanged(event.ip);
+                        break;
                 }
             }
 
             virtual void onWifiConnected() {};
             virtual void onWifiDisconnected() {};
+            virtual void onIPChanged(const IPAddress& ip) {};
     };
-}
\ No newline at end of file
+}
@@ -0,0 +1,58 @@
+#include "OutputLut.h"
+
+namespace LightWeaver {
+    const float OutputLut::MINIMUM_GAMMA = 0.1f;
+    const float OutputLut::MAXIMUM_GAMMA = 5.0f;
+
+    OutputLut::OutputLut() {
+        updateGammaLevels();
+        updateLevels();
+    }
+
+    void OutputLut::updateGammaLevels() {
+        for (uint16_t i = 0; i < 256; i++) {
+            gammaLevels[i] = calibration.gamma == 1.0f ? i * 257 : (uint16_t)(powf(i / 255.0f, calibration.gamma) * 65535.0f + 0.5f);
+        }
+    }
+
+    void OutputLut::updateLevels() {
+        const uint8_t channelLevels[3] = {calibration.whiteBalance.R, calibration.whiteBalance.G, calibration.whiteBalance.B};
+        for (uint8_t channel = 0; channel < 3; channel++) {
+            // The gamma level out of 65535 is scaled by the channel level and brightness, both out of 255
+            uint32_t scale = (uint32_t)channelLevels[channel] * brightness;
+            for (uint16_t i = 0; i < 256; i++) {
+#ifdef LIGHTWEAVER_DITHERING
+                // Split into the level and its remainder, since the level in 1/256ths overflows 32 bits
+                uint32_t level = (uint32_t)gammaLevels[i] * scale;
+                uint32_t remainder = level % (65535UL * 255);
+                levels[channel][i] = level / (65535UL * 255) * 256 + (remainder * 256 + 65535UL * 255 / 2) / (65535UL * 255);
+#else
+                levels[channel][i] = ((uint32_t)gammaLevels[i] * scale + 65535UL * 255 / 2) / (65535UL * 255);
+#endif
+            }
+#ifdef LIGHTWEAVER_DITHERING
+            levels[channel][256] = levels[channel][255];
+#endif
+        }
+    }
+
+    void OutputLut::setCalibration(const ColorCalibration& calibration) {
+        if (calibration == this->calibration) return;
+        bool isGammaChanged = calibration.gamma != this->calibration.gamma;
+        this->calibration = calibration;
+        if (isGammaChanged) {
+            updateGammaLevels();
+        }
+        updateLevels();
+    }
+
+    const ColorCalibration& OutputLut::getCalibration() const {
+        return calibration;
+    }
+
+    void OutputLut::setBrightness(uint8_t brightness) {
+        if (brightness == this->brightness) return;
+        this->brightness = brightness;
+        updateLevels();
+    }
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include <Arduino.h>
+
+#include "Color.h"
+#include "FrameColor.h"
+
+namespace LightWeaver {
+    // Corrections for the LEDs of a particular strip, applied to every pixel as it is sent to the driver
+    struct ColorCalibration {
+        // Exponent applied to each channel, 1.0 leaves the levels linear
+        float gamma = 1.0f;
+        // Level of each channel for full white, reducing the channels that are too strong
+        RgbColor whiteBalance{255, 255, 255};
+
+        bool operator==(const ColorCalibration& other) const {
+            return gamma == other.gamma && whiteBalance == other.whiteBalance;
+        }
+
+        bool operator!=(const ColorCalibration& other) const {
+            return !(*this == other);
+        }
+    };
+
+    /**
+     * Per-channel lookup tables combining the color calibration and the brightness, so that the
+     * output level of each pixel is a single lookup per channel
+     *
+     * The gamma curve is only recalculated when the calibration changes. A brightness change,
+     * e.g. on every frame of a brightness transition, only rescales the curve into the tables.
+     *
+     * With LIGHTWEAVER_DITHERING the tables keep 8 bits below each output level, and are interpolated
+     * for the fractional part of the FrameColor. The remainder is carried into the pixel's next frame,
+     * so that over several frames the pixel averages to the exact level.
+     */
+    class OutputLut {
+        public:
+            static const float MINIMUM_GAMMA;
+            static const float MAXIMUM_GAMMA;
+        private:
+            ColorCalibration calibration;
+            uint8_t brightness = 255;
+            // Gamma corrected level of each input level, out of 65535
+            uint16_t gammaLevels[256];
+#ifdef LIGHTWEAVER_DITHERING
+            // Output levels in 1/256ths, the last entry repeats the one before for interpolation
+            uint16_t levels[3][257];
+
+            static uint8_t dither(const uint16_t* channelLevels, uint16_t level, uint8_t& error) {
+                uint8_t index = level >> 8;
+                uint16_t output = channelLevels[index] + (((uint32_t)(channelLevels[index + 1] - channelLevels[index]) * (level & 0xFF)) >> 8);
+                output += error;
+                error = output & 0xFF;
+                return output >> 8;
+            }
+#else
+            uint8_t levels[3][256];
+#endif
+
+            void updateGammaLevels();
+            void updateLevels();
+        public:
+            OutputLut();
+
+            void setCalibration(const ColorCalibration& calibration);
+            const ColorCalibration& getCalibration() const;
+            void setBrightness(uint8_t brightness);
+
+#ifdef LIGHTWEAVER_DITHERING
+            RgbColor apply(const FrameColor& color, DitherError& error) const {
+                return RgbColor(dither(levels[0], color.R, error.R), dither(levels[1], color.G, error.G), dither(levels[2], color.B, error.B));
+            }
+#else
+            RgbColor apply(const RgbColor& color) const {
+                return RgbColor(levels[0][color.R], levels[1][color.G], levels[2][color.B]);
+            }
+#endif
+    };
+}
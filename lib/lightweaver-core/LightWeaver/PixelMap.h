@@ -0,0 +1,143 @@
+#pragma once
+#include <algorithm>
+#include <memory>
+#include <Arduino.h>
+
+#include "Color.h"
+
+namespace LightWeaver {
+    /**
+     * A run of logical pixels shown on consecutive physical pixels
+     *
+     * Spans are listed in logical order, so each span starts at the logical pixel after the end of the
+     * previous one. Each logical pixel is shown on groupSize physical pixels, from physicalStart onwards,
+     * or from the end of the span's physical pixels backwards if the span is reversed.
+     */
+    struct PixelSpan {
+        uint16_t length;
+        uint16_t physicalStart;
+        uint8_t groupSize;
+        bool isReversed;
+
+        uint32_t getPhysicalEnd() const {
+            return (uint32_t)physicalStart + (uint32_t)length * groupSize;
+        }
+
+        bool operator==(const PixelSpan& other) const {
+            return length == other.length && physicalStart == other.physicalStart && groupSize == other.groupSize && isReversed == other.isReversed;
+        }
+    };
+
+    /**
+     * Maps the logical pixels rendered by the core onto the physical pixels of the driver, as a list
+     * of run-length encoded spans
+     *
+     * Reversed spans handle strips mounted backwards and serpentine runs, gaps between spans skip
+     * dead pixels, and each span can repeat its pixels a different number of times. Physical pixels
+     * outside every span are kept off, and logical pixels after the last span are not shown.
+     */
+    class PixelMap {
+        public:
+            static const uint8_t MAXIMUM_SPANS = 64;
+        private:
+            uint8_t spanCount;
+            std::unique_ptr<PixelSpan[]> spans;
+
+            PixelMap(uint8_t spanCount, std::unique_ptr<PixelSpan[]> spans):
+                spanCount(spanCount),
+                spans(std::move(spans)) {}
+        public:
+            // Every logical pixel repeated groupSize times, as set by the core's pixelGroupSize
+            static PixelMap withGroupSize(uint16_t pixelCount, uint8_t groupSize) {
+                PixelSpan span{pixelCount, 0, groupSize, false};
+                return withSpans(1, &span);
+            }
+
+            static PixelMap withSpans(uint8_t count, const PixelSpan* spans) {
+                std::unique_ptr<PixelSpan[]> spanList = std::unique_ptr<PixelSpan[]>(count == 0 ? nullptr : new PixelSpan[count]);
+                if (count > 0) {
+                    memcpy(spanList.get(), spans, sizeof(PixelSpan) * count);
+                }
+                return PixelMap(count, std::move(spanList));
+            }
+
+            PixelMap(const PixelMap& other):
+                PixelMap(withSpans(other.spanCount, other.spans.get())) {}
+
+            PixelMap(PixelMap&& other) = default;
+
+            PixelMap& operator=(const PixelMap& other) {
+                if (this != &other) {
+                    spanCount = other.spanCount;
+                    spans = std::unique_ptr<PixelSpan[]>{other.spanCount > 0 ? new PixelSpan[other.spanCount] : nullptr};
+                    if (spanCount > 0) {
+                        memcpy(spans.get(), other.spans.get(), sizeof(PixelSpan) * spanCount);
+                    }
+                }
+                return *this;
+            }
+
+            PixelMap& operator=(PixelMap&& other) = default;
+
+            bool operator==(const PixelMap& other) const {
+                if (spanCount != other.spanCount) return false;
+                for (uint8_t i = 0; i < spanCount; i++) {
+                    if (!(spans[i] == other.spans[i])) return false;
+                }
+                return true;
+            }
+
+            bool operator!=(const PixelMap& other) const {
+                return !(*this == other);
+            }
+
+            uint8_t getSpanCount() const {
+                return spanCount;
+            }
+
+            const PixelSpan* getSpans() const {
+                return spans.get();
+            }
+
+            uint32_t getLogicalPixelCount() const {
+                uint32_t count = 0;
+                for (uint8_t i = 0; i < spanCount; i++) {
+                    count += spans[i].length;
+                }
+                return count;
+            }
+
+            // Whether every span is within the physical pixels, and every logical pixel mapped is rendered
+            bool fits(uint16_t logicalPixelCount, uint16_t physicalPixelCount) const {
+                if (spanCount == 0 || spanCount > MAXIMUM_SPANS) return false;
+                for (uint8_t i = 0; i < spanCount; i++) {
+                    const PixelSpan& span = spans[i];
+                    if (span.length == 0 || span.groupSize == 0 || span.getPhysicalEnd() > physicalPixelCount) return false;
+                }
+                return getLogicalPixelCount() <= logicalPixelCount;
+            }
+
+            // Sets the physical pixels of the driver from the color of each logical pixel, returned by
+            // getColor(pixel), in a single pass over the spans
+            template <typename T_DRIVER, typename T_GET_COLOR>
+            void apply(T_DRIVER& driver, uint16_t count, T_GET_COLOR getColor) const {
+                uint16_t logical = 0;
+                for (uint8_t i = 0; i < spanCount && logical < count; i++) {
+                    const PixelSpan& span = spans[i];
+                    uint16_t length = std::min<uint16_t>(span.length, count - logical);
+                    if (span.isReversed) {
+                        uint16_t physical = span.physicalStart + (span.length - 1) * span.groupSize;
+                        for (uint16_t j = 0; j < length; j++, physical -= span.groupSize) {
+                            driver.setColor(getColor(logical + j), physical, span.groupSize);
+                        }
+                    } else {
+                        uint16_t physical = span.physicalStart;
+                        for (uint16_t j = 0; j < length; j++, physical += span.groupSize) {
+                            driver.setColor(getColor(logical + j), physical, span.groupSize);
+                        }
+                    }
+                    logical += span.length;
+                }
+            }
+    };
+}
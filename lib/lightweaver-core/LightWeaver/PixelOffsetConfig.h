@@ -15,12 +15,12 @@ namespace LightWeaver {
             // For SCALE type
             float scale;
             // For LIST type
-            uint8_t offsetCount;
+            uint16_t offsetCount;
             std::unique_ptr<float[]> offsets;
             // For RANDOM type
             uint16_t factor1;
             uint16_t factor2;
-        PixelOffsetConfig(Type type, float scale, uint8_t offsetCount, std::unique_ptr<float[]> offsets, uint16_t factor1, uint16_t factor2) :
+        PixelOffsetConfig(Type type, float scale, uint16_t offsetCount, std::unique_ptr<float[]> offsets, uint16_t factor1, uint16_t factor2) :
             type(type),
             scale(scale),
             offsetCount(offsetCount),
@@ -28,7 +28,7 @@ namespace LightWeaver {
             factor1(factor1),
             factor2(factor2) {};
 
-        uint8_t getRandomIndex(uint8_t seed) const {
+        uint8_t getRandomIndex(uint16_t seed) const {
             return (seed * factor1) ^ factor2;
         }
         public:
@@ -39,14 +39,18 @@ namespace LightWeaver {
         static PixelOffsetConfig withScale(float scale) {
             return PixelOffsetConfig(Type::SCALE,scale,0,nullptr,0,0);
         }
-        static PixelOffsetConfig withList(uint8_t count, float* offsets) {
+        static PixelOffsetConfig withList(uint16_t count, const float* offsets) {
             std::unique_ptr<float[]> offsetList = std::unique_ptr<float[]>(count == 0 ? nullptr : new float[count]);
             if (offsetList && count > 0) {
                 memcpy(offsetList.get(), offsets, sizeof(float) * count);
             }
-            PixelOffsetConfig config = PixelOffsetConfig(Type::LIST, 0, count, std::move(offsetList), 0, 0);
-            return config;
-
+            return withList(count, std::move(offsetList));
+        }
+        // Takes ownership of an already populated offset list, avoiding a second copy of large lists
+        static PixelOffsetConfig withList(uint16_t count, std::unique_ptr<float[]> offsets) {
+            // The count is read before the list is moved, as the order arguments are evaluated in is unspecified
+            uint16_t offsetCount = offsets ? count : 0;
+            return PixelOffsetConfig(Type::LIST, 0, offsetCount, std::move(offsets), 0, 0);
         }
         static PixelOffsetConfig withRandom() {
             return PixelOffsetConfig(Type::RANDOM, 0, 0, nullptr, random(0xFF00,0xFFFF) * 2 + 1, random(0xFF00, 0xFFFF) * 2 + 1);
@@ -59,12 +63,75 @@ namespace LightWeaver {
             offsets(std::unique_ptr<float[]>{other.offsetCount > 0 ? new float[offsetCount] : nullptr}),
             factor1(other.factor1),
             factor2(other.factor2) {
-                for (uint8_t i = 0; i < other.offsetCount; i++) {
+                for (uint16_t i = 0; i < other.offsetCount; i++) {
                     this->offsets[i] = other.offsets[i];
                 }
             }
 
-        const float getOffset(uint8_t index, uint8_t count) const{
+        // Moving keeps the same offset list, which may be large
+        PixelOffsetConfig(PixelOffsetConfig&& other) = default;
+        PixelOffsetConfig& operator=(PixelOffsetConfig&& other) = default;
+
+        PixelOffsetConfig& operator=(const PixelOffsetConfig& other) {
+            if (this != &other) {
+                type = other.type;
+                scale = other.scale;
+                offsetCount = other.offsetCount;
+                offsets = std::unique_ptr<float[]>{other.offsetCount > 0 ? new float[other.offsetCount] : nullptr};
+                if (offsetCount > 0) {
+                    memcpy(offsets.get(), other.offsets.get(), sizeof(float) * offsetCount);
+                }
+                factor1 = other.factor1;
+                factor2 = other.factor2;
+            }
+            return *this;
+        }
+
+        // Random offsets are considered equal regardless of their seed, so that re-applying
+        // an unchanged configuration does not reshuffle the pixels
+        bool operator==(const PixelOffsetConfig& other) const {
+            if (type != other.type) return false;
+            switch (type) {
+                case Type::SCALE:
+                    return scale == other.scale;
+                case Type::RANDOM:
+                    return true;
+                case Type::LIST:
+                    return offsetCount == other.offsetCount && (offsetCount == 0 || memcmp(offsets.get(), other.offsets.get(), sizeof(float) * offsetCount) == 0);
+            }
+            return false;
+        }
+
+        bool operator!=(const PixelOffsetConfig& other) const {
+            return !(*this == other);
+        }
+
+        Type getType() const {
+            return type;
+        }
+
+        float getScale() const {
+            return scale;
+        }
+
+        uint16_t getOffsetCount() const {
+            return offsetCount;
+        }
+
+        const float* getOffsets() const {
+            return offsets.get();
+        }
+
+        // Number of evenly spaced pixels to evaluate for a function of the offset that needs
+        // samplesPerUnit samples per 1.0 of offset. Only scaled offsets vary smoothly between pixels
+        uint16_t getControlPointCount(uint16_t count, float samplesPerUnit) const {
+            if (type != Type::SCALE) return count;
+            if (scale == 0) return 1;
+            float controlPoints = ceil(fabs(scale) * samplesPerUnit) + 1;
+            return controlPoints >= count ? count : (uint16_t)controlPoints;
+        }
+
+        const float getOffset(uint16_t index, uint16_t count) const{
             switch (type) {
                 case Type::SCALE:
                     if (count <= 1) return 0;
@@ -73,7 +140,7 @@ namespace LightWeaver {
                     return (float)getRandomIndex(index) / 255.0f;
                 case Type::LIST:
                     if (offsetCount == 0) return 0;
-                    if (index > offsetCount) return 0;
+                    if (index >= offsetCount) return 0;
                     return offsets[index];
             }
             return 0;
@@ -0,0 +1,80 @@
+#pragma once
+#include <type_traits>
+#include "LightWeaverCore.h"
+#include "LightWeaverPlugin.h"
+
+namespace LightWeaver {
+    /**
+     * A fixed set of plugins, stored by value and dispatched statically
+     *
+     * Each plugin is constructed with the core, and is set up and looped in the order it
+     * is listed. Plugins are looped at most once every PLUGIN::LOOP_INTERVAL milliseconds.
+     * Each plugin class may only be listed once.
+     */
+    template <typename... PLUGINS>
+    class PluginSet {
+        public:
+            PluginSet(LightWeaverCore&) {}
+
+            void setup() {}
+            void loop(uint32_t) {}
+
+            template <typename PLUGIN>
+            PLUGIN* get() {
+                return nullptr;
+            }
+
+            LightWeaverPlugin* getOfType(PluginTypeId) {
+                return nullptr;
+            }
+    };
+
+    template <typename PLUGIN, typename... REST>
+    class PluginSet<PLUGIN, REST...> {
+        private:
+            PLUGIN plugin;
+            uint32_t lastLoopTime = 0;
+            PluginSet<REST...> rest;
+
+            template <typename T>
+            T* get(std::true_type) {
+                return &plugin;
+            }
+
+            template <typename T>
+            T* get(std::false_type) {
+                return rest.template get<T>();
+            }
+        public:
+            PluginSet(LightWeaverCore& lightWeaver):
+                plugin(lightWeaver),
+                rest(lightWeaver) {}
+
+            void setup() {
+                plugin.PLUGIN::setup();
+                rest.setup();
+            }
+
+            void loop(uint32_t now) {
+                // Qualified calls skip the virtual dispatch, and allow empty loops to be inlined away
+                if (PLUGIN::LOOP_INTERVAL == 0 || now - lastLoopTime >= PLUGIN::LOOP_INTERVAL) {
+                    lastLoopTime = now;
+                    plugin.PLUGIN::loop();
+                }
+                rest.loop(now);
+            }
+
+            // Resolved at compile time, returns nullptr if PLUGIN is not part of the set
+            template <typename T>
+            T* get() {
+                return get<T>(std::is_same<T, PLUGIN>());
+            }
+
+            LightWeaverPlugin* getOfType(PluginTypeId type) {
+                if (type == getPluginTypeId<PLUGIN>()) {
+                    return &plugin;
+                }
+                return rest.getOfType(type);
+            }
+    };
+}
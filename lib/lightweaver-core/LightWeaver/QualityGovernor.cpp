@@ -0,0 +1,104 @@
+#include "QualityGovernor.h"
+
+namespace LightWeaver {
+    uint32_t QualityGovernor::getFrameInterval(QualityLevel level) {
+        switch (level) {
+            case QualityLevel::Full:
+                return 0;
+            case QualityLevel::ReducedFrameRate:
+            case QualityLevel::Interpolated:
+                return 2 * TARGET_FRAME_TIME / 1000;
+            case QualityLevel::Static:
+            default:
+                return 1000;
+        }
+    }
+
+    uint8_t QualityGovernor::getPixelStride(QualityLevel level) {
+        if (level == QualityLevel::Interpolated || level == QualityLevel::Static) {
+            return INTERPOLATION_STRIDE;
+        }
+        return 1;
+    }
+
+    uint32_t QualityGovernor::getTargetFrameTime(QualityLevel level) {
+        if (level == QualityLevel::Full) {
+            return TARGET_FRAME_TIME;
+        }
+        return getFrameInterval(level) * 1000;
+    }
+
+    const char* QualityGovernor::getLevelName(QualityLevel level) {
+        switch (level) {
+            case QualityLevel::Full:
+                return "Full";
+            case QualityLevel::ReducedFrameRate:
+                return "ReducedFrameRate";
+            case QualityLevel::Interpolated:
+                return "Interpolated";
+            case QualityLevel::Static:
+                return "Static";
+            default:
+                return "Unknown";
+        }
+    }
+
+    void QualityGovernor::setLevel(QualityLevel level) {
+        this->level = level;
+        overrunFrames = 0;
+        isRecovering = false;
+    }
+
+    void QualityGovernor::onFrameRendered(uint32_t frameTime) {
+        lastFrameTime = frameTime;
+        averageFrameTime = averageFrameTime == 0 ? frameTime : (averageFrameTime * 7 + frameTime) / 8;
+
+        if (level != QualityLevel::Static && frameTime > getTargetFrameTime(level)) {
+            isRecovering = false;
+            if (++overrunFrames >= OVERRUN_FRAMES) {
+                setLevel(static_cast<QualityLevel>(static_cast<uint8_t>(level) + 1));
+            }
+            return;
+        }
+        overrunFrames = 0;
+
+        if (level == QualityLevel::Full) return;
+
+        // Estimate the frame time at the next level up, which only differs in the number of evaluated pixels.
+        // Only recovering below 3/4 of its target keeps the levels from alternating under a steady load
+        QualityLevel higherLevel = static_cast<QualityLevel>(static_cast<uint8_t>(level) - 1);
+        uint32_t estimatedFrameTime = frameTime / getPixelStride(higherLevel) * getPixelStride(level);
+        if (estimatedFrameTime >= getTargetFrameTime(higherLevel) / 4 * 3) {
+            isRecovering = false;
+            return;
+        }
+
+        uint32_t now = millis();
+        if (!isRecovering) {
+            isRecovering = true;
+            recoveryStartTime = now;
+        } else if (now - recoveryStartTime >= RECOVERY_INTERVAL) {
+            setLevel(higherLevel);
+        }
+    }
+
+    QualityLevel QualityGovernor::getLevel() const {
+        return level;
+    }
+
+    uint32_t QualityGovernor::getFrameInterval() const {
+        return getFrameInterval(level);
+    }
+
+    uint8_t QualityGovernor::getPixelStride() const {
+        return getPixelStride(level);
+    }
+
+    uint32_t QualityGovernor::getLastFrameTime() const {
+        return lastFrameTime;
+    }
+
+    uint32_t QualityGovernor::getAverageFrameTime() const {
+        return averageFrameTime;
+    }
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include <Arduino.h>
+
+namespace LightWeaver {
+    enum class QualityLevel : uint8_t {
+        // Frames are rendered as often as possible
+        Full,
+        // Frames are rendered at a lower rate, leaving idle time between frames
+        ReducedFrameRate,
+        // Only every Nth pixel is evaluated, the pixels in between are interpolated
+        Interpolated,
+        // An interpolated frame is rendered about once a second
+        Static
+    };
+
+    /**
+     * Watches the time taken to render each frame, and lowers the render quality in steps
+     * while frames overrun their target. The quality is raised again one step at a time
+     * once frames are consistently fast enough for the higher level.
+     */
+    class QualityGovernor {
+        public:
+            // Target time spent rendering and showing a frame at full quality, in microseconds
+            static const uint32_t TARGET_FRAME_TIME = 20000;
+            // Consecutive overrunning frames before the quality is lowered
+            static const uint8_t OVERRUN_FRAMES = 5;
+            // Time frames must stay below the higher level's target before the quality is raised, in milliseconds
+            static const uint32_t RECOVERY_INTERVAL = 3000;
+            // Pixels evaluated per rendered pixel at the Interpolated and Static levels
+            static const uint8_t INTERPOLATION_STRIDE = 4;
+        private:
+            QualityLevel level = QualityLevel::Full;
+            uint8_t overrunFrames = 0;
+            bool isRecovering = false;
+            uint32_t recoveryStartTime = 0;
+            uint32_t lastFrameTime = 0;
+            uint32_t averageFrameTime = 0;
+
+            void setLevel(QualityLevel level);
+        public:
+            static uint32_t getFrameInterval(QualityLevel level);
+            static uint8_t getPixelStride(QualityLevel level);
+            // The longest a frame may take at the given level before it counts as an overrun, in microseconds
+            static uint32_t getTargetFrameTime(QualityLevel level);
+            static const char* getLevelName(QualityLevel level);
+
+            // Records a shown frame, which took frameTime microseconds to render and show, not counting
+            // the time between the slices it was rendered in
+            void onFrameRendered(uint32_t frameTime);
+
+            QualityLevel getLevel() const;
+            // Minimum time between the start of two frames, in milliseconds
+            uint32_t getFrameInterval() const;
+            uint8_t getPixelStride() const;
+            uint32_t getLastFrameTime() const;
+            uint32_t getAverageFrameTime() const;
+    };
+}
@@ -1,4 +1,5 @@
 #include "Animator.h"
+#include "../util/Trace.h"
 
 namespace LightWeaver {
     void Animator::setup() {}
@@ -28,6 +29,7 @@ namespace LightWeaver {
                     } else {
                         context.callback(AnimationParam(1.0f, context.animation.easingFunction(1.0f), context.iterations, AnimationState::Completed));
                         context.stop();
+                        TRACE_EVENT(TraceEvent::AnimationStopped, TracePhase::Instant, i);
                         continue;
                     }
                 }
@@ -72,6 +74,7 @@ namespace LightWeaver {
 
         uint16_t uid = (uint16_t) random(0xFFFF);
         animations[index].start(uid, animation);
+        TRACE_EVENT(TraceEvent::AnimationStarted, TracePhase::Instant, index);
             
         return index;
     }
@@ -95,8 +98,20 @@ namespace LightWeaver {
         return playAnimation(*animation);
     }
 
+    void Animator::updateAnimation(uint16_t index, const Animation& animation) const {
+        if (index < maxAnimations && animations[index].isActive()) {
+            animations[index].update(animation);
+        }
+    }
+
+    void Animator::updateAnimation(uint16_t index, const Animation* animation) const {
+        if (!animation) return;
+        updateAnimation(index, *animation);
+    }
+
     void Animator::stopAnimation(uint16_t animation) const {
         if (animation < maxAnimations) {
+            if (animations[animation].isActive()) TRACE_EVENT(TraceEvent::AnimationStopped, TracePhase::Instant, animation);
             animations[animation].stop();
         }
     }
@@ -31,6 +31,13 @@ namespace LightWeaver {
                     this->iterations = 0;
                 }
 
+                // Replaces the animation while keeping the same fraction of the current iteration complete
+                void update(const Animation& animation) {
+                    float progress = this->animation.duration == 0 ? 1.0f : (float)(this->animation.duration - this->remainingDuration) / (float)(this->animation.duration);
+                    this->animation = animation;
+                    this->remainingDuration = animation.duration - (uint16_t)(progress * animation.duration);
+                }
+
                 void stop() {
                     this->state = AnimationState::Stopped;
                 }
@@ -93,6 +100,8 @@ namespace LightWeaver {
             uint16_t playAnimation(const uint16_t index, const Animation* animation) const;
             uint16_t playAnimation(const Animation& animation) const;
             uint16_t playAnimation(const Animation* animation) const;
+            void updateAnimation(const uint16_t index, const Animation& animation) const;
+            void updateAnimation(const uint16_t index, const Animation* animation) const;
             void stopAnimation(uint16_t animation) const;
             void pauseAnimation(uint16_t animation) const;
             void resumeAnimation(uint16_t animation) const;
@@ -36,6 +36,10 @@ namespace LightWeaver {
                 return RgbaColor::linearBlend(start, end, progress);
             }
 
+            virtual uint16_t getControlPointCount(uint16_t count) const {
+                return 1;
+            }
+
             virtual ColorSource* clone() const {
                 return new FadeColorSource(uid, start, end, duration, loop, easing, progress);
             }
@@ -43,5 +47,46 @@ namespace LightWeaver {
             virtual const Animation* getAnimation() const {
                 return &animation;
             }
+
+            virtual Type getType() const {
+                return Type::Fade;
+            }
+
+            virtual bool patch(const ColorSource& other) {
+                const FadeColorSource& source = static_cast<const FadeColorSource&>(other);
+                if (start == source.start && end == source.end && duration == source.duration && loop == source.loop && easing == source.easing) {
+                    return false;
+                }
+
+                start = source.start;
+                end = source.end;
+                duration = source.duration;
+                loop = source.loop;
+                easing = source.easing;
+                animation.duration = duration;
+                animation.loop = loop;
+                animation.easingFunction = easing;
+                return true;
+            }
+
+            const RgbaColor& getStart() const {
+                return start;
+            }
+
+            const RgbaColor& getEnd() const {
+                return end;
+            }
+
+            uint16_t getDuration() const {
+                return duration;
+            }
+
+            bool isLooping() const {
+                return loop;
+            }
+
+            const EasingFunction& getEasing() const {
+                return easing;
+            }
     };
 }
\ No newline at end of file
@@ -11,18 +11,44 @@ namespace LightWeaver {
        private:
             uint16_t duration;
             bool loop;
-            const Gradient colors;
+            Gradient colors;
             EasingFunction easing;
 
-            const PixelOffsetConfig offsets;
+            PixelOffsetConfig offsets;
             
             float progress;
-            const Animation animation;
+            Animation animation;
 
             void onAnimationTick(const AnimationParam& param) {
                 progress = param.easedProgress;
             }
+
+            // Samples per 1.0 of progress, so that the narrowest band between two colors is sampled several times
+            // The last color is not blended back into the first, so the wrap between them is handled separately
+            float getSamplesPerUnit() const {
+                uint8_t minimumSpacing = 255;
+                for (uint8_t i = 1; i < colors.colorSet.size; i++) {
+                    uint8_t spacing = colors.colorPositions[i] - colors.colorPositions[i-1];
+                    if (spacing > 0 && spacing < minimumSpacing) minimumSpacing = spacing;
+                }
+                return SAMPLES_PER_BAND * 255.0f / minimumSpacing;
+            }
+
+            // Unless the gradient ends with the color it starts with, there is a hard edge wherever the progress of
+            // a pixel wraps from the last color back to the first, which can't be interpolated across
+            bool hasWrapEdge() const {
+                return colors.colorSet.size > 1 && colors.colorSet.colors[0] != colors.colorSet.colors[colors.colorSet.size - 1];
+            }
+
+            // Whether the edge falls between the first and last pixel, any offsets that aren't scaled are
+            // already evaluated at every pixel
+            bool isWrapEdgeOnStrip() const {
+                if (!hasWrapEdge() || offsets.getType() != PixelOffsetConfig::Type::SCALE) return false;
+                float scale = offsets.getScale();
+                return floor(progress + std::min(scale, 0.0f)) != floor(progress + std::max(scale, 0.0f));
+            }
         public:
+            static const uint8_t SAMPLES_PER_BAND = 4;
 
             GradientColorSource(uint32_t uid, const Gradient& colors, uint16_t duration, bool loop, EasingFunction easing = Easing::Linear, PixelOffsetConfig offsets = PixelOffsetConfig::withNone()) : 
                 ColorSource(uid),
@@ -30,7 +56,7 @@ namespace LightWeaver {
                 loop(loop),
                 colors(colors),
                 easing(easing),
-                offsets(offsets),
+                offsets(std::move(offsets)),
                 progress(0.0f),
                 animation(Animation(duration, loop, std::bind(&GradientColorSource::onAnimationTick, this, std::placeholders::_1), Easing::Linear)) {}
 
@@ -38,12 +64,30 @@ namespace LightWeaver {
                 return colors.getColor(progress);
             }
 
-            virtual RgbaColor getColor(uint8_t index, uint8_t count) const {
+            virtual RgbaColor getColor(uint16_t index, uint16_t count) const {
                 float offset = offsets.getOffset(index, count);
                 float offsetProgress = fmod(progress + offset, 1.0) + (offset < 0 ? 1 : 0);
                 return colors.getColor(offsetProgress);
             }
 
+            virtual uint16_t getControlPointCount(uint16_t count) const {
+                // Every pixel is evaluated while the wrap edge is on the strip, so that it is not turned into a ramp
+                if (isWrapEdgeOnStrip()) {
+                    return count;
+                }
+                return offsets.getControlPointCount(count, getSamplesPerUnit());
+            }
+
+            // Every pixel passes the wrap edge once per cycle, so key frames would turn it into a fade. They are
+            // not switched off only while the edge is on the strip, as restarting them pauses the animation
+            virtual uint16_t getKeyFrameInterval() const {
+                if (hasWrapEdge()) {
+                    return 0;
+                }
+                uint16_t interval = duration / getSamplesPerUnit();
+                return interval < MINIMUM_KEY_FRAME_INTERVAL ? 0 : interval;
+            }
+
             virtual ColorSource* clone() const {
                 return new GradientColorSource(uid, colors, duration, loop, easing, offsets);
             }
@@ -51,5 +95,45 @@ namespace LightWeaver {
             virtual const Animation* getAnimation() const {
                 return &animation;
             }
+
+            virtual Type getType() const {
+                return Type::Gradient;
+            }
+
+            virtual bool patch(const ColorSource& other) {
+                const GradientColorSource& source = static_cast<const GradientColorSource&>(other);
+                if (colors == source.colors && duration == source.duration && loop == source.loop && easing == source.easing && offsets == source.offsets) {
+                    return false;
+                }
+
+                if (colors != source.colors) colors = source.colors;
+                if (offsets != source.offsets) offsets = source.offsets;
+                duration = source.duration;
+                loop = source.loop;
+                easing = source.easing;
+                animation.duration = duration;
+                animation.loop = loop;
+                return true;
+            }
+
+            const Gradient& getGradient() const {
+                return colors;
+            }
+
+            uint16_t getDuration() const {
+                return duration;
+            }
+
+            bool isLooping() const {
+                return loop;
+            }
+
+            const EasingFunction& getEasing() const {
+                return easing;
+            }
+
+            const PixelOffsetConfig& getPixelOffsets() const {
+                return offsets;
+            }
     };
 }
\ No newline at end of file
@@ -16,7 +16,7 @@ namespace LightWeaver {
             float saturationDistance;
             float valueDistance;
 
-            const PixelOffsetConfig pixelOffsets;
+            PixelOffsetConfig pixelOffsets;
 
             float progress;
             Animation animation;
@@ -32,14 +32,17 @@ namespace LightWeaver {
             }
 
         public:
-            HsvMeanderColorSource(uint32_t uid, HsvaColor color, uint16_t duration, float hueDistance, float saturationDistance, float valueDistance, const PixelOffsetConfig pixelOffsets) : 
+            // The fastest component of getOffset() completes about 14 cycles per 1.0 of progress
+            static constexpr float SAMPLES_PER_UNIT = 14 * 8;
+
+            HsvMeanderColorSource(uint32_t uid, HsvaColor color, uint16_t duration, float hueDistance, float saturationDistance, float valueDistance, PixelOffsetConfig pixelOffsets) : 
                 ColorSource(uid),
                 color(color),
                 duration(duration),
                 hueDistance(hueDistance),
                 saturationDistance(saturationDistance),
                 valueDistance(valueDistance),
-                pixelOffsets(pixelOffsets),
+                pixelOffsets(std::move(pixelOffsets)),
                 progress(0.0f),
                 animation(Animation(duration, true, std::bind(&HsvMeanderColorSource::onAnimationTick, this, std::placeholders::_1), Easing::Linear)) {
                     animator.setup();
@@ -52,7 +55,7 @@ namespace LightWeaver {
                 return HsvaColor(h, s < 0 ? 0 : s > 1 ? 1 : s, v < 0 ? 0 : v > 1 ? 1 : v);
             }
 
-            virtual RgbaColor getColor(uint8_t index, uint8_t count) const {
+            virtual RgbaColor getColor(uint16_t index, uint16_t count) const {
                 float offset = pixelOffsets.getOffset(index,count);
                 float p = fmod(progress + offset, 1.0f) + (offset < 0 ? 1 : 0);
                 float h = color.H + getOffset(p) * hueDistance;
@@ -69,6 +72,15 @@ namespace LightWeaver {
                 return HsvaColor(h, s < 0 ? 0 : s > 1 ? 1 : s, v < 0 ? 0 : v > 1 ? 1 : v);
             }
 
+            virtual uint16_t getControlPointCount(uint16_t count) const {
+                return pixelOffsets.getControlPointCount(count, SAMPLES_PER_UNIT);
+            }
+
+            virtual uint16_t getKeyFrameInterval() const {
+                uint16_t interval = duration / SAMPLES_PER_UNIT;
+                return interval < MINIMUM_KEY_FRAME_INTERVAL ? 0 : interval;
+            }
+
             virtual ColorSource* clone() const {
                 return new HsvMeanderColorSource(uid, color, duration, hueDistance, saturationDistance, valueDistance, pixelOffsets);
             }
@@ -76,5 +88,51 @@ namespace LightWeaver {
             virtual const Animation* getAnimation() const {
                 return &animation;
             }
+
+            virtual Type getType() const {
+                return Type::HsvMeander;
+            }
+
+            virtual bool patch(const ColorSource& other) {
+                const HsvMeanderColorSource& source = static_cast<const HsvMeanderColorSource&>(other);
+                if (color == source.color && duration == source.duration && hueDistance == source.hueDistance
+                    && saturationDistance == source.saturationDistance && valueDistance == source.valueDistance
+                    && pixelOffsets == source.pixelOffsets) {
+                    return false;
+                }
+
+                color = source.color;
+                duration = source.duration;
+                hueDistance = source.hueDistance;
+                saturationDistance = source.saturationDistance;
+                valueDistance = source.valueDistance;
+                if (pixelOffsets != source.pixelOffsets) pixelOffsets = source.pixelOffsets;
+                animation.duration = duration;
+                return true;
+            }
+
+            const HsvaColor& getBaseColor() const {
+                return color;
+            }
+
+            uint16_t getDuration() const {
+                return duration;
+            }
+
+            float getHueDistance() const {
+                return hueDistance;
+            }
+
+            float getSaturationDistance() const {
+                return saturationDistance;
+            }
+
+            float getValueDistance() const {
+                return valueDistance;
+            }
+
+            const PixelOffsetConfig& getPixelOffsets() const {
+                return pixelOffsets;
+            }
     };
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #pragma once
+#include <algorithm>
 
 #include <LightWeaver/ColorSource.h>
 #include <LightWeaver/animation/Animator.h>
@@ -6,6 +7,8 @@
 namespace LightWeaver {
     class OverlayColorSource : public ColorSource {
         private:
+            static const uint16_t BACKGROUND_ANIMATION = 0;
+            static const uint16_t OVERLAY_ANIMATION = 1;
             Animator animator{2,Animator::AnimatorTimescale::MILLISECOND};
             ColorSource* backgroundColorSource;
             ColorSource* overlayColorSource;
@@ -13,8 +16,8 @@ namespace LightWeaver {
 
             void onAnimationTick(const AnimationParam& param) {
                 if (param.state == AnimationState::Started) {
-                    animator.playAnimation(backgroundColorSource->getAnimation());
-                    animator.playAnimation(overlayColorSource->getAnimation());
+                    animator.playAnimation(BACKGROUND_ANIMATION, backgroundColorSource->getAnimation());
+                    animator.playAnimation(OVERLAY_ANIMATION, overlayColorSource->getAnimation());
                 }
                 animator.loop();
                 if (!animator.isAnimating()) {
@@ -22,6 +25,21 @@ namespace LightWeaver {
                 }
             }
 
+            // Children with the same uid and type are patched in place, any other child is replaced and only its own animation restarted
+            bool patchChild(ColorSource*& child, const ColorSource& other, uint16_t animationIndex) {
+                if (child->uid == other.uid && child->getType() == other.getType()) {
+                    if (!child->patch(other)) return false;
+                    animator.updateAnimation(animationIndex, child->getAnimation());
+                    return true;
+                }
+
+                animator.stopAnimation(animationIndex);
+                delete child;
+                child = other.clone();
+                animator.playAnimation(animationIndex, child->getAnimation());
+                return true;
+            }
+
         public:
             OverlayColorSource(uint32_t uid, ColorSource& backgroundColorSource, ColorSource& overlayColorSource) : 
                 ColorSource(uid),
@@ -47,7 +65,7 @@ namespace LightWeaver {
                 return LightWeaver::RgbColor(R > 255 ? 255 : R, G > 255 ? 255 : G, B > 255 ? 255 : B);
             }
 
-            virtual RgbaColor getColor(uint8_t index, uint8_t count) {
+            virtual RgbaColor getColor(uint16_t index, uint16_t count) const {
                 LightWeaver::RgbColor backgroundColor = backgroundColorSource->getColor(index, count);
                 LightWeaver::RgbaColor overlayColor = overlayColorSource->getColor(index, count);
                 uint16_t R = backgroundColor.R + (float)(overlayColor.A)/255.0f * overlayColor.R;
@@ -56,6 +74,10 @@ namespace LightWeaver {
                 return LightWeaver::RgbColor(R > 255 ? 255 : R, G > 255 ? 255 : G, B > 255 ? 255 : B);
             }
 
+            virtual uint16_t getControlPointCount(uint16_t count) const {
+                return std::max(backgroundColorSource->getControlPointCount(count), overlayColorSource->getControlPointCount(count));
+            }
+
             virtual ColorSource* clone() const {
                 return new OverlayColorSource(uid, *backgroundColorSource, *overlayColorSource);
             }
@@ -63,5 +85,24 @@ namespace LightWeaver {
             virtual const Animation* getAnimation() const {
                 return &animation;
             }
+
+            virtual Type getType() const {
+                return Type::Overlay;
+            }
+
+            virtual bool patch(const ColorSource& other) {
+                const OverlayColorSource& source = static_cast<const OverlayColorSource&>(other);
+                bool backgroundChanged = patchChild(backgroundColorSource, *source.backgroundColorSource, BACKGROUND_ANIMATION);
+                bool overlayChanged = patchChild(overlayColorSource, *source.overlayColorSource, OVERLAY_ANIMATION);
+                return backgroundChanged || overlayChanged;
+            }
+
+            const ColorSource& getBackground() const {
+                return *backgroundColorSource;
+            }
+
+            const ColorSource& getOverlay() const {
+                return *overlayColorSource;
+            }
     };
 }
\ No newline at end of file
@@ -5,7 +5,7 @@
 namespace LightWeaver {
     class SolidColorSource : public ColorSource {
         private:
-            HslaColor color;
+            RgbaColor color;
         public:
             SolidColorSource(uint32_t uid, RgbaColor color) : 
                 ColorSource(uid),
@@ -15,8 +15,24 @@ namespace LightWeaver {
                 return color;
             }
 
+            virtual uint16_t getControlPointCount(uint16_t count) const {
+                return 1;
+            }
+
             virtual ColorSource* clone() const {
                 return new SolidColorSource(uid, color);
             }
+
+            virtual Type getType() const {
+                return Type::Solid;
+            }
+
+            virtual bool patch(const ColorSource& other) {
+                const SolidColorSource& source = static_cast<const SolidColorSource&>(other);
+                if (color == source.color) return false;
+
+                color = source.color;
+                return true;
+            }
     };
 }
\ No newline at end of file
@@ -1,21 +1,33 @@
-#include <NeoPixelBrightnessBus.h>
+#pragma once
+#include <type_traits>
+#include <NeoPixelBus.h>
 
 #include "../Color.h"
 
 #include "../Features.h"
+#include "UpdateDriver.h"
 
 namespace LightWeaver {
+    // Whether Show() returns while the pixels are still being sent, allowing other outputs to send at the same time
+    template <typename T_METHOD>
+    struct IsAsyncMethod : std::false_type {};
+    template <>
+    struct IsAsyncMethod<NeoEsp8266Dma800KbpsMethod> : std::true_type {};
+    template <>
+    struct IsAsyncMethod<NeoEsp8266AsyncUart1800KbpsMethod> : std::true_type {};
+
     /**
      * Driver class for controlling a strip of RGBW SK6182 LEDs using NeoPixelBus
+     *
+     * Colors are passed to the driver with brightness already applied by the core's output LUT
      */
     class Driver {
         public:
         virtual void setup() = 0;
         virtual void setColor(RgbColor color) = 0;
-        virtual void setColor(RgbColor color, uint8_t index, uint8_t length = 1) {
+        virtual void setColor(RgbColor color, uint16_t index, uint16_t length = 1) {
             setColor(color);
         }
-        virtual void setBrightness(uint8_t brightness)  = 0;
         virtual void loop() = 0;
     };
 
@@ -25,7 +37,7 @@ namespace LightWeaver {
         NoopDriver(uint16_t pixelCount) {};
         void setup(){};
         void setColor(RgbColor color) {};
-        void setBrightness(uint8_t brightness) {};
+        void setColor(RgbColor color, uint16_t index, uint16_t length) {};
         void loop(){}
     };
 }
\ No newline at end of file
@@ -0,0 +1,124 @@
+#pragma once
+#include <algorithm>
+#include <type_traits>
+
+#include "Driver.h"
+#include "../Color.h"
+#include "../Features.h"
+
+namespace LightWeaver {
+    /**
+     * One output of a MultiOutputDriver, PIXEL_COUNT pixels driven by T_DRIVER
+     *
+     * PIN is passed to the driver for methods that can send on any pin, such as bit-bang. Outputs
+     * without a PIN are constructed with the pixel count only
+     */
+    template <typename T_DRIVER, uint16_t PIXEL_COUNT, int PIN = -1>
+    struct DriverOutput {
+        typedef T_DRIVER DriverType;
+        static const uint16_t PixelCount = PIXEL_COUNT;
+
+        static T_DRIVER create() {
+            return create(std::integral_constant<bool, (PIN >= 0)>());
+        }
+        private:
+            static T_DRIVER create(std::true_type) {
+                return T_DRIVER(PIXEL_COUNT, PIN);
+            }
+            static T_DRIVER create(std::false_type) {
+                return T_DRIVER(PIXEL_COUNT);
+            }
+    };
+
+    /**
+     * Driver class that splits the strip into contiguous ranges, each shown on its own output
+     *
+     * The first output shows the first pixels of the strip. Outputs can use different methods and
+     * channel orders, e.g.
+     *   MultiOutputDriver<
+     *       DriverOutput<NeoRgbDriver<NeoGrbFeature, NeoEsp8266Dma800KbpsMethod>, 300>,
+     *       DriverOutput<NeoRgbDriver<NeoRgbFeature, NeoEsp8266AsyncUart1800KbpsMethod>, 300>,
+     *       DriverOutput<NeoRgbDriver<NeoGrbFeature, NeoEsp8266BitBang800KbpsMethod>, 300, 5>>
+     *
+     * Outputs that send in the background are shown first, so that they are sending while a
+     * blocking output is. A frame then takes as long as the slowest output rather than all of
+     * them together. The core should be constructed with PixelCount pixels.
+     */
+    template <typename... OUTPUTS>
+    class MultiOutputDriver {
+        public:
+            static const int SupportedFeatures = SupportedFeature::BRIGHTNESS | SupportedFeature::COLOR | SupportedFeature::ANIMATION | SupportedFeature::ADDRESSABLE;
+            static const uint16_t PixelCount = 0;
+
+            MultiOutputDriver(uint16_t) {}
+            void setup() {}
+            void setColor(RgbColor) {}
+            void setColor(RgbColor, uint16_t, uint16_t) {}
+            void loop() {}
+            void update() {}
+
+            void showAsync() {}
+            void showBlocking() {}
+    };
+
+    template <typename OUTPUT, typename... REST>
+    class MultiOutputDriver<OUTPUT, REST...> {
+        private:
+            typedef typename OUTPUT::DriverType T_DRIVER;
+            static const uint16_t OUTPUT_PIXEL_COUNT = OUTPUT::PixelCount;
+
+            T_DRIVER driver;
+            MultiOutputDriver<REST...> rest;
+        public:
+            // Only the features supported by every output
+            static const int SupportedFeatures = T_DRIVER::SupportedFeatures & MultiOutputDriver<REST...>::SupportedFeatures;
+            static const uint16_t PixelCount = OUTPUT_PIXEL_COUNT + MultiOutputDriver<REST...>::PixelCount;
+
+            MultiOutputDriver(uint16_t pixelCount):
+                driver(OUTPUT::create()),
+                rest(pixelCount > OUTPUT_PIXEL_COUNT ? pixelCount - OUTPUT_PIXEL_COUNT : 0) {}
+
+            void setup() {
+                driver.setup();
+                rest.setup();
+            }
+
+            void setColor(RgbColor color) {
+                driver.setColor(color);
+                rest.setColor(color);
+            }
+
+            void setColor(RgbColor color, uint16_t index, uint16_t length) {
+                if (index >= OUTPUT_PIXEL_COUNT) {
+                    rest.setColor(color, index - OUTPUT_PIXEL_COUNT, length);
+                    return;
+                }
+                // A range crossing the end of this output continues at the start of the next one
+                uint16_t outputLength = std::min<uint16_t>(length, OUTPUT_PIXEL_COUNT - index);
+                driver.setColor(color, index, outputLength);
+                if (outputLength < length) {
+                    rest.setColor(color, 0, length - outputLength);
+                }
+            }
+
+            void loop() {
+                showAsync();
+                showBlocking();
+            }
+
+            void update() {
+                updateDriver(driver);
+                rest.update();
+            }
+
+            void showAsync() {
+                if (T_DRIVER::IsAsync) driver.loop();
+                rest.showAsync();
+            }
+
+            void showBlocking() {
+                if (!T_DRIVER::IsAsync) driver.loop();
+                rest.showBlocking();
+            }
+    };
+}
@@ -1,4 +1,5 @@
-#include <NeoPixelBrightnessBus.h>
+#pragma once
+#include <NeoPixelBus.h>
 
 #include "Driver.h"
 #include "../Color.h"
@@ -7,23 +8,37 @@
 namespace LightWeaver {
     /**
      * Driver class for controlling a strip of RGBW SK6182 LEDs using NeoPixelBus
+     *
+     * The part of each color shared by all three channels is moved to the white LED, in the
+     * proportion set by WHITE_EXTRACTION (0 leaves the white LED off, 255 moves all of it)
      */
-    template <int GROUP_SIZE>
+    template <int GROUP_SIZE, uint8_t WHITE_EXTRACTION = 255>
     class NeoDriverSK6812_RGBW : Driver
     {
     private:
-        NeoPixelBrightnessBus<NeoGrbwFeature, NeoEsp8266Dma800KbpsMethod> strip;
+        NeoPixelBus<NeoGrbwFeature, NeoEsp8266Dma800KbpsMethod> strip;
         uint16_t pixelCount;
+
+        ::RgbwColor toRgbw(const RgbColor& color) const {
+            // Never more than the smallest of the three channels, the division by a constant is
+            // folded into a multiply, and away entirely with the default WHITE_EXTRACTION
+            uint8_t white = std::min(color.R, std::min(color.G, color.B)) * WHITE_EXTRACTION / 255;
+            return ::RgbwColor(color.R - white, color.G - white, color.B - white, white);
+        }
     public:
         static const int SupportedFeatures = SupportedFeature::BRIGHTNESS | SupportedFeature::COLOR | SupportedFeature::ANIMATION | SupportedFeature::ADDRESSABLE;
-        NeoDriverSK6812_RGBW(uint16_t pixelCount) : strip(NeoPixelBrightnessBus<NeoGrbwFeature, NeoEsp8266Dma800KbpsMethod>(pixelCount)), pixelCount(pixelCount) {};
+        static const bool IsAsync = IsAsyncMethod<NeoEsp8266Dma800KbpsMethod>::value;
+        NeoDriverSK6812_RGBW(uint16_t pixelCount) : strip(NeoPixelBus<NeoGrbwFeature, NeoEsp8266Dma800KbpsMethod>(pixelCount)), pixelCount(pixelCount) {};
         void setColor(RgbColor color) {
-            for (int i = 0; i < pixelCount; i++) {
-                strip.SetPixelColor(i, ::RgbColor(color.R, color.G, color.B));
-            }
+            strip.ClearTo(toRgbw(color));
         };
-        void setBrightness(uint8_t brightness) {
-            strip.SetBrightness(brightness);
+        void setColor(RgbColor color, uint16_t index, uint16_t length) {
+            ::RgbwColor rgbw = toRgbw(color);
+            if (length == 1) {
+                strip.SetPixelColor(index, rgbw);
+            } else {
+                strip.ClearTo(rgbw, index, index + length - 1);
+            }
         };
         void setup(){
             strip.Begin();
@@ -32,4 +47,4 @@ namespace LightWeaver {
             strip.Show();
         };
     };
-}
\ No newline at end of file
+}
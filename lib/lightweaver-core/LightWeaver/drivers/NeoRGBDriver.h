@@ -1,4 +1,7 @@
-#include <NeoPixelBrightnessBus.h>
+#pragma once
+#include <algorithm>
+#include <memory>
+#include <NeoPixelBus.h>
 
 #include "Driver.h"
 #include "../Color.h"
@@ -7,35 +10,56 @@
 namespace LightWeaver {
     /**
      * Driver class for controlling a strip of RGB LEDs using NeoPixelBus
+     *
+     * Pixels are set in a frame buffer that is only copied to the strip when the frame is shown, so
+     * the next frame can be rendered while the strip is still sending the last one. loop() never
+     * waits for the strip: a frame shown while the strip is busy is sent by update() once it is free,
+     * and replaces any older frame that was still waiting.
      */
     template <typename T_FEATURE, typename T_METHOD, int GROUP_SIZE = 1>
     class NeoRgbDriver : Driver
     {
     private:
-        NeoPixelBrightnessBus<T_FEATURE, T_METHOD> strip;
+        NeoPixelBus<T_FEATURE, T_METHOD> strip;
         uint16_t pixelCount;
+        std::unique_ptr<::RgbColor[]> frame;
+        bool isFramePending = false;
     public:
         static const int SupportedFeatures = SupportedFeature::BRIGHTNESS | SupportedFeature::COLOR | SupportedFeature::ANIMATION | SupportedFeature::ADDRESSABLE;
-        NeoRgbDriver(uint16_t pixelCount) : strip(NeoPixelBrightnessBus<T_FEATURE, T_METHOD>(pixelCount)), pixelCount(pixelCount) {};
+        static const bool IsAsync = IsAsyncMethod<T_METHOD>::value;
+        NeoRgbDriver(uint16_t pixelCount) : strip(NeoPixelBus<T_FEATURE, T_METHOD>(pixelCount)), pixelCount(pixelCount), frame(new ::RgbColor[pixelCount]) {};
+        // The pin is only used by methods that can send on any pin, such as bit-bang
+        NeoRgbDriver(uint16_t pixelCount, uint8_t pin) : strip(NeoPixelBus<T_FEATURE, T_METHOD>(pixelCount, pin)), pixelCount(pixelCount), frame(new ::RgbColor[pixelCount]) {};
         void setColor(RgbColor color) {
-            strip.ClearTo(::RgbColor(color.R, color.G, color.B));
+            std::fill(frame.get(), frame.get() + pixelCount, ::RgbColor(color.R, color.G, color.B));
         };
-        void setColor(RgbColor color, uint8_t index, uint8_t length) {
+        void setColor(RgbColor color, uint16_t index, uint16_t length) {
             ::RgbColor rgb = ::RgbColor(color.R, color.G, color.B);
-            if (length == 1) {
-                strip.SetPixelColor(index, rgb);
-            } else {
-                strip.ClearTo(rgb, index, index + length - 1);
+            uint16_t end = std::min<uint32_t>(index + length, pixelCount);
+            for (uint16_t i = index; i < end; i++) {
+                frame[i] = rgb;
             }
         };
-        void setBrightness(uint8_t brightness) {
-            strip.SetBrightness(brightness);
-        };
         void setup(){
             strip.Begin();
         };
         void loop(){
-            strip.Show();
+            // The strip has its own copy of the pixels being sent, so it can be written while sending
+            for (uint16_t i = 0; i < pixelCount; i++) {
+                strip.SetPixelColor(i, frame[i]);
+            }
+            isFramePending = true;
+            update();
+        };
+        // Sends the frame waiting for the strip, once the strip has finished sending the last one
+        void update(){
+            if (isFramePending && strip.CanShow()) {
+                strip.Show();
+                isFramePending = false;
+            }
+        };
+        bool isShowPending() const {
+            return isFramePending;
         };
     };
-}
\ No newline at end of file
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+namespace LightWeaver {
+    /**
+     * Calls update() on drivers that have one, and does nothing for the others
+     *
+     * Drivers that send frames in the background implement update(), which is called on every loop
+     * so that a frame waiting for the strip is sent as soon as the strip is free
+     */
+    template <typename T_DRIVER>
+    auto updateDriver(T_DRIVER& driver, int) -> decltype(driver.update(), void()) {
+        driver.update();
+    }
+
+    template <typename T_DRIVER>
+    void updateDriver(T_DRIVER& driver, long) {}
+
+    template <typename T_DRIVER>
+    void updateDriver(T_DRIVER& driver) {
+        updateDriver(driver, 0);
+    }
+}
@@ -0,0 +1,321 @@
+#include "ColorSourceCodec.h"
+#include <LightWeaver/colorSources/SolidColorSource.h>
+#include <LightWeaver/colorSources/FadeColorSource.h>
+#include <LightWeaver/colorSources/OverlayColorSource.h>
+#include <LightWeaver/colorSources/GradientColorSource.h>
+#include <LightWeaver/colorSources/HsvMeanderColorSource.h>
+
+namespace LightWeaver {
+    namespace {
+        // Only append to this list, the index of each curve is what is stored
+        const EasingCurve EASING_CURVES[] = {
+            Easing::Linear,
+            Easing::QuadraticIn,
+            Easing::QuadraticOut,
+            Easing::QuadraticInOut,
+            Easing::CubicIn,
+            Easing::CubicOut,
+            Easing::CubicInOut,
+            Easing::QuarticIn,
+            Easing::QuarticOut,
+            Easing::QuarticInOut,
+            Easing::QuinticIn,
+            Easing::QuinticOut,
+            Easing::QuinticInOut,
+            Easing::SinusoidalIn,
+            Easing::SinusoidalOut,
+            Easing::SinusoidalInOut,
+            Easing::ExponentialIn,
+            Easing::ExponentialOut,
+            Easing::ExponentialInOut
+        };
+        const uint8_t EASING_CURVE_COUNT = sizeof(EASING_CURVES) / sizeof(EASING_CURVES[0]);
+    }
+
+    void ColorSourceCodec::Writer::write(const void* data, size_t size) {
+        if (size == 0) return;
+        if (buffer) {
+            if (overflowed || position + size > length) {
+                overflowed = true;
+                return;
+            }
+            memcpy(buffer + position, data, size);
+        }
+        position += size;
+    }
+
+    void ColorSourceCodec::Reader::read(void* data, size_t size) {
+        if (size == 0) return;
+        if (failed || position + size > length) {
+            failed = true;
+            return;
+        }
+        memcpy(data, buffer + position, size);
+        position += size;
+    }
+}
+
+/**
+ * Encoding
+ */
+namespace LightWeaver {
+    void ColorSourceCodec::encodeColor(Writer& writer, const RgbaColor& color) {
+        writer.write(color.R);
+        writer.write(color.G);
+        writer.write(color.B);
+        writer.write(color.A);
+    }
+
+    void ColorSourceCodec::encodeColor(Writer& writer, const HsvaColor& color) {
+        writer.write(color.H);
+        writer.write(color.S);
+        writer.write(color.V);
+        writer.write(color.A);
+    }
+
+    void ColorSourceCodec::encodeEasingFunction(Writer& writer, const EasingFunction& easing) {
+        uint8_t curve = 0;
+        for (uint8_t i = 0; i < EASING_CURVE_COUNT; i++) {
+            if (EASING_CURVES[i] == easing.curve) {
+                curve = i;
+                break;
+            }
+        }
+        writer.write(curve);
+        writer.write(easing.modifiers, sizeof(easing.modifiers));
+    }
+
+    void ColorSourceCodec::encodeGradient(Writer& writer, const Gradient& gradient) {
+        writer.write(gradient.colorSet.size);
+        for (uint8_t i = 0; i < gradient.colorSet.size; i++) {
+            encodeColor(writer, gradient.colorSet.colors[i]);
+            writer.write(gradient.colorPositions[i]);
+        }
+        encodeEasingFunction(writer, gradient.easing);
+    }
+
+    void ColorSourceCodec::encodePixelOffsetConfig(Writer& writer, const PixelOffsetConfig& config) {
+        writer.write(static_cast<uint8_t>(config.getType()));
+        switch (config.getType()) {
+            case PixelOffsetConfig::Type::SCALE:
+                writer.write(config.getScale());
+                break;
+            case PixelOffsetConfig::Type::RANDOM:
+                // Random offsets are reseeded when decoded
+                break;
+            case PixelOffsetConfig::Type::LIST:
+                writer.write(config.getOffsetCount());
+                writer.write(config.getOffsets(), sizeof(float) * config.getOffsetCount());
+                break;
+        }
+    }
+
+    void ColorSourceCodec::encodeColorSource(Writer& writer, const ColorSource& colorSource, uint8_t depth) {
+        if (depth > MAXIMUM_DEPTH) {
+            writer.overflowed = true;
+            return;
+        }
+
+        writer.write(static_cast<uint8_t>(colorSource.getType()));
+        writer.write(colorSource.uid);
+
+        switch (colorSource.getType()) {
+            case ColorSource::Type::Solid: {
+                const SolidColorSource& source = static_cast<const SolidColorSource&>(colorSource);
+                encodeColor(writer, source.getColor());
+                break;
+            }
+            case ColorSource::Type::Fade: {
+                const FadeColorSource& source = static_cast<const FadeColorSource&>(colorSource);
+                encodeColor(writer, source.getStart());
+                encodeColor(writer, source.getEnd());
+                writer.write(source.getDuration());
+                writer.write<uint8_t>(source.isLooping());
+                encodeEasingFunction(writer, source.getEasing());
+                break;
+            }
+            case ColorSource::Type::Overlay: {
+                const OverlayColorSource& source = static_cast<const OverlayColorSource&>(colorSource);
+                encodeColorSource(writer, source.getBackground(), depth + 1);
+                encodeColorSource(writer, source.getOverlay(), depth + 1);
+                break;
+            }
+            case ColorSource::Type::Gradient: {
+                const GradientColorSource& source = static_cast<const GradientColorSource&>(colorSource);
+                encodeGradient(writer, source.getGradient());
+                writer.write(source.getDuration());
+                writer.write<uint8_t>(source.isLooping());
+                encodeEasingFunction(writer, source.getEasing());
+                encodePixelOffsetConfig(writer, source.getPixelOffsets());
+                break;
+            }
+            case ColorSource::Type::HsvMeander: {
+                const HsvMeanderColorSource& source = static_cast<const HsvMeanderColorSource&>(colorSource);
+                encodeColor(writer, source.getBaseColor());
+                writer.write(source.getDuration());
+                writer.write(source.getHueDistance());
+                writer.write(source.getSaturationDistance());
+                writer.write(source.getValueDistance());
+                encodePixelOffsetConfig(writer, source.getPixelOffsets());
+                break;
+            }
+        }
+    }
+
+    size_t ColorSourceCodec::getEncodedSize(const ColorSource& colorSource) {
+        Writer writer{nullptr, 0};
+        writer.write(static_cast<uint8_t>(FORMAT_VERSION));
+        encodeColorSource(writer, colorSource, 0);
+        return writer.overflowed ? 0 : writer.position;
+    }
+
+    size_t ColorSourceCodec::encode(const ColorSource& colorSource, uint8_t* buffer, size_t length) {
+        Writer writer{buffer, length};
+        writer.write(static_cast<uint8_t>(FORMAT_VERSION));
+        encodeColorSource(writer, colorSource, 0);
+        return writer.overflowed ? 0 : writer.position;
+    }
+}
+
+/**
+ * Decoding
+ */
+namespace LightWeaver {
+    RgbaColor ColorSourceCodec::decodeRgbaColor(Reader& reader) {
+        uint8_t r = reader.read<uint8_t>();
+        uint8_t g = reader.read<uint8_t>();
+        uint8_t b = reader.read<uint8_t>();
+        uint8_t a = reader.read<uint8_t>();
+        return RgbaColor(r, g, b, a);
+    }
+
+    HsvaColor ColorSourceCodec::decodeHsvaColor(Reader& reader) {
+        float h = reader.read<float>();
+        float s = reader.read<float>();
+        float v = reader.read<float>();
+        uint8_t a = reader.read<uint8_t>();
+        return HsvaColor(h, s, v, a);
+    }
+
+    EasingFunction ColorSourceCodec::decodeEasingFunction(Reader& reader) {
+        uint8_t curve = reader.read<uint8_t>();
+        EasingFunction easing{curve < EASING_CURVE_COUNT ? EASING_CURVES[curve] : Easing::Linear};
+        reader.read(easing.modifiers, sizeof(easing.modifiers));
+        for (uint8_t i = 0; i < EasingFunction::MAXIMUM_MODIFIERS; i++) {
+            if (easing.modifiers[i] > EasingFunction::Modifier::Mirror) {
+                reader.failed = true;
+            }
+        }
+        return easing;
+    }
+
+    Gradient ColorSourceCodec::decodeGradient(Reader& reader) {
+        const uint8_t size = reader.read<uint8_t>();
+        std::unique_ptr<RgbaColor[]> colors = std::unique_ptr<RgbaColor[]>{new RgbaColor[size]};
+        std::unique_ptr<uint8_t[]> positions = std::unique_ptr<uint8_t[]>{new uint8_t[size]};
+        for (uint8_t i = 0; i < size && !reader.failed; i++) {
+            colors[i] = decodeRgbaColor(reader);
+            positions[i] = reader.read<uint8_t>();
+        }
+        EasingFunction easing = decodeEasingFunction(reader);
+        return Gradient{ColorSet{size, colors.get()}, positions.get(), easing};
+    }
+
+    PixelOffsetConfig ColorSourceCodec::decodePixelOffsetConfig(Reader& reader) {
+        PixelOffsetConfig::Type type = static_cast<PixelOffsetConfig::Type>(reader.read<uint8_t>());
+        switch (type) {
+            case PixelOffsetConfig::Type::SCALE:
+                return PixelOffsetConfig::withScale(reader.read<float>());
+            case PixelOffsetConfig::Type::RANDOM:
+                return PixelOffsetConfig::withRandom();
+            case PixelOffsetConfig::Type::LIST: {
+                const uint16_t count = reader.read<uint16_t>();
+                // Check the length before allocating, so a corrupt count can not exhaust the heap
+                if (reader.failed || reader.position + sizeof(float) * count > reader.length) {
+                    reader.failed = true;
+                    return PixelOffsetConfig::withNone();
+                }
+                std::unique_ptr<float[]> offsets = std::unique_ptr<float[]>{count > 0 ? new float[count] : nullptr};
+                reader.read(offsets.get(), sizeof(float) * count);
+                return PixelOffsetConfig::withList(count, std::move(offsets));
+            }
+        }
+        reader.failed = true;
+        return PixelOffsetConfig::withNone();
+    }
+
+    std::unique_ptr<ColorSource> ColorSourceCodec::decodeColorSource(Reader& reader, uint8_t depth) {
+        if (depth > MAXIMUM_DEPTH) {
+            reader.failed = true;
+            return nullptr;
+        }
+
+        ColorSource::Type type = static_cast<ColorSource::Type>(reader.read<uint8_t>());
+        uint32_t uid = reader.read<uint32_t>();
+        if (reader.failed) return nullptr;
+
+        switch (type) {
+            case ColorSource::Type::Solid: {
+                RgbaColor color = decodeRgbaColor(reader);
+                return reader.failed ? nullptr : std::unique_ptr<ColorSource>{new SolidColorSource(uid, color)};
+            }
+            case ColorSource::Type::Fade: {
+                RgbaColor start = decodeRgbaColor(reader);
+                RgbaColor end = decodeRgbaColor(reader);
+                uint16_t duration = reader.read<uint16_t>();
+                bool loop = reader.read<uint8_t>() != 0;
+                EasingFunction easing = decodeEasingFunction(reader);
+                return reader.failed ? nullptr : std::unique_ptr<ColorSource>{new FadeColorSource(uid, start, end, duration, loop, easing)};
+            }
+            case ColorSource::Type::Overlay: {
+                std::unique_ptr<ColorSource> background = decodeColorSource(reader, depth + 1);
+                std::unique_ptr<ColorSource> overlay = decodeColorSource(reader, depth + 1);
+                if (reader.failed || !background || !overlay) return nullptr;
+                return std::unique_ptr<ColorSource>{new OverlayColorSource(uid, *background, *overlay)};
+            }
+            case ColorSource::Type::Gradient: {
+                Gradient gradient = decodeGradient(reader);
+                uint16_t duration = reader.read<uint16_t>();
+                bool loop = reader.read<uint8_t>() != 0;
+                EasingFunction easing = decodeEasingFunction(reader);
+                PixelOffsetConfig offsets = decodePixelOffsetConfig(reader);
+                return reader.failed ? nullptr : std::unique_ptr<ColorSource>{new GradientColorSource(uid, gradient, duration, loop, easing, offsets)};
+            }
+            case ColorSource::Type::HsvMeander: {
+                HsvaColor color = decodeHsvaColor(reader);
+                uint16_t duration = reader.read<uint16_t>();
+                float hueDistance = reader.read<float>();
+                float saturationDistance = reader.read<float>();
+                float valueDistance = reader.read<float>();
+                PixelOffsetConfig offsets = decodePixelOffsetConfig(reader);
+                return reader.failed ? nullptr : std::unique_ptr<ColorSource>{new HsvMeanderColorSource(uid, color, duration, hueDistance, saturationDistance, valueDistance, offsets)};
+            }
+        }
+
+        reader.failed = true;
+        return nullptr;
+    }
+
+    uint16_t ColorSourceCodec::getChecksum(const uint8_t* data, size_t length) {
+        uint16_t sum1 = 0;
+        uint16_t sum2 = 0;
+        for (size_t i = 0; i < length; i++) {
+            sum1 = (sum1 + data[i]) % 255;
+            sum2 = (sum2 + sum1) % 255;
+        }
+        return (sum2 << 8) | sum1;
+    }
+
+    std::unique_ptr<ColorSource> ColorSourceCodec::decode(const uint8_t* buffer, size_t length) {
+        Reader reader{buffer, length};
+        if (reader.read<uint8_t>() != FORMAT_VERSION) {
+            return nullptr;
+        }
+
+        std::unique_ptr<ColorSource> colorSource = decodeColorSource(reader, 0);
+        if (reader.failed || reader.position != length) {
+            return nullptr;
+        }
+        return colorSource;
+    }
+}
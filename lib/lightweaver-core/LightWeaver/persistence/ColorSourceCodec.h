@@ -0,0 +1,81 @@
+#pragma once
+#include <memory>
+#include <Arduino.h>
+#include <LightWeaver/ColorSource.h>
+#include <LightWeaver/ColorSet.h>
+#include <LightWeaver/Gradient.h>
+#include <LightWeaver/PixelOffsetConfig.h>
+
+namespace LightWeaver {
+    /**
+     * Compact binary encoding of a ColorSource, for storing ColorSources on flash
+     *
+     * Values are written in declaration order with no field names, so decoding is a single pass with
+     * no parsing or validation beyond bounds checks. Easing curves are stored by their index in
+     * EASING_CURVES, so new curves must only ever be appended to it to keep stored data readable.
+     */
+    class ColorSourceCodec {
+        public:
+            // Increment whenever the encoding changes in a way that older data can no longer be decoded
+            static const uint8_t FORMAT_VERSION = 1;
+            static const uint8_t MAXIMUM_DEPTH = 8;
+
+            struct Writer {
+                uint8_t* buffer;
+                size_t length;
+                size_t position = 0;
+                bool overflowed = false;
+
+                // A writer with no buffer only counts the bytes that would be written
+                Writer(uint8_t* buffer, size_t length): buffer(buffer), length(length) {}
+
+                void write(const void* data, size_t size);
+
+                template <typename T>
+                void write(const T& value) {
+                    write(&value, sizeof(T));
+                }
+            };
+
+            struct Reader {
+                const uint8_t* buffer;
+                size_t length;
+                size_t position = 0;
+                bool failed = false;
+
+                Reader(const uint8_t* buffer, size_t length): buffer(buffer), length(length) {}
+
+                void read(void* data, size_t size);
+
+                template <typename T>
+                T read() {
+                    T value{};
+                    read(&value, sizeof(T));
+                    return value;
+                }
+            };
+        private:
+            static void encodeColor(Writer& writer, const RgbaColor& color);
+            static void encodeColor(Writer& writer, const HsvaColor& color);
+            static void encodeEasingFunction(Writer& writer, const EasingFunction& easing);
+            static void encodeGradient(Writer& writer, const Gradient& gradient);
+            static void encodePixelOffsetConfig(Writer& writer, const PixelOffsetConfig& config);
+            static void encodeColorSource(Writer& writer, const ColorSource& colorSource, uint8_t depth);
+
+            static RgbaColor decodeRgbaColor(Reader& reader);
+            static HsvaColor decodeHsvaColor(Reader& reader);
+            static EasingFunction decodeEasingFunction(Reader& reader);
+            static Gradient decodeGradient(Reader& reader);
+            static PixelOffsetConfig decodePixelOffsetConfig(Reader& reader);
+            static std::unique_ptr<ColorSource> decodeColorSource(Reader& reader, uint8_t depth);
+        public:
+            // Returns the number of bytes needed to encode the ColorSource
+            static size_t getEncodedSize(const ColorSource& colorSource);
+            // Returns the number of bytes written, or 0 if the buffer is too small
+            static size_t encode(const ColorSource& colorSource, uint8_t* buffer, size_t length);
+            // Returns nullptr if the data is truncated or not a valid ColorSource
+            static std::unique_ptr<ColorSource> decode(const uint8_t* buffer, size_t length);
+            // Fletcher-16 checksum, enough to detect encoded data that was only partially written to flash
+            static uint16_t getChecksum(const uint8_t* data, size_t length);
+    };
+}
@@ -0,0 +1,94 @@
+#include "PixelMapStore.h"
+#include <LittleFS.h>
+#include "ColorSourceCodec.h"
+
+#define PIXEL_MAP_PATH "/pixelmap"
+#define PIXEL_MAP_TEMP_PATH "/pixelmap.tmp"
+
+namespace LightWeaver {
+    namespace {
+        struct PixelMapHeader {
+            uint32_t magic;
+            uint16_t size;
+            uint16_t checksum;
+        };
+        // length, physicalStart, groupSize and isReversed of each span
+        const size_t ENCODED_SPAN_SIZE = 6;
+    }
+
+    bool PixelMapStore::restore(PixelMap& pixelMap) {
+        File file = LittleFS.open(PIXEL_MAP_PATH, "r");
+        if (!file) {
+            return false;
+        }
+
+        PixelMapHeader header;
+        if (file.read(reinterpret_cast<uint8_t*>(&header), sizeof(header)) != sizeof(header)
+            || header.magic != PIXEL_MAP_MAGIC
+            || header.size == 0
+            || header.size % ENCODED_SPAN_SIZE != 0
+            || header.size > PixelMap::MAXIMUM_SPANS * ENCODED_SPAN_SIZE) {
+            file.close();
+            return false;
+        }
+
+        uint8_t data[PixelMap::MAXIMUM_SPANS * ENCODED_SPAN_SIZE];
+        size_t readSize = file.read(data, header.size);
+        file.close();
+        if (readSize != header.size || ColorSourceCodec::getChecksum(data, header.size) != header.checksum) {
+            return false;
+        }
+
+        uint8_t spanCount = header.size / ENCODED_SPAN_SIZE;
+        PixelSpan spans[PixelMap::MAXIMUM_SPANS];
+        for (uint8_t i = 0; i < spanCount; i++) {
+            const uint8_t* encoded = data + i * ENCODED_SPAN_SIZE;
+            spans[i].length = encoded[0] | (encoded[1] << 8);
+            spans[i].physicalStart = encoded[2] | (encoded[3] << 8);
+            spans[i].groupSize = encoded[4];
+            spans[i].isReversed = encoded[5] != 0;
+        }
+        pixelMap = PixelMap::withSpans(spanCount, spans);
+        return true;
+    }
+
+    bool PixelMapStore::save(const PixelMap& pixelMap) {
+        uint8_t spanCount = pixelMap.getSpanCount();
+        if (spanCount == 0 || spanCount > PixelMap::MAXIMUM_SPANS) {
+            return false;
+        }
+
+        uint8_t data[PixelMap::MAXIMUM_SPANS * ENCODED_SPAN_SIZE];
+        for (uint8_t i = 0; i < spanCount; i++) {
+            const PixelSpan& span = pixelMap.getSpans()[i];
+            uint8_t* encoded = data + i * ENCODED_SPAN_SIZE;
+            encoded[0] = span.length & 0xFF;
+            encoded[1] = span.length >> 8;
+            encoded[2] = span.physicalStart & 0xFF;
+            encoded[3] = span.physicalStart >> 8;
+            encoded[4] = span.groupSize;
+            encoded[5] = span.isReversed ? 1 : 0;
+        }
+        uint16_t size = spanCount * ENCODED_SPAN_SIZE;
+        PixelMapHeader header{PIXEL_MAP_MAGIC, size, ColorSourceCodec::getChecksum(data, size)};
+
+        // Written to a temporary file and renamed, so a power loss while writing keeps the previous map
+        File file = LittleFS.open(PIXEL_MAP_TEMP_PATH, "w");
+        if (!file) {
+            return false;
+        }
+        size_t writtenSize = file.write(reinterpret_cast<const uint8_t*>(&header), sizeof(header));
+        writtenSize += file.write(data, size);
+        file.close();
+
+        if (writtenSize != sizeof(header) + size || !LittleFS.rename(PIXEL_MAP_TEMP_PATH, PIXEL_MAP_PATH)) {
+            LittleFS.remove(PIXEL_MAP_TEMP_PATH);
+            return false;
+        }
+        return true;
+    }
+
+    bool PixelMapStore::remove() {
+        return !LittleFS.exists(PIXEL_MAP_PATH) || LittleFS.remove(PIXEL_MAP_PATH);
+    }
+}
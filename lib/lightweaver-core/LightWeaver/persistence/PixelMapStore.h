@@ -0,0 +1,22 @@
+#pragma once
+#include <Arduino.h>
+#include <LightWeaver/PixelMap.h>
+
+namespace LightWeaver {
+    /**
+     * Persists the pixel map, which describes the installation and so rarely changes
+     *
+     * Maps are written as soon as they are set, since they are not changed in bursts the way scenes are.
+     * LittleFS must already be mounted.
+     */
+    class PixelMapStore {
+        private:
+            static const uint32_t PIXEL_MAP_MAGIC = 0x314D574C; // "LWM1"
+        public:
+            // Returns false if there is no valid pixel map, in which case pixelMap is unchanged
+            static bool restore(PixelMap& pixelMap);
+            static bool save(const PixelMap& pixelMap);
+            // Removes the stored pixel map, so the default map is used after a restart
+            static bool remove();
+    };
+}
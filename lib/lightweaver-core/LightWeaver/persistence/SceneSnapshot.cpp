@@ -0,0 +1,120 @@
+#include "SceneSnapshot.h"
+#include <LittleFS.h>
+#include "ColorSourceCodec.h"
+
+#define SNAPSHOT_PATH "/scene"
+#define SNAPSHOT_TEMP_PATH "/scene.tmp"
+
+namespace LightWeaver {
+    namespace {
+        struct SnapshotHeader {
+            uint32_t magic;
+            uint16_t size;
+            uint16_t checksum;
+        };
+        // Brightness and whether a ColorSource is present, ahead of the encoded ColorSource
+        const size_t SCENE_HEADER_SIZE = 2;
+    }
+
+    bool SceneSnapshot::begin() {
+        isStarted = LittleFS.begin();
+        return isStarted;
+    }
+
+    bool SceneSnapshot::restore(uint8_t& brightness, std::unique_ptr<ColorSource>& colorSource) {
+        if (!isStarted) return false;
+
+        File file = LittleFS.open(SNAPSHOT_PATH, "r");
+        if (!file) {
+            return false;
+        }
+
+        SnapshotHeader header;
+        if (file.read(reinterpret_cast<uint8_t*>(&header), sizeof(header)) != sizeof(header)
+            || header.magic != SNAPSHOT_MAGIC
+            || header.size < SCENE_HEADER_SIZE
+            || header.size > MAXIMUM_SNAPSHOT_SIZE) {
+            file.close();
+            return false;
+        }
+
+        std::unique_ptr<uint8_t[]> data = std::unique_ptr<uint8_t[]>{new uint8_t[header.size]};
+        size_t readSize = file.read(data.get(), header.size);
+        file.close();
+        if (readSize != header.size || ColorSourceCodec::getChecksum(data.get(), header.size) != header.checksum) {
+            return false;
+        }
+
+        std::unique_ptr<ColorSource> restoredColorSource;
+        if (data[1]) {
+            restoredColorSource = ColorSourceCodec::decode(data.get() + SCENE_HEADER_SIZE, header.size - SCENE_HEADER_SIZE);
+            if (!restoredColorSource) {
+                return false;
+            }
+        }
+
+        brightness = data[0];
+        colorSource = std::move(restoredColorSource);
+        savedSize = header.size;
+        savedChecksum = header.checksum;
+        return true;
+    }
+
+    bool SceneSnapshot::write(uint8_t brightness, const ColorSource* colorSource) {
+        size_t colorSourceSize = colorSource ? ColorSourceCodec::getEncodedSize(*colorSource) : 0;
+        size_t size = SCENE_HEADER_SIZE + colorSourceSize;
+        if ((colorSource && colorSourceSize == 0) || size > MAXIMUM_SNAPSHOT_SIZE) {
+            return false;
+        }
+
+        std::unique_ptr<uint8_t[]> data = std::unique_ptr<uint8_t[]>{new uint8_t[size]};
+        data[0] = brightness;
+        data[1] = colorSource ? 1 : 0;
+        if (colorSource && ColorSourceCodec::encode(*colorSource, data.get() + SCENE_HEADER_SIZE, colorSourceSize) != colorSourceSize) {
+            return false;
+        }
+
+        SnapshotHeader header{SNAPSHOT_MAGIC, static_cast<uint16_t>(size), ColorSourceCodec::getChecksum(data.get(), size)};
+        if (header.size == savedSize && header.checksum == savedChecksum) {
+            // The scene changed back to what is already stored
+            return true;
+        }
+
+        // Written to a temporary file and renamed, so a power loss while writing keeps the previous snapshot
+        File file = LittleFS.open(SNAPSHOT_TEMP_PATH, "w");
+        if (!file) {
+            return false;
+        }
+        size_t writtenSize = file.write(reinterpret_cast<const uint8_t*>(&header), sizeof(header));
+        writtenSize += file.write(data.get(), size);
+        file.close();
+
+        if (writtenSize != sizeof(header) + size || !LittleFS.rename(SNAPSHOT_TEMP_PATH, SNAPSHOT_PATH)) {
+            LittleFS.remove(SNAPSHOT_TEMP_PATH);
+            return false;
+        }
+
+        savedSize = header.size;
+        savedChecksum = header.checksum;
+        return true;
+    }
+
+    void SceneSnapshot::onSceneChanged() {
+        hasPendingChange = true;
+        lastChangeTime = millis();
+    }
+
+    void SceneSnapshot::loop(uint8_t brightness, const ColorSource* colorSource) {
+        if (!isStarted || !hasPendingChange) return;
+
+        uint32_t now = millis();
+        if (now - lastChangeTime < DEBOUNCE_INTERVAL) return;
+        if (hasWritten && now - lastWriteTime < MINIMUM_WRITE_INTERVAL) return;
+
+        // A failed write is not retried until the next scene change, rather than retrying every frame
+        hasPendingChange = false;
+        hasWritten = true;
+        lastWriteTime = now;
+        write(brightness, colorSource);
+    }
+}
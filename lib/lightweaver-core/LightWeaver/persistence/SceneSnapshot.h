@@ -0,0 +1,44 @@
+#pragma once
+#include <memory>
+#include <Arduino.h>
+#include <LightWeaver/ColorSource.h>
+
+namespace LightWeaver {
+    /**
+     * Persists the brightness and ColorSource last displayed, so the scene can be restored
+     * immediately on boot without waiting for the network
+     *
+     * Scene changes are debounced, so a burst of changes (e.g. dragging a brightness slider)
+     * results in a single write once the scene settles. Writes are also rate limited and skipped
+     * entirely when the encoded scene matches what is already on flash, to limit flash wear.
+     */
+    class SceneSnapshot {
+        public:
+            static const uint32_t DEBOUNCE_INTERVAL = 2000;
+            static const uint32_t MINIMUM_WRITE_INTERVAL = 30000;
+            static const uint16_t MAXIMUM_SNAPSHOT_SIZE = 4096;
+        private:
+            static const uint32_t SNAPSHOT_MAGIC = 0x3153574C; // "LWS1"
+
+            bool isStarted = false;
+            bool hasPendingChange = false;
+            uint32_t lastChangeTime = 0;
+            bool hasWritten = false;
+            uint32_t lastWriteTime = 0;
+            uint16_t savedChecksum = 0;
+            uint16_t savedSize = 0;
+
+            bool write(uint8_t brightness, const ColorSource* colorSource);
+        public:
+            bool begin();
+
+            // Returns false if there is no valid snapshot, in which case the arguments are unchanged
+            bool restore(uint8_t& brightness, std::unique_ptr<ColorSource>& colorSource);
+
+            // Called whenever the displayed scene changes
+            void onSceneChanged();
+
+            // Writes the scene if a change is pending and both the debounce and rate limit have elapsed
+            void loop(uint8_t brightness, const ColorSource* colorSource);
+    };
+}
@@ -0,0 +1,136 @@
+#include "AllocationAudit.h"
+#include <new>
+
+namespace LightWeaver {
+    AllocationCounts AllocationAudit::counts;
+    AllocationAudit::Site AllocationAudit::sites[MAXIMUM_SITES];
+    uint8_t AllocationAudit::siteCount = 0;
+
+    void AllocationAudit::recordAllocation(size_t size) {
+        counts.allocations++;
+        counts.bytes += size;
+    }
+
+    void AllocationAudit::recordFree() {
+        counts.frees++;
+    }
+
+    const AllocationCounts& AllocationAudit::getCounts() {
+        return counts;
+    }
+
+    AllocationAudit::Site* AllocationAudit::getSite(const char* name) {
+        for (uint8_t i = 0; i < siteCount; i++) {
+            if (strcmp(sites[i].name, name) == 0) {
+                return &sites[i];
+            }
+        }
+        if (siteCount == MAXIMUM_SITES) {
+            return nullptr;
+        }
+        Site& site = sites[siteCount++];
+        site = Site();
+        site.name = name;
+        return &site;
+    }
+
+    uint8_t AllocationAudit::getSiteCount() {
+        return siteCount;
+    }
+
+    const AllocationAudit::Site& AllocationAudit::getSite(uint8_t index) {
+        return sites[index];
+    }
+
+    void AllocationAudit::reset() {
+        counts = AllocationCounts();
+        for (uint8_t i = 0; i < siteCount; i++) {
+            const char* name = sites[i].name;
+            sites[i] = Site();
+            sites[i].name = name;
+        }
+    }
+
+    AllocationScope::AllocationScope(AllocationAudit::Site* site):
+        site(site),
+        start(AllocationAudit::getCounts()) {}
+
+    AllocationScope::~AllocationScope() {
+        if (!site) return;
+        const AllocationCounts& end = AllocationAudit::getCounts();
+        site->calls++;
+        site->last.allocations = end.allocations - start.allocations;
+        site->last.frees = end.frees - start.frees;
+        site->last.bytes = end.bytes - start.bytes;
+        site->total.allocations += site->last.allocations;
+        site->total.frees += site->last.frees;
+        site->total.bytes += site->last.bytes;
+        site->maximumAllocations = std::max(site->maximumAllocations, site->last.allocations);
+    }
+}
+
+#ifdef LIGHTWEAVER_ALLOCATION_AUDIT
+using LightWeaver::AllocationAudit;
+
+extern "C" {
+    void* __real_malloc(size_t size);
+    void* __real_calloc(size_t count, size_t size);
+    void* __real_realloc(void* ptr, size_t size);
+    void __real_free(void* ptr);
+
+    void* __wrap_malloc(size_t size) {
+        void* result = __real_malloc(size);
+        if (result) AllocationAudit::recordAllocation(size);
+        return result;
+    }
+
+    void* __wrap_calloc(size_t count, size_t size) {
+        void* result = __real_calloc(count, size);
+        if (result) AllocationAudit::recordAllocation(count * size);
+        return result;
+    }
+
+    // Counted as a new allocation and a free, since the block may have moved
+    void* __wrap_realloc(void* ptr, size_t size) {
+        void* result = __real_realloc(ptr, size);
+        if (result && size > 0) AllocationAudit::recordAllocation(size);
+        if (ptr && (result || size == 0)) AllocationAudit::recordFree();
+        return result;
+    }
+
+    void __wrap_free(void* ptr) {
+        if (ptr) AllocationAudit::recordFree();
+        __real_free(ptr);
+    }
+}
+
+#ifndef ARDUINO
+// On the host the C++ runtime is linked dynamically, so its operator new never reaches the wrapped
+// malloc. Replacing it here routes every new through malloc, as the ESP8266 core already does
+void* operator new(size_t size) {
+    void* result = malloc(size);
+    if (!result) throw std::bad_alloc();
+    return result;
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    free(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept {
+    free(ptr);
+}
+#endif
+#endif
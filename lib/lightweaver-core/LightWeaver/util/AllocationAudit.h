@@ -0,0 +1,72 @@
+#pragma once
+#include <Arduino.h>
+
+namespace LightWeaver {
+    struct AllocationCounts {
+        uint32_t allocations = 0;
+        uint32_t frees = 0;
+        uint32_t bytes = 0;
+    };
+
+    /**
+     * Counts heap allocations in builds with LIGHTWEAVER_ALLOCATION_AUDIT defined, and attributes them
+     * to the named call sites that were running when they were made
+     *
+     * Allocations are only seen if malloc and free are wrapped by the linker, by building with
+     *   -D LIGHTWEAVER_ALLOCATION_AUDIT -Wl,--wrap=malloc -Wl,--wrap=calloc -Wl,--wrap=realloc -Wl,--wrap=free
+     *
+     * Sites are nested, so the counts of a site include those of any sites called from it.
+     * Allocations made outside every site, e.g. by the WiFi stack, are only included in the total.
+     */
+    class AllocationAudit {
+        public:
+            static const uint8_t MAXIMUM_SITES = 16;
+
+            struct Site {
+                const char* name;
+                uint32_t calls;
+                AllocationCounts total;
+                // Counts from the latest call only
+                AllocationCounts last;
+                // Most allocations made by a single call
+                uint32_t maximumAllocations;
+            };
+        private:
+            static AllocationCounts counts;
+            static Site sites[MAXIMUM_SITES];
+            static uint8_t siteCount;
+        public:
+            static void recordAllocation(size_t size);
+            static void recordFree();
+
+            static const AllocationCounts& getCounts();
+
+            // Returns the site with the given name, adding it if it does not exist yet
+            // Returns nullptr if there is no space left for another site
+            static Site* getSite(const char* name);
+            static uint8_t getSiteCount();
+            static const Site& getSite(uint8_t index);
+
+            // Clears all counts, sites stay registered
+            static void reset();
+    };
+
+    // Attributes the allocations made during its lifetime to a site
+    class AllocationScope {
+        private:
+            AllocationAudit::Site* site;
+            AllocationCounts start;
+        public:
+            AllocationScope(AllocationAudit::Site* site);
+            ~AllocationScope();
+    };
+}
+
+// Attributes allocations to the named site until the end of the enclosing block
+#ifdef LIGHTWEAVER_ALLOCATION_AUDIT
+#define AUDIT_ALLOCATIONS(name) \
+    static LightWeaver::AllocationAudit::Site* const allocationSite = LightWeaver::AllocationAudit::getSite(name); \
+    LightWeaver::AllocationScope allocationScope(allocationSite)
+#else
+#define AUDIT_ALLOCATIONS(name)
+#endif
@@ -0,0 +1,46 @@
+#include "Trace.h"
+
+#if LIGHTWEAVER_TRACE_SIZE > 0
+namespace LightWeaver {
+    Trace::Record Trace::records[SIZE];
+    uint16_t Trace::next = 0;
+    uint32_t Trace::recordedCount = 0;
+
+    size_t Trace::getDumpSize() {
+        return sizeof(Header) + std::min<uint32_t>(recordedCount, SIZE) * sizeof(Record);
+    }
+
+    size_t Trace::dump(uint8_t* buffer, size_t size) {
+        size_t dumpSize = getDumpSize();
+        if (size < dumpSize) {
+            return 0;
+        }
+
+        Header header;
+        header.magic = MAGIC;
+#ifdef ARDUINO
+        header.frequency = ESP.getCpuFreqMHz() * 1000000;
+#else
+        header.frequency = 1000000;
+#endif
+        header.timestamp = getTimestamp();
+        header.recordCount = std::min<uint32_t>(recordedCount, SIZE);
+        header.droppedCount = recordedCount - header.recordCount;
+        memcpy(buffer, &header, sizeof(Header));
+
+        // Once the buffer has wrapped, the oldest record is the next one to be overwritten
+        uint16_t oldest = recordedCount > SIZE ? next : 0;
+        uint8_t* output = buffer + sizeof(Header);
+        for (uint32_t i = 0; i < header.recordCount; i++) {
+            memcpy(output, &records[(oldest + i) % SIZE], sizeof(Record));
+            output += sizeof(Record);
+        }
+        return dumpSize;
+    }
+
+    void Trace::clear() {
+        next = 0;
+        recordedCount = 0;
+    }
+}
+#endif
@@ -0,0 +1,94 @@
+#pragma once
+#include <Arduino.h>
+
+// Number of records kept in the trace, 8 bytes each. Define as 0 to compile tracing out
+#ifndef LIGHTWEAVER_TRACE_SIZE
+#define LIGHTWEAVER_TRACE_SIZE 128
+#endif
+
+namespace LightWeaver {
+    // Values are part of the dump format read by tools/trace2chrome.py
+    enum class TraceEvent : uint8_t {
+        Frame = 0,
+        Render = 1,
+        Show = 2,
+        AnimationStarted = 3,
+        AnimationStopped = 4,
+        HttpCommand = 5,
+        WifiConnected = 6,
+        WifiDisconnected = 7,
+        WifiIPChanged = 8
+    };
+
+    enum class TracePhase : uint8_t {
+        Instant = 0,
+        Begin = 1,
+        End = 2
+    };
+
+#if LIGHTWEAVER_TRACE_SIZE > 0
+    /**
+     * Records recent frame and network events in a RAM ring buffer, for finding what caused a stutter
+     *
+     * Records are stamped with ESP.getCycleCount(), or micros() on the host. The dump is the header
+     * followed by the records from oldest to newest, and is converted to the Chrome trace format by
+     * tools/trace2chrome.py
+     */
+    class Trace {
+        public:
+            static const uint16_t SIZE = LIGHTWEAVER_TRACE_SIZE;
+            static const uint32_t MAGIC = 0x3154574C; // "LWT1"
+
+            struct Record {
+                uint32_t timestamp;
+                TraceEvent event;
+                TracePhase phase;
+                uint16_t arg;
+            };
+
+            struct Header {
+                uint32_t magic;
+                // Timestamp ticks per second
+                uint32_t frequency;
+                // Timestamp when the dump was taken, the cycle count wraps so records are only relative to this
+                uint32_t timestamp;
+                uint32_t recordCount;
+                // Records overwritten since the trace was cleared
+                uint32_t droppedCount;
+            };
+        private:
+            static Record records[SIZE];
+            static uint16_t next;
+            static uint32_t recordedCount;
+        public:
+            static uint32_t getTimestamp() {
+#ifdef ARDUINO
+                return ESP.getCycleCount();
+#else
+                return micros();
+#endif
+            }
+
+            static void record(TraceEvent event, TracePhase phase, uint16_t arg) {
+                Record& record = records[next];
+                record.timestamp = getTimestamp();
+                record.event = event;
+                record.phase = phase;
+                record.arg = arg;
+                next = (next + 1) % SIZE;
+                recordedCount++;
+            }
+
+            static size_t getDumpSize();
+            // Writes the dump to buffer, returns the number of bytes written or 0 if buffer is too small
+            static size_t dump(uint8_t* buffer, size_t size);
+            static void clear();
+    };
+#endif
+}
+
+#if LIGHTWEAVER_TRACE_SIZE > 0
+#define TRACE_EVENT(event, phase, arg) LightWeaver::Trace::record(event, phase, (uint16_t)(arg))
+#else
+#define TRACE_EVENT(event, phase, arg) ((void)0)
+#endif
@@ -1,5 +1,6 @@
 #pragma once
 #include <Arduino.h>
+#include <vector>
 #include <AsyncJson.h>
 #include <ArduinoJson.h>
 #include <ESP8266WiFi.h>
@@ -8,18 +9,47 @@
 
 #include <LightWeaver/colorSources/SolidColorSource.h>
 #include <LightWeaver/LightWeaverWebPlugin.h>
+#include <LightWeaver/util/AllocationAudit.h>
+#include <LightWeaver/util/Trace.h>
+#include <LightWeaverPresets.h>
 
+#include "internal/AsyncStreamingJsonWebHandler.h"
+#include "internal/BatchDeserializer.h"
 #include "internal/ColorSourceDeserializer.h"
+#include "internal/ColorSourcePatcher.h"
+#include "internal/ColorSourceSerializer.h"
+#include "internal/PixelMapDeserializer.h"
+#include "internal/PixelMapSerializer.h"
 
 #define JSON_DOC_SIZE 2048U
+#define MAXIMUM_COLOR_SOURCE_DOC_SIZE 8192U
+#define PIXEL_MAP_DOC_SIZE (JSON_OBJECT_SIZE(1) + JSON_ARRAY_SIZE(PixelMap::MAXIMUM_SPANS) + PixelMap::MAXIMUM_SPANS * JSON_OBJECT_SIZE(4))
 
 namespace LightWeaver {
     class LightWeaverHttpServer : public LightWeaverWebPlugin {
         public:
-            static const String type;
             static const String apiVersion;
             static const String rootPath;
             static const uint16_t port = 80;
+
+            // Identifies commands in the trace, values are part of the dump format read by tools/trace2chrome.py
+            enum class Command : uint16_t {
+                SetColorSource = 0,
+                PatchColorSource = 1,
+                ClearColorSource = 2,
+                SetBrightness = 3,
+                Batch = 4,
+                SavePreset = 5,
+                RecallPreset = 6,
+                RemovePreset = 7,
+                SetPixelMap = 8,
+                SetCalibration = 9,
+                SetSegment = 10,
+                RemoveSegment = 11,
+                SetSegmentColorSource = 12,
+                ClearSegmentColorSource = 13,
+                SetSegmentBrightness = 14
+            };
         private:
             AsyncWebServer server{80};
             bool isServerStarted = false;
@@ -27,6 +57,107 @@ namespace LightWeaver {
                 server.begin();
                 isServerStarted = true;
             }
+
+            // Only the ETag of the state is kept, the body is serialized again for each request that needs it.
+            // The ETag also includes a value chosen at boot, since the scene version restarts from zero after a reset
+            const uint32_t bootNonce = RANDOM_REG32;
+
+            String getStateETag(uint32_t version) {
+                return "\"" + String(bootNonce, HEX) + "-" + String(version) + "\"";
+            }
+
+            bool serializeColorSource(const ColorSource* colorSource, Print& output) {
+                if (!colorSource) {
+                    output.print("null");
+                    return true;
+                }
+                // Offset lists can make a ColorSource much larger than usual, so the document grows until it fits
+                for (size_t capacity = JSON_DOC_SIZE; capacity <= MAXIMUM_COLOR_SOURCE_DOC_SIZE; capacity *= 2) {
+                    DynamicJsonDocument doc(capacity);
+                    ColorSourceSerializer::serialize(*colorSource, doc.to<JsonObject>());
+                    if (!doc.overflowed()) {
+                        serializeJson(doc, output);
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            // Writes the state one ColorSource at a time, so that only one of them is ever held in a document
+            bool serializeState(Print& output) {
+                output.print("{\"brightness\":");
+                output.print(lightWeaver->getBrightness());
+                output.print(",\"colorSource\":");
+                if (!serializeColorSource(lightWeaver->getColorSource(), output)) {
+                    return false;
+                }
+
+                output.print(",\"segments\":[");
+                for (uint8_t i = 0; i < lightWeaver->getSegmentCount(); i++) {
+                    SegmentInfo segment = lightWeaver->getSegment(i);
+                    if (i > 0) {
+                        output.print(",");
+                    }
+                    output.print("{\"id\":");
+                    output.print(segment.id);
+                    output.print(",\"start\":");
+                    output.print(segment.start);
+                    output.print(",\"length\":");
+                    output.print(segment.length);
+                    output.print(",\"brightness\":");
+                    output.print(segment.brightness);
+                    output.print(",\"colorSource\":");
+                    if (!serializeColorSource(segment.colorSource, output)) {
+                        return false;
+                    }
+                    output.print("}");
+                }
+                output.print("]}");
+                return true;
+            }
+
+            LightWeaverPresets* getPresets() {
+                return lightWeaver->getPlugin<LightWeaverPresets>();
+            }
+
+            void sendPresetList(AsyncWebServerRequest* request, const PresetStore& store) {
+                DynamicJsonDocument doc(JSON_DOC_SIZE);
+                JsonArray presets = doc.createNestedArray("presets");
+                for (uint8_t i = 0; i < store.getPresetCount(); i++) {
+                    const PresetInfo& preset = store.getPresetAt(i);
+                    JsonObject presetObj = presets.createNestedObject();
+                    presetObj["id"] = preset.id;
+                    presetObj["name"] = (const char*) preset.name;
+                    presetObj["size"] = preset.size;
+                }
+
+                String output;
+                serializeJson(doc, output);
+                request->send(200, "text/json", output);
+            }
+
+            void sendState(AsyncWebServerRequest* request) {
+                uint32_t version = lightWeaver->getSceneVersion();
+                String eTag = getStateETag(version);
+
+                if (request->hasHeader("If-None-Match") && request->header("If-None-Match") == eTag) {
+                    AsyncWebServerResponse* response = request->beginResponse(304);
+                    response->addHeader("ETag", eTag);
+                    request->send(response);
+                    return;
+                }
+
+                // The response is only sent once the whole state has been written to it
+                AsyncResponseStream* response = request->beginResponseStream("text/json");
+                if (!serializeState(*response)) {
+                    delete response;
+                    request->send(507,"text/json","{\"error\":\"State is too large to serialize\"}");
+                    return;
+                }
+                response->addHeader("ETag", eTag);
+                response->addHeader("Cache-Control", "no-cache");
+                request->send(response);
+            }
         public:
             LightWeaverHttpServer(LightWeaverCore& lightWeaver): LightWeaverWebPlugin(lightWeaver) {
             }
@@ -39,25 +170,122 @@ namespace LightWeaver {
                     request->send(200,"text/html","OK");
                 });
 
-                server.addHandler(new AsyncCallbackJsonWebHandler((rootPath + "/setColorSource").c_str(), [this](AsyncWebServerRequest *request, JsonVariant &json) {
-                    ColorSourceDeserializer::Result result = ColorSourceDeserializer::deserialize(json);
-                    
+                server.on((rootPath + "/state").c_str(), HTTP_GET, [this](AsyncWebServerRequest* request) {
+                    sendState(request);
+                });
+
+                server.on((rootPath + "/metrics").c_str(), HTTP_GET, [this](AsyncWebServerRequest* request) {
+                    const BootMetrics& metrics = lightWeaver->getBootMetrics();
+                    DynamicJsonDocument doc(JSON_OBJECT_SIZE(4));
+                    doc["firstFrameTime"] = metrics.firstFrameTime;
+                    doc["restoreDuration"] = metrics.restoreDuration;
+                    doc["isSceneRestored"] = metrics.isSceneRestored;
+                    doc["uptime"] = millis();
+
+                    String output;
+                    serializeJson(doc, output);
+                    request->send(200, "text/json", output);
+                });
+
+                server.on((rootPath + "/quality").c_str(), HTTP_GET, [this](AsyncWebServerRequest* request) {
+                    const QualityGovernor& governor = lightWeaver->getQualityGovernor();
+                    DynamicJsonDocument doc(JSON_OBJECT_SIZE(5));
+                    doc["level"] = QualityGovernor::getLevelName(governor.getLevel());
+                    doc["frameInterval"] = governor.getFrameInterval();
+                    doc["pixelStride"] = governor.getPixelStride();
+                    doc["frameTime"] = governor.getLastFrameTime();
+                    doc["averageFrameTime"] = governor.getAverageFrameTime();
+
+                    String output;
+                    serializeJson(doc, output);
+                    request->send(200, "text/json", output);
+                });
+
+#if LIGHTWEAVER_TRACE_SIZE > 0
+                server.on((rootPath + "/trace").c_str(), HTTP_GET, [](AsyncWebServerRequest* request) {
+                    // The trace is copied up front, since it keeps changing while the response is sent
+                    std::shared_ptr<std::vector<uint8_t>> dump = std::make_shared<std::vector<uint8_t>>(Trace::getDumpSize());
+                    Trace::dump(dump->data(), dump->size());
+                    AsyncWebServerResponse* response = request->beginResponse("application/octet-stream", dump->size(), [dump](uint8_t* buffer, size_t maxLength, size_t index) -> size_t {
+                        size_t length = std::min(maxLength, dump->size() - index);
+                        memcpy(buffer, dump->data() + index, length);
+                        return length;
+                    });
+                    response->addHeader("Content-Disposition", "attachment; filename=\"trace.bin\"");
+                    request->send(response);
+                });
+#endif
+
+#ifdef LIGHTWEAVER_ALLOCATION_AUDIT
+                server.on((rootPath + "/allocations").c_str(), HTTP_GET, [](AsyncWebServerRequest* request) {
+                    uint8_t siteCount = AllocationAudit::getSiteCount();
+                    DynamicJsonDocument doc(JSON_OBJECT_SIZE(4) + JSON_ARRAY_SIZE(siteCount) + siteCount * JSON_OBJECT_SIZE(7));
+                    const AllocationCounts& counts = AllocationAudit::getCounts();
+                    doc["allocations"] = counts.allocations;
+                    doc["frees"] = counts.frees;
+                    doc["bytes"] = counts.bytes;
+
+                    JsonArray sites = doc.createNestedArray("sites");
+                    for (uint8_t i = 0; i < siteCount; i++) {
+                        const AllocationAudit::Site& site = AllocationAudit::getSite(i);
+                        JsonObject siteObj = sites.createNestedObject();
+                        siteObj["name"] = site.name;
+                        siteObj["calls"] = site.calls;
+                        siteObj["allocations"] = site.total.allocations;
+                        siteObj["frees"] = site.total.frees;
+                        siteObj["bytes"] = site.total.bytes;
+                        siteObj["lastAllocations"] = site.last.allocations;
+                        siteObj["maximumAllocations"] = site.maximumAllocations;
+                    }
+
+                    String output;
+                    serializeJson(doc, output);
+                    request->send(200, "text/json", output);
+                });
+#endif
+
+                // ColorSources are deserialized as the body is received, since gradients and
+                // pixel offset lists can be far larger than JSON_DOC_SIZE
+                server.addHandler(new AsyncColorSourceWebHandler(rootPath + "/setColorSource", [this](AsyncWebServerRequest *request, ColorSourceDeserializer::Result& result) {
+                    TRACE_EVENT(TraceEvent::HttpCommand, TracePhase::Instant, Command::SetColorSource);
                     if (!result) {
                         request->send(422,"text/json","{\"error\":\"" + result.error + "\"}");
                     } else {
                         if (result.value) {
-                            lightWeaver->setColorSource(*(result.value));
+                            lightWeaver->setColorSource(std::move(result.value));
                         }
                         request->send(204);
                     }
+                }));
+
+                // Changes parameters of the current ColorSource in place, without restarting its animation
+                server.addHandler(new AsyncCallbackJsonWebHandler((rootPath + "/patchColorSource").c_str(), [this](AsyncWebServerRequest *request, JsonVariant &json) {
+                    TRACE_EVENT(TraceEvent::HttpCommand, TracePhase::Instant, Command::PatchColorSource);
+                    const ColorSource* current = lightWeaver->getColorSource();
+                    JsonVariant uid = json["uid"];
+                    if (!current || (!uid.isNull() && uid != current->uid)) {
+                        request->send(409,"text/json","{\"error\":\"ColorSource does not match the current ColorSource\"}");
+                        return;
+                    }
+
+                    ColorSourcePatcher::Result result = ColorSourcePatcher::patch(json, *current);
+                    if (!result) {
+                        request->send(422,"text/json","{\"error\":\"" + result.error + "\"}");
+                    } else if (!lightWeaver->patchColorSource(*(result.value))) {
+                        request->send(409,"text/json","{\"error\":\"ColorSource does not match the current ColorSource\"}");
+                    } else {
+                        request->send(204);
+                    }
                 }, JSON_DOC_SIZE));
 
                 server.on((rootPath + "/clearColorSource").c_str(), [this](AsyncWebServerRequest* request) {
+                    TRACE_EVENT(TraceEvent::HttpCommand, TracePhase::Instant, Command::ClearColorSource);
                     lightWeaver->clearColorSource();
                     request->send(204);
                 });
 
                  server.addHandler(new AsyncCallbackJsonWebHandler((rootPath + "/setBrightness").c_str(), [this](AsyncWebServerRequest *request, JsonVariant &json) {
+                    TRACE_EVENT(TraceEvent::HttpCommand, TracePhase::Instant, Command::SetBrightness);
                     JsonVariant brightness = json["brightness"];
                     if (brightness.isNull()) {
                         request->send(422,"text/json","{\"error\":\"Required fields missing: brightness\"}");
@@ -71,6 +299,220 @@ namespace LightWeaver {
 
                 
 
+                // Applies an ordered list of operations together on the next frame, with a single transition
+                // The body is deserialized as it is received, like /setColorSource
+                server.addHandler(new AsyncBatchWebHandler(rootPath + "/batch", [this](AsyncWebServerRequest *request, BatchDeserializer::Result& result) {
+                    TRACE_EVENT(TraceEvent::HttpCommand, TracePhase::Instant, Command::Batch);
+                    if (!result) {
+                        request->send(422,"text/json","{\"error\":\"" + result.error + "\"}");
+                    } else {
+                        lightWeaver->beginTransaction();
+                        for (uint8_t i = 0; i < result.count; i++) {
+                            result.operations[i].apply(*lightWeaver);
+                        }
+                        lightWeaver->commitTransaction();
+                        request->send(204);
+                    }
+                }));
+
+                server.on((rootPath + "/pixelMap").c_str(), HTTP_GET, [this](AsyncWebServerRequest* request) {
+                    const PixelMap& pixelMap = lightWeaver->getPixelMap();
+                    DynamicJsonDocument doc(PIXEL_MAP_DOC_SIZE);
+                    PixelMapSerializer::serialize(pixelMap, doc.to<JsonObject>());
+
+                    String output;
+                    serializeJson(doc, output);
+                    request->send(200, "text/json", output);
+                });
+
+                // Sets how pixels are laid out on the strip, an empty list of spans restores the default layout
+                server.addHandler(new AsyncCallbackJsonWebHandler((rootPath + "/setPixelMap").c_str(), [this](AsyncWebServerRequest *request, JsonVariant &json) {
+                    TRACE_EVENT(TraceEvent::HttpCommand, TracePhase::Instant, Command::SetPixelMap);
+                    PixelMapDeserializer::Result result = PixelMapDeserializer::deserialize(json);
+                    if (!result) {
+                        request->send(422,"text/json","{\"error\":\"" + result.error + "\"}");
+                    } else if (!result.value) {
+                        lightWeaver->resetPixelMap();
+                        request->send(204);
+                    } else if (!lightWeaver->setPixelMap(*(result.value))) {
+                        request->send(422,"text/json","{\"error\":\"Pixel map does not fit the strip\"}");
+                    } else {
+                        request->send(204);
+                    }
+                }, PIXEL_MAP_DOC_SIZE + JSON_DOC_SIZE));
+
+                server.on((rootPath + "/calibration").c_str(), HTTP_GET, [this](AsyncWebServerRequest* request) {
+                    const ColorCalibration& calibration = lightWeaver->getColorCalibration();
+                    DynamicJsonDocument doc(JSON_OBJECT_SIZE(2) + JSON_OBJECT_SIZE(3));
+                    doc["gamma"] = calibration.gamma;
+                    JsonObject whiteBalance = doc.createNestedObject("whiteBalance");
+                    whiteBalance["red"] = calibration.whiteBalance.R;
+                    whiteBalance["green"] = calibration.whiteBalance.G;
+                    whiteBalance["blue"] = calibration.whiteBalance.B;
+
+                    String output;
+                    serializeJson(doc, output);
+                    request->send(200, "text/json", output);
+                });
+
+                // Changes the gamma and white balance of the output, fields that are not given are unchanged
+                server.addHandler(new AsyncCallbackJsonWebHandler((rootPath + "/setCalibration").c_str(), [this](AsyncWebServerRequest *request, JsonVariant &json) {
+                    TRACE_EVENT(TraceEvent::HttpCommand, TracePhase::Instant, Command::SetCalibration);
+                    ColorCalibration calibration = lightWeaver->getColorCalibration();
+                    JsonVariant gamma = json["gamma"];
+                    JsonVariant whiteBalance = json["whiteBalance"];
+                    if (!gamma.isNull()) {
+                        if (!gamma.is<float>() || gamma.as<float>() < OutputLut::MINIMUM_GAMMA || gamma.as<float>() > OutputLut::MAXIMUM_GAMMA) {
+                            request->send(422,"text/json","{\"error\":\"Invalid value for fields: gamma\"}");
+                            return;
+                        }
+                        calibration.gamma = gamma.as<float>();
+                    }
+                    if (!whiteBalance.isNull()) {
+                        JsonVariant red = whiteBalance["red"];
+                        JsonVariant green = whiteBalance["green"];
+                        JsonVariant blue = whiteBalance["blue"];
+                        if (!red.is<uint8_t>() || !green.is<uint8_t>() || !blue.is<uint8_t>()) {
+                            request->send(422,"text/json","{\"error\":\"Invalid value for fields: whiteBalance\"}");
+                            return;
+                        }
+                        calibration.whiteBalance = RgbColor(red.as<uint8_t>(), green.as<uint8_t>(), blue.as<uint8_t>());
+                    }
+                    lightWeaver->setColorCalibration(calibration);
+                    request->send(204);
+                }, JSON_DOC_SIZE));
+
+                // Adds a segment, or moves the segment with the same id
+                server.addHandler(new AsyncCallbackJsonWebHandler((rootPath + "/segments/set").c_str(), [this](AsyncWebServerRequest *request, JsonVariant &json) {
+                    TRACE_EVENT(TraceEvent::HttpCommand, TracePhase::Instant, Command::SetSegment);
+                    JsonVariant id = json["id"];
+                    JsonVariant start = json["start"];
+                    JsonVariant length = json["length"];
+                    if (id.isNull() || start.isNull() || length.isNull()) {
+                        request->send(422,"text/json","{\"error\":\"Required fields missing: id, start, length\"}");
+                    } else if (!id.is<uint8_t>() || !start.is<uint16_t>() || !length.is<uint16_t>()) {
+                        request->send(422,"text/json","{\"error\":\"Invalid value for fields: id, start, length\"}");
+                    } else if (!lightWeaver->setSegment(id.as<uint8_t>(), start.as<uint16_t>(), length.as<uint16_t>())) {
+                        request->send(409,"text/json","{\"error\":\"Segment does not fit the strip\"}");
+                    } else {
+                        request->send(204);
+                    }
+                }, JSON_DOC_SIZE));
+
+                server.addHandler(new AsyncCallbackJsonWebHandler((rootPath + "/segments/remove").c_str(), [this](AsyncWebServerRequest *request, JsonVariant &json) {
+                    TRACE_EVENT(TraceEvent::HttpCommand, TracePhase::Instant, Command::RemoveSegment);
+                    JsonVariant id = json["id"];
+                    if (!id.is<uint8_t>()) {
+                        request->send(422,"text/json","{\"error\":\"Invalid value for fields: id\"}");
+                    } else if (!lightWeaver->removeSegment(id.as<uint8_t>())) {
+                        request->send(404,"text/json","{\"error\":\"Segment not found\"}");
+                    } else {
+                        request->send(204);
+                    }
+                }, JSON_DOC_SIZE));
+
+                // Deserialized as the body is received, like /setColorSource
+                server.addHandler(new AsyncSegmentColorSourceWebHandler(rootPath + "/segments/setColorSource", [this](AsyncWebServerRequest *request, SegmentColorSourceDeserializer::Result& result) {
+                    TRACE_EVENT(TraceEvent::HttpCommand, TracePhase::Instant, Command::SetSegmentColorSource);
+                    if (!result) {
+                        request->send(422,"text/json","{\"error\":\"" + result.error + "\"}");
+                    } else if (!lightWeaver->setSegmentColorSource(result.id, std::move(result.colorSource))) {
+                        request->send(404,"text/json","{\"error\":\"Segment not found\"}");
+                    } else {
+                        request->send(204);
+                    }
+                }));
+
+                server.addHandler(new AsyncCallbackJsonWebHandler((rootPath + "/segments/clearColorSource").c_str(), [this](AsyncWebServerRequest *request, JsonVariant &json) {
+                    TRACE_EVENT(TraceEvent::HttpCommand, TracePhase::Instant, Command::ClearSegmentColorSource);
+                    JsonVariant id = json["id"];
+                    if (!id.is<uint8_t>()) {
+                        request->send(422,"text/json","{\"error\":\"Invalid value for fields: id\"}");
+                    } else if (!lightWeaver->clearSegmentColorSource(id.as<uint8_t>())) {
+                        request->send(404,"text/json","{\"error\":\"Segment not found\"}");
+                    } else {
+                        request->send(204);
+                    }
+                }, JSON_DOC_SIZE));
+
+                server.addHandler(new AsyncCallbackJsonWebHandler((rootPath + "/segments/setBrightness").c_str(), [this](AsyncWebServerRequest *request, JsonVariant &json) {
+                    TRACE_EVENT(TraceEvent::HttpCommand, TracePhase::Instant, Command::SetSegmentBrightness);
+                    JsonVariant id = json["id"];
+                    JsonVariant brightness = json["brightness"];
+                    if (id.isNull() || brightness.isNull()) {
+                        request->send(422,"text/json","{\"error\":\"Required fields missing: id, brightness\"}");
+                    } else if (!id.is<uint8_t>() || !brightness.is<uint8_t>()) {
+                        request->send(422,"text/json","{\"error\":\"Invalid value for fields: id, brightness\"}");
+                    } else if (!lightWeaver->setSegmentBrightness(id.as<uint8_t>(), brightness.as<uint8_t>())) {
+                        request->send(404,"text/json","{\"error\":\"Segment not found\"}");
+                    } else {
+                        request->send(204);
+                    }
+                }, JSON_DOC_SIZE));
+
+                server.on((rootPath + "/presets").c_str(), HTTP_GET, [this](AsyncWebServerRequest* request) {
+                    LightWeaverPresets* presets = getPresets();
+                    if (!presets) {
+                        request->send(404,"text/json","{\"error\":\"Presets are not enabled\"}");
+                        return;
+                    }
+                    sendPresetList(request, presets->getStore());
+                });
+
+                // Saves the given ColorSource as a preset, or the current ColorSource if none is given
+                // Deserialized as the body is received, so any ColorSource accepted by /setColorSource can be saved
+                server.addHandler(new AsyncPresetWebHandler(rootPath + "/presets/save", [this](AsyncWebServerRequest *request, PresetDeserializer::Result& result) {
+                    TRACE_EVENT(TraceEvent::HttpCommand, TracePhase::Instant, Command::SavePreset);
+                    LightWeaverPresets* presets = getPresets();
+                    if (!presets) {
+                        request->send(404,"text/json","{\"error\":\"Presets are not enabled\"}");
+                        return;
+                    }
+                    if (!result) {
+                        request->send(422,"text/json","{\"error\":\"" + result.error + "\"}");
+                        return;
+                    }
+
+                    const ColorSource* colorSource = result.colorSource ? result.colorSource.get() : lightWeaver->getColorSource();
+                    if (!colorSource) {
+                        request->send(409,"text/json","{\"error\":\"There is no ColorSource to save\"}");
+                    } else if (!presets->savePreset(result.id, result.name, *colorSource)) {
+                        request->send(507,"text/json","{\"error\":\"Unable to save preset\"}");
+                    } else {
+                        request->send(204);
+                    }
+                }));
+
+                server.addHandler(new AsyncCallbackJsonWebHandler((rootPath + "/presets/recall").c_str(), [this](AsyncWebServerRequest *request, JsonVariant &json) {
+                    TRACE_EVENT(TraceEvent::HttpCommand, TracePhase::Instant, Command::RecallPreset);
+                    LightWeaverPresets* presets = getPresets();
+                    JsonVariant id = json["id"];
+                    if (!presets) {
+                        request->send(404,"text/json","{\"error\":\"Presets are not enabled\"}");
+                    } else if (!id.is<uint8_t>()) {
+                        request->send(422,"text/json","{\"error\":\"Invalid value for fields: id\"}");
+                    } else if (!presets->recallPreset(id)) {
+                        request->send(404,"text/json","{\"error\":\"Preset not found\"}");
+                    } else {
+                        request->send(204);
+                    }
+                }, JSON_DOC_SIZE));
+
+                server.addHandler(new AsyncCallbackJsonWebHandler((rootPath + "/presets/remove").c_str(), [this](AsyncWebServerRequest *request, JsonVariant &json) {
+                    TRACE_EVENT(TraceEvent::HttpCommand, TracePhase::Instant, Command::RemovePreset);
+                    LightWeaverPresets* presets = getPresets();
+                    JsonVariant id = json["id"];
+                    if (!presets) {
+                        request->send(404,"text/json","{\"error\":\"Presets are not enabled\"}");
+                    } else if (!id.is<uint8_t>()) {
+                        request->send(422,"text/json","{\"error\":\"Invalid value for fields: id\"}");
+                    } else if (!presets->removePreset(id)) {
+                        request->send(404,"text/json","{\"error\":\"Preset not found\"}");
+                    } else {
+                        request->send(204);
+                    }
+                }, JSON_DOC_SIZE));
+
                 server.onNotFound([](AsyncWebServerRequest* request) {
                     request->send(404);
                 });
@@ -82,13 +524,8 @@ namespace LightWeaver {
             virtual void onWifiConnected() {
                 startServer();
             }
-
-            virtual const String& getType() {
-                return LightWeaverHttpServer::type;
-            }
     };
 
-    const String LightWeaverHttpServer::type = "HTTP_SERVER";
     const String LightWeaverHttpServer::apiVersion = "0.1.0";
     const String LightWeaverHttpServer::rootPath = "/lightWeaver";
 }
\ No newline at end of file
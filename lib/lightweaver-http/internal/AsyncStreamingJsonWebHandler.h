@@ -0,0 +1,93 @@
+#pragma once
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+
+#include "BatchDeserializer.h"
+#include "PresetDeserializer.h"
+#include "SegmentColorSourceDeserializer.h"
+#include "StreamingColorSourceDeserializer.h"
+
+namespace LightWeaver {
+    /**
+     * Web handler which deserializes the request body as it is received
+     *
+     * Unlike AsyncCallbackJsonWebHandler, no JsonDocument is allocated and the body is never buffered.
+     * Each chunk is passed to a T_DESERIALIZER as soon as it arrives, allowing large gradients and
+     * per-pixel offset lists to be uploaded without a matching amount of free memory.
+     * T_DESERIALIZER provides write(data, length) and finish(), which returns a T_DESERIALIZER::Result.
+     */
+    template <typename T_DESERIALIZER>
+    class AsyncStreamingJsonWebHandler : public AsyncWebHandler {
+        public:
+            typedef typename T_DESERIALIZER::Result Result;
+            typedef std::function<void(AsyncWebServerRequest* request, Result& result)> RequestHandler;
+        private:
+            const String uri;
+            const RequestHandler onRequest;
+            const size_t maxContentLength;
+
+            static T_DESERIALIZER* getDeserializer(AsyncWebServerRequest* request) {
+                return static_cast<T_DESERIALIZER*>(request->_tempObject);
+            }
+
+            static void releaseDeserializer(AsyncWebServerRequest* request) {
+                delete getDeserializer(request);
+                request->_tempObject = nullptr;
+            }
+        public:
+            AsyncStreamingJsonWebHandler(const String& uri, RequestHandler onRequest, size_t maxContentLength = 16384U):
+                uri(uri),
+                onRequest(onRequest),
+                maxContentLength(maxContentLength) {}
+
+            virtual bool canHandle(AsyncWebServerRequest* request) {
+                return (request->method() & (HTTP_POST | HTTP_PUT))
+                    && request->url() == uri
+                    && request->contentType().equalsIgnoreCase("application/json");
+            }
+
+            virtual void handleBody(AsyncWebServerRequest* request, uint8_t* data, size_t length, size_t index, size_t total) {
+                if (total > maxContentLength) return;
+
+                if (index == 0 && !request->_tempObject) {
+                    // The request frees _tempObject without running its destructor, so it is deleted
+                    // once the request is handled, or when the client disconnects before then
+                    request->_tempObject = new T_DESERIALIZER();
+                    request->onDisconnect([request]() {
+                        releaseDeserializer(request);
+                    });
+                }
+
+                T_DESERIALIZER* deserializer = getDeserializer(request);
+                if (deserializer) {
+                    deserializer->write(data, length);
+                }
+            }
+
+            virtual void handleRequest(AsyncWebServerRequest* request) {
+                if (request->contentLength() > maxContentLength) {
+                    request->send(413);
+                    return;
+                }
+
+                T_DESERIALIZER* deserializer = getDeserializer(request);
+                if (!deserializer) {
+                    request->send(400, "text/json", "{\"error\":\"Request body is required\"}");
+                    return;
+                }
+
+                Result result = deserializer->finish();
+                releaseDeserializer(request);
+                onRequest(request, result);
+            }
+
+            virtual bool isRequestHandlerTrivial() {
+                return false;
+            }
+    };
+
+    typedef AsyncStreamingJsonWebHandler<StreamingColorSourceDeserializer> AsyncColorSourceWebHandler;
+    typedef AsyncStreamingJsonWebHandler<BatchDeserializer> AsyncBatchWebHandler;
+    typedef AsyncStreamingJsonWebHandler<SegmentColorSourceDeserializer> AsyncSegmentColorSourceWebHandler;
+    typedef AsyncStreamingJsonWebHandler<PresetDeserializer> AsyncPresetWebHandler;
+}
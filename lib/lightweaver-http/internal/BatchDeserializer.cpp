@@ -0,0 +1,212 @@
+#include "BatchDeserializer.h"
+
+/**
+ * The document is {"operations": [...]}, where the root object is at depth 1, the operations array at depth 2
+ * and the fields of each operation at depth 3. Anything else in the document is ignored.
+ */
+namespace LightWeaver {
+    void BatchDeserializer::fail(const String& message) {
+        if (error.length() == 0) {
+            error = message;
+        }
+    }
+
+    void BatchDeserializer::startOperation() {
+        if (count == MAXIMUM_OPERATIONS) {
+            fail("Invalid value for fields: operations");
+        }
+        fieldName = "operations." + String(count) + ".";
+        hasType = false;
+        operationType = "";
+        hasBrightness = false;
+        isBrightnessValid = false;
+        hasColorSource = false;
+        colorSource.reset();
+        colorSourceError = "";
+    }
+
+    void BatchDeserializer::endOperation() {
+        if (error.length() > 0) return;
+
+        BatchOperation& operation = operations[count++];
+        if (!hasType) {
+            fail("Required fields missing: " + fieldName + "type");
+        } else if (operationType == "setColorSource") {
+            if (!hasColorSource) {
+                fail("Required fields missing: " + fieldName + "colorSource");
+            } else if (colorSourceError.length() > 0) {
+                fail(fieldName + "colorSource: " + colorSourceError);
+            } else if (!colorSource) {
+                fail("Invalid value for fields: " + fieldName + "colorSource");
+            } else {
+                operation.type = BatchOperation::Type::SetColorSource;
+                operation.colorSource = std::move(colorSource);
+            }
+        } else if (operationType == "clearColorSource") {
+            operation.type = BatchOperation::Type::ClearColorSource;
+        } else if (operationType == "setBrightness") {
+            if (!hasBrightness) {
+                fail("Required fields missing: " + fieldName + "brightness");
+            } else if (!isBrightnessValid) {
+                fail("Invalid value for fields: " + fieldName + "brightness");
+            } else {
+                operation.type = BatchOperation::Type::SetBrightness;
+                operation.brightness = brightness;
+            }
+        } else {
+            fail("Invalid value for fields: " + fieldName + "type");
+        }
+    }
+
+    void BatchDeserializer::onOperationContainer() {
+        if (key == "type") {
+            hasType = true;
+            operationType = "";
+        } else if (key == "brightness") {
+            hasBrightness = true;
+            isBrightnessValid = false;
+        } else if (key == "colorSource") {
+            hasColorSource = true;
+            colorSource.reset();
+            colorSourceError = "";
+        }
+    }
+
+    void BatchDeserializer::onObjectStart() {
+        if (colorSourceDeserializer) {
+            colorSourceDeserializer->getListener().onObjectStart();
+            return;
+        }
+
+        if (depth == 1 && key == "operations") {
+            hasOperations = true;
+            fail("Invalid value for fields: operations");
+        } else if (depth == 2 && isInOperations) {
+            startOperation();
+            isInOperation = true;
+        } else if (depth == 3 && isInOperation) {
+            onOperationContainer();
+            // The ColorSource tracks its own nesting, so depth is left as it is until the ColorSource has ended
+            if (key == "colorSource" && error.length() == 0) {
+                colorSourceDeserializer = std::unique_ptr<StreamingColorSourceDeserializer>{new StreamingColorSourceDeserializer()};
+                colorSourceDeserializer->getListener().onObjectStart();
+                return;
+            }
+        }
+        depth++;
+        key = "";
+    }
+
+    void BatchDeserializer::onObjectEnd() {
+        if (colorSourceDeserializer) {
+            colorSourceDeserializer->getListener().onObjectEnd();
+            if (colorSourceDeserializer->isComplete()) {
+                StreamingColorSourceDeserializer::Result result = colorSourceDeserializer->getResult();
+                if (result) {
+                    colorSource = std::move(result.value);
+                } else {
+                    colorSourceError = result.error;
+                }
+                colorSourceDeserializer.reset();
+            }
+            return;
+        }
+
+        depth--;
+        key = "";
+        if (depth == 2 && isInOperation) {
+            isInOperation = false;
+            endOperation();
+        }
+    }
+
+    void BatchDeserializer::onArrayStart() {
+        if (colorSourceDeserializer) {
+            colorSourceDeserializer->getListener().onArrayStart();
+            return;
+        }
+
+        if (depth == 1 && key == "operations") {
+            hasOperations = true;
+            isInOperations = true;
+            if (!operations) {
+                operations = std::unique_ptr<BatchOperation[]>{new BatchOperation[MAXIMUM_OPERATIONS]};
+            }
+        } else if (depth == 2 && isInOperations) {
+            startOperation();
+            endOperation();
+        } else if (depth == 3 && isInOperation) {
+            onOperationContainer();
+        }
+        depth++;
+        key = "";
+    }
+
+    void BatchDeserializer::onArrayEnd() {
+        if (colorSourceDeserializer) {
+            colorSourceDeserializer->getListener().onArrayEnd();
+            return;
+        }
+
+        depth--;
+        key = "";
+        if (depth == 1 && isInOperations) {
+            isInOperations = false;
+        }
+    }
+
+    void BatchDeserializer::onKey(const char* key) {
+        if (colorSourceDeserializer) {
+            colorSourceDeserializer->getListener().onKey(key);
+            return;
+        }
+        this->key = key;
+    }
+
+    void BatchDeserializer::onValue(ValueType type, const char* value) {
+        if (colorSourceDeserializer) {
+            colorSourceDeserializer->getListener().onValue(type, value);
+            return;
+        }
+
+        if (depth == 1 && key == "operations") {
+            if (type != ValueType::Null) {
+                hasOperations = true;
+                fail("Invalid value for fields: operations");
+            }
+        } else if (depth == 2 && isInOperations) {
+            startOperation();
+            endOperation();
+        } else if (depth == 3 && isInOperation) {
+            if (key == "type") {
+                hasType = type != ValueType::Null;
+                operationType = type == ValueType::String ? value : "";
+            } else if (key == "brightness") {
+                hasBrightness = type != ValueType::Null;
+                isBrightnessValid = type == ValueType::Integer && value[0] != '-' && strtoul(value, nullptr, 10) <= 0xFF;
+                brightness = isBrightnessValid ? strtoul(value, nullptr, 10) : 0;
+            } else if (key == "colorSource") {
+                hasColorSource = type != ValueType::Null;
+                colorSource.reset();
+                colorSourceError = "";
+            }
+        }
+    }
+
+    bool BatchDeserializer::write(const uint8_t* data, size_t length) {
+        return parser.write(data, length) != JsonStreamParser::Status::Error && error.length() == 0;
+    }
+
+    BatchDeserializer::Result BatchDeserializer::finish() {
+        if (parser.finish() == JsonStreamParser::Status::Error) {
+            return Result::withError(String("Invalid JSON: ") + parser.getError());
+        }
+        if (error.length() > 0) {
+            return Result::withError(error);
+        }
+        if (!hasOperations) {
+            return Result::withError("Required fields missing: operations");
+        }
+        return Result::withSuccess(count, std::move(operations));
+    }
+}
@@ -0,0 +1,126 @@
+#pragma once
+#include <memory>
+#include <Arduino.h>
+#include <LightWeaver/ColorSource.h>
+#include <LightWeaver/LightWeaverCore.h>
+
+#include "JsonStreamParser.h"
+#include "StreamingColorSourceDeserializer.h"
+
+namespace LightWeaver {
+    struct BatchOperation {
+        enum class Type {
+            SetColorSource,
+            ClearColorSource,
+            SetBrightness
+        };
+
+        Type type;
+        std::unique_ptr<ColorSource> colorSource;
+        uint8_t brightness;
+
+        BatchOperation(): type(Type::ClearColorSource), brightness(0) {}
+
+        // The ColorSource is moved into the core, so an operation can only be applied once
+        void apply(LightWeaverCore& lightWeaver) {
+            switch (type) {
+                case Type::SetColorSource:
+                    lightWeaver.setColorSource(std::move(colorSource));
+                    break;
+                case Type::ClearColorSource:
+                    lightWeaver.clearColorSource();
+                    break;
+                case Type::SetBrightness:
+                    lightWeaver.setBrightness(brightness);
+                    break;
+            }
+        }
+    };
+
+    /**
+     * Deserializes an ordered list of operations to be applied to the core together, from a JSON document that
+     * arrives in chunks. ColorSources are passed to a StreamingColorSourceDeserializer as they are parsed,
+     * so the request is never held in memory.
+     * Every operation is validated before the result is returned, so that a batch is either applied in full or not at all
+     */
+    class BatchDeserializer : private JsonStreamListener {
+        public:
+            struct Result {
+                public:
+                    bool success;
+                    uint8_t count;
+                    std::unique_ptr<BatchOperation[]> operations;
+                    String error;
+                private:
+                    Result(uint8_t count, std::unique_ptr<BatchOperation[]> operations):
+                        success(true),
+                        count(count),
+                        operations(std::move(operations)) {};
+
+                    Result(String error):
+                        success(false),
+                        count(0),
+                        operations(nullptr),
+                        error(error) {};
+                public:
+                    static Result withSuccess(uint8_t count, std::unique_ptr<BatchOperation[]> operations) {
+                        return Result(count, std::move(operations));
+                    }
+
+                    static Result withError(const String error) {
+                        return Result(error);
+                    }
+
+                    operator bool () const {
+                        return success;
+                    }
+            };
+        public:
+            static const uint8_t MAXIMUM_OPERATIONS = 16;
+        private:
+            JsonStreamParser parser{*this};
+            // Number of objects and arrays open in the document, not counting those inside of a ColorSource
+            uint8_t depth = 0;
+            String key;
+            // The first problem found, later operations are not validated once it is set
+            String error;
+            bool hasOperations = false;
+            bool isInOperations = false;
+            uint8_t count = 0;
+            std::unique_ptr<BatchOperation[]> operations;
+
+            // Fields of the operation currently being parsed
+            bool isInOperation = false;
+            String fieldName;
+            bool hasType = false;
+            // Empty if the type is not a string
+            String operationType;
+            bool hasBrightness = false;
+            bool isBrightnessValid = false;
+            uint8_t brightness = 0;
+            bool hasColorSource = false;
+            // Set while the tokens of a ColorSource object are being passed on to it
+            std::unique_ptr<StreamingColorSourceDeserializer> colorSourceDeserializer;
+            std::unique_ptr<ColorSource> colorSource;
+            String colorSourceError;
+
+            void fail(const String& message);
+            void startOperation();
+            void endOperation();
+            // Objects and arrays are only valid for the colorSource field of an operation
+            void onOperationContainer();
+
+            virtual void onObjectStart();
+            virtual void onObjectEnd();
+            virtual void onArrayStart();
+            virtual void onArrayEnd();
+            virtual void onKey(const char* key);
+            virtual void onValue(ValueType type, const char* value);
+        public:
+            BatchDeserializer() {}
+
+            // Consumes the next chunk of the document, returning false once the document is known to be invalid
+            bool write(const uint8_t* data, size_t length);
+            Result finish();
+    };
+}
@@ -49,34 +49,12 @@ namespace LightWeaver {
         if (!validateRequiredField(obj, fieldName, missingFields)) return RgbaColor(0,0,0,0);
 
         if (obj.is<String>()) {
-            String hexColor = obj.as<String>();
-            if (hexColor.charAt(0) != '#') {
+            RgbaColor color;
+            if (!deserializeHexColor(obj.as<String>(), color)) {
                 invalidFields += fieldName;
                 return RgbaColor();
             }
-            hexColor = hexColor.substring(1);
-            for (const char& c : hexColor) {
-                if (!((c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F'))) {
-                    invalidFields += fieldName;
-                    return RgbaColor();
-                }
-            }
-            
-            if (hexColor.length() == 6) {
-                uint8_t r = strtoul(hexColor.substring(0,2).c_str(),nullptr, 16);
-                uint8_t g = strtoul(hexColor.substring(2,4).c_str(),nullptr, 16);
-                uint8_t b = strtoul(hexColor.substring(4,6).c_str(),nullptr, 16);
-                return RgbColor(r,g,b);
-            } else if (hexColor.length() == 8) {
-                uint8_t r = strtoul(hexColor.substring(0,2).c_str(),nullptr, 16);
-                uint8_t g = strtoul(hexColor.substring(2,4).c_str(),nullptr, 16);
-                uint8_t b = strtoul(hexColor.substring(4,6).c_str(),nullptr, 16);
-                uint8_t a = strtoul(hexColor.substring(6,8).c_str(),nullptr, 16);
-                return RgbaColor(r,g,b,a);
-            }
-            
-            invalidFields += fieldName;
-            return RgbaColor();
+            return color;
         }
 
         if (obj.is<JsonObject>()) {
@@ -117,6 +95,35 @@ namespace LightWeaver {
         return RgbaColor();
     }
 
+    bool ColorSourceDeserializer::deserializeHexColor(const String& value, RgbaColor& color) {
+        if (value.charAt(0) != '#') {
+            return false;
+        }
+        String hexColor = value.substring(1);
+        for (const char& c : hexColor) {
+            if (!((c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F'))) {
+                return false;
+            }
+        }
+        
+        if (hexColor.length() == 6) {
+            uint8_t r = strtoul(hexColor.substring(0,2).c_str(),nullptr, 16);
+            uint8_t g = strtoul(hexColor.substring(2,4).c_str(),nullptr, 16);
+            uint8_t b = strtoul(hexColor.substring(4,6).c_str(),nullptr, 16);
+            color = RgbColor(r,g,b);
+            return true;
+        } else if (hexColor.length() == 8) {
+            uint8_t r = strtoul(hexColor.substring(0,2).c_str(),nullptr, 16);
+            uint8_t g = strtoul(hexColor.substring(2,4).c_str(),nullptr, 16);
+            uint8_t b = strtoul(hexColor.substring(4,6).c_str(),nullptr, 16);
+            uint8_t a = strtoul(hexColor.substring(6,8).c_str(),nullptr, 16);
+            color = RgbaColor(r,g,b,a);
+            return true;
+        }
+        
+        return false;
+    }
+
     EasingFunction ColorSourceDeserializer::deserializeEasingFunction(const JsonVariant& obj, const StringListBuilder& fieldName, StringListBuilder& missingFields, StringListBuilder& invalidFields) {
         if (obj.isNull()) return Easing::Linear;
         if (obj.is<String>()) {
@@ -265,9 +272,9 @@ namespace LightWeaver {
             requiredFieldType(offsets, JsonArray);
             
             if (offsets.is<JsonArray>()) {
-                uint8_t size = offsets.size();
+                uint16_t size = offsets.size();
                 float* offsetList = new float[size];
-                for (uint8_t i = 0; i < size; i++) {
+                for (uint16_t i = 0; i < size; i++) {
                     JsonVariant offset = offsets.getElement(i);
                     validateRequiredField(offset, fieldName + String(i), missingFields);
                     validateFieldType<float>(offset, fieldName + String(i), invalidFields);
@@ -307,7 +314,18 @@ namespace LightWeaver {
             return Result::withError("Unknown Error");
         }
 
-        return Result::withSuccess(colorSource);
+        return Result::withSuccess(std::move(colorSource));
+    }
+
+    const char* ColorSourceDeserializer::getTypeName(ColorSource::Type type) {
+        switch (type) {
+            case ColorSource::Type::Solid: return "Solid";
+            case ColorSource::Type::Fade: return "Fade";
+            case ColorSource::Type::Overlay: return "Overlay";
+            case ColorSource::Type::Gradient: return "Gradient";
+            case ColorSource::Type::HsvMeander: return "HsvMeander";
+        }
+        return "";
     }
 
     Deserializer(ColorSource) {
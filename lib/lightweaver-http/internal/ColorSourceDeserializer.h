@@ -10,6 +10,7 @@
 
 namespace LightWeaver {
     class ColorSourceDeserializer {
+        friend class ColorSourcePatcher;
         public:
             struct Result {
                 public:
@@ -30,6 +31,10 @@ namespace LightWeaver {
                         return Result(std::unique_ptr<ColorSource>{colorSource->clone()});
                     }
 
+                    static Result withSuccess(std::unique_ptr<ColorSource>&& colorSource) {
+                        return Result(std::move(colorSource));
+                    }
+
                     static Result withError(const String error) {
                         return Result(error);
                     }
@@ -51,7 +56,6 @@ namespace LightWeaver {
 
         static RgbaColor deserializeColor(const JsonVariant& obj, const StringListBuilder& fieldName, StringListBuilder& missingFields, StringListBuilder& invalidFields);
         static EasingFunction deserializeEasingFunction(const JsonVariant& obj, const StringListBuilder& fieldName, StringListBuilder& missingFields, StringListBuilder& invalidFields);
-        static EasingFunction deserializeEasingFunctionFromName(const String& name);
         static ColorSet deserializeColorSet(const JsonVariant& obj, const StringListBuilder& fieldName, StringListBuilder& missingFields, StringListBuilder& invalidFields);
         static Gradient deserializeGradient(const JsonVariant& obj, const StringListBuilder& fieldName, StringListBuilder& missingFields, StringListBuilder& invalidFields);
         static PixelOffsetConfig deserializePixelOffsetConfig(const JsonVariant& obj, const StringListBuilder& fieldName, StringListBuilder& missingFields, StringListBuilder& invalidFields);
@@ -65,6 +69,9 @@ namespace LightWeaver {
         static std::unique_ptr<ColorSource> deserializeHsvMeanderColorSource(const JsonVariant& obj, const StringListBuilder& fieldName, StringListBuilder& missingFields, StringListBuilder& invalidFields);
         public:
         static Result deserialize(const JsonVariant& obj);
+        static bool deserializeHexColor(const String& hexColor, RgbaColor& color);
+        static const char* getTypeName(ColorSource::Type type);
+        static EasingFunction deserializeEasingFunctionFromName(const String& name);
         static bool validateRequiredField(const JsonVariant& field, const String& fieldName, StringListBuilder& err);
         template<typename T> static bool validateFieldType(const JsonVariant& field, const String& fieldName, StringListBuilder& err);
     };
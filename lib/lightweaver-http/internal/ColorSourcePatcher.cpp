@@ -0,0 +1,161 @@
+#include "ColorSourcePatcher.h"
+
+/**
+ * Patch Macros
+ * Mirror the validation macros used by ColorSourceDeserializer, falling back to the value from the current ColorSource
+ * whenever a field is not present in the patch
+ */
+#define Patcher(type) std::unique_ptr<ColorSource> ColorSourcePatcher::patch##type(const JsonVariant& obj, const type& current, const StringListBuilder& fieldName, StringListBuilder& missingFields, StringListBuilder& invalidFields)
+#define patchField(field,type,currentValue) (field.isNull() ? (currentValue) : (field.is<type>() ? field.as<type>() : (invalidFields += fieldName + #field, (currentValue))))
+#define patchAndValidate(field,deserializeFunction,currentValue) (field.isNull() ? (currentValue) : ColorSourceDeserializer::deserializeFunction(field, fieldName + #field, missingFields, invalidFields))
+#define isValid() (missingFields.empty() && invalidFields.empty())
+
+namespace LightWeaver {
+    ColorSourcePatcher::Result ColorSourcePatcher::patch(const JsonVariant& obj, const ColorSource& current) {
+        StringListBuilder missingFields(", ","");
+        StringListBuilder invalidFields(", ","");
+        std::unique_ptr<ColorSource> colorSource = patchColorSource(obj, current, StringListBuilder(".",""), missingFields, invalidFields);
+
+        if (!missingFields.empty()) {
+            return Result::withMissingFields(missingFields);
+        } else if (!invalidFields.empty()) {
+            return Result::withInvalidFields(invalidFields);
+        }
+
+        if (!colorSource) {
+            return Result::withError("Unknown Error");
+        }
+
+        return Result::withSuccess(std::move(colorSource));
+    }
+
+    std::unique_ptr<ColorSource> ColorSourcePatcher::patchColorSource(const JsonVariant& obj, const ColorSource& current, const StringListBuilder& fieldName, StringListBuilder& missingFields, StringListBuilder& invalidFields) {
+        if (!obj.is<JsonObject>()) {
+            invalidFields += fieldName;
+            return nullptr;
+        }
+
+        // The uid and type identify the ColorSource being patched, so they may be omitted but never changed
+        JsonVariant uid = obj["uid"];
+        JsonVariant type = obj["type"];
+        if (!uid.isNull() && (!uid.is<uint32_t>() || uid.as<uint32_t>() != current.uid)) {
+            invalidFields += fieldName + "uid";
+        }
+        if (!type.isNull() && type != ColorSourceDeserializer::getTypeName(current.getType())) {
+            invalidFields += fieldName + "type";
+        }
+        if (!isValid()) {
+            return nullptr;
+        }
+
+        switch (current.getType()) {
+            case ColorSource::Type::Solid:
+                return patchSolidColorSource(obj, static_cast<const SolidColorSource&>(current), fieldName, missingFields, invalidFields);
+            case ColorSource::Type::Fade:
+                return patchFadeColorSource(obj, static_cast<const FadeColorSource&>(current), fieldName, missingFields, invalidFields);
+            case ColorSource::Type::Overlay:
+                return patchOverlayColorSource(obj, static_cast<const OverlayColorSource&>(current), fieldName, missingFields, invalidFields);
+            case ColorSource::Type::Gradient:
+                return patchGradientColorSource(obj, static_cast<const GradientColorSource&>(current), fieldName, missingFields, invalidFields);
+            case ColorSource::Type::HsvMeander:
+                return patchHsvMeanderColorSource(obj, static_cast<const HsvMeanderColorSource&>(current), fieldName, missingFields, invalidFields);
+        }
+        return nullptr;
+    }
+
+    std::unique_ptr<ColorSource> ColorSourcePatcher::patchChildColorSource(const JsonVariant& obj, const ColorSource& current, const StringListBuilder& fieldName, StringListBuilder& missingFields, StringListBuilder& invalidFields) {
+        if (obj.isNull()) {
+            return std::unique_ptr<ColorSource>{current.clone()};
+        }
+
+        // A child with a different uid or type is a new ColorSource rather than a patch of the existing one
+        JsonVariant uid = obj["uid"];
+        JsonVariant type = obj["type"];
+        bool isSameUid = uid.isNull() || (uid.is<uint32_t>() && uid.as<uint32_t>() == current.uid);
+        bool isSameType = type.isNull() || type == ColorSourceDeserializer::getTypeName(current.getType());
+        if (!isSameUid || !isSameType) {
+            return ColorSourceDeserializer::deserializeColorSource(obj, fieldName, missingFields, invalidFields);
+        }
+
+        return patchColorSource(obj, current, fieldName, missingFields, invalidFields);
+    }
+
+    Patcher(SolidColorSource) {
+        JsonVariant color = obj["color"];
+
+        RgbaColor displayColor = patchAndValidate(color, deserializeColor, current.getColor());
+
+        return isValid() ? std::unique_ptr<ColorSource>{new SolidColorSource(current.uid, displayColor)} : nullptr;
+    }
+
+    Patcher(FadeColorSource) {
+        JsonVariant duration = obj["duration"];
+        JsonVariant loop = obj["loop"];
+        JsonVariant start = obj["start"];
+        JsonVariant end = obj["end"];
+        JsonVariant easing = obj["easing"];
+
+        uint16_t durationValue = patchField(duration, uint16_t, current.getDuration());
+        bool loopValue = patchField(loop, bool, current.isLooping());
+        RgbaColor startColor = patchAndValidate(start, deserializeColor, current.getStart());
+        RgbaColor endColor = patchAndValidate(end, deserializeColor, current.getEnd());
+        EasingFunction easingFunction = patchAndValidate(easing, deserializeEasingFunction, current.getEasing());
+
+        return isValid()
+            ? std::unique_ptr<ColorSource>{new FadeColorSource(current.uid, startColor, endColor, durationValue, loopValue, easingFunction)}
+            : nullptr;
+    }
+
+    Patcher(OverlayColorSource) {
+        JsonVariant background = obj["background"];
+        JsonVariant overlay = obj["overlay"];
+
+        std::unique_ptr<ColorSource> backgroundColorSource = patchChildColorSource(background, current.getBackground(), fieldName + "background", missingFields, invalidFields);
+        std::unique_ptr<ColorSource> overlayColorSource = patchChildColorSource(overlay, current.getOverlay(), fieldName + "overlay", missingFields, invalidFields);
+
+        if (isValid() && backgroundColorSource && overlayColorSource) {
+            return std::unique_ptr<ColorSource>{new OverlayColorSource(current.uid, *backgroundColorSource, *overlayColorSource)};
+        } else {
+            return nullptr;
+        }
+    }
+
+    Patcher(GradientColorSource) {
+        JsonVariant duration = obj["duration"];
+        JsonVariant loop = obj["loop"];
+        JsonVariant gradient = obj["gradient"];
+        JsonVariant easing = obj["easing"];
+        JsonVariant pixelOffsets = obj["pixelOffsets"];
+
+        uint16_t durationValue = patchField(duration, uint16_t, current.getDuration());
+        bool loopValue = patchField(loop, bool, current.isLooping());
+        Gradient gradientData = patchAndValidate(gradient, deserializeGradient, current.getGradient());
+        EasingFunction easingFunction = patchAndValidate(easing, deserializeEasingFunction, current.getEasing());
+        PixelOffsetConfig pixelOffsetConfig = patchAndValidate(pixelOffsets, deserializePixelOffsetConfig, current.getPixelOffsets());
+
+        return isValid()
+            ? std::unique_ptr<ColorSource>{new GradientColorSource(current.uid, gradientData, durationValue, loopValue, easingFunction, pixelOffsetConfig)}
+            : nullptr;
+    }
+
+    Patcher(HsvMeanderColorSource) {
+        JsonVariant color = obj["color"];
+        JsonVariant duration = obj["duration"];
+        JsonVariant hueDistance = obj["hueDistance"];
+        JsonVariant saturationDistance = obj["saturationDistance"];
+        JsonVariant valueDistance = obj["valueDistance"];
+        JsonVariant pixelOffsets = obj["pixelOffsets"];
+
+        uint16_t durationValue = patchField(duration, uint16_t, current.getDuration());
+        float hueDistanceValue = patchField(hueDistance, float, current.getHueDistance());
+        float saturationDistanceValue = patchField(saturationDistance, float, current.getSaturationDistance());
+        float valueDistanceValue = patchField(valueDistance, float, current.getValueDistance());
+        // Keep the current color as HSV unless it is replaced, to avoid a lossy conversion through RGB
+        HsvaColor baseColor = color.isNull() ? current.getBaseColor() : HsvaColor(ColorSourceDeserializer::deserializeColor(color, fieldName + "color", missingFields, invalidFields));
+        PixelOffsetConfig pixelOffsetConfig = patchAndValidate(pixelOffsets, deserializePixelOffsetConfig, current.getPixelOffsets());
+
+        return isValid()
+            ? std::unique_ptr<ColorSource>{new HsvMeanderColorSource(current.uid, baseColor, durationValue, hueDistanceValue, saturationDistanceValue, valueDistanceValue, pixelOffsetConfig)}
+            : nullptr;
+    }
+}
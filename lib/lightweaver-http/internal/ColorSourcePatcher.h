@@ -0,0 +1,35 @@
+#pragma once
+#include <memory>
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <LightWeaver/ColorSource.h>
+#include <LightWeaver/colorSources/SolidColorSource.h>
+#include <LightWeaver/colorSources/FadeColorSource.h>
+#include <LightWeaver/colorSources/OverlayColorSource.h>
+#include <LightWeaver/colorSources/GradientColorSource.h>
+#include <LightWeaver/colorSources/HsvMeanderColorSource.h>
+#include <LightWeaver/util/StringListBuilder.h>
+
+#include "ColorSourceDeserializer.h"
+
+namespace LightWeaver {
+    /**
+     * Applies a partial ColorSource definition on top of an existing ColorSource
+     * Any field missing from the patch keeps its current value. The resulting ColorSource has the same uid
+     * and type as the current one, and can be applied in place with LightWeaverCore::patchColorSource
+     */
+    class ColorSourcePatcher {
+        public:
+            typedef ColorSourceDeserializer::Result Result;
+        private:
+            static std::unique_ptr<ColorSource> patchColorSource(const JsonVariant& obj, const ColorSource& current, const StringListBuilder& fieldName, StringListBuilder& missingFields, StringListBuilder& invalidFields);
+            static std::unique_ptr<ColorSource> patchChildColorSource(const JsonVariant& obj, const ColorSource& current, const StringListBuilder& fieldName, StringListBuilder& missingFields, StringListBuilder& invalidFields);
+            static std::unique_ptr<ColorSource> patchSolidColorSource(const JsonVariant& obj, const SolidColorSource& current, const StringListBuilder& fieldName, StringListBuilder& missingFields, StringListBuilder& invalidFields);
+            static std::unique_ptr<ColorSource> patchFadeColorSource(const JsonVariant& obj, const FadeColorSource& current, const StringListBuilder& fieldName, StringListBuilder& missingFields, StringListBuilder& invalidFields);
+            static std::unique_ptr<ColorSource> patchOverlayColorSource(const JsonVariant& obj, const OverlayColorSource& current, const StringListBuilder& fieldName, StringListBuilder& missingFields, StringListBuilder& invalidFields);
+            static std::unique_ptr<ColorSource> patchGradientColorSource(const JsonVariant& obj, const GradientColorSource& current, const StringListBuilder& fieldName, StringListBuilder& missingFields, StringListBuilder& invalidFields);
+            static std::unique_ptr<ColorSource> patchHsvMeanderColorSource(const JsonVariant& obj, const HsvMeanderColorSource& current, const StringListBuilder& fieldName, StringListBuilder& missingFields, StringListBuilder& invalidFields);
+        public:
+            static Result patch(const JsonVariant& obj, const ColorSource& current);
+    };
+}
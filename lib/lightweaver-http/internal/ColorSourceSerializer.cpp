@@ -0,0 +1,174 @@
+#include "ColorSourceSerializer.h"
+#include "ColorSourceDeserializer.h"
+
+#define Serializer(type) void ColorSourceSerializer::serialize##type(const type& colorSource, JsonVariant obj)
+
+/**
+ * Serialization Helpers
+ */
+namespace LightWeaver {
+    String ColorSourceSerializer::serializeHexColor(const RgbaColor& color) {
+        char hexColor[10];
+        if (color.A == 255) {
+            snprintf(hexColor, sizeof(hexColor), "#%02X%02X%02X", color.R, color.G, color.B);
+        } else {
+            snprintf(hexColor, sizeof(hexColor), "#%02X%02X%02X%02X", color.R, color.G, color.B, color.A);
+        }
+        return String(hexColor);
+    }
+
+    void ColorSourceSerializer::serializeColor(const RgbaColor& color, JsonVariant obj) {
+        obj.set(serializeHexColor(color));
+    }
+
+    void ColorSourceSerializer::serializeColor(const HsvaColor& color, JsonVariant obj) {
+        JsonObject hsv = obj.to<JsonObject>();
+        hsv["hue"] = color.H;
+        hsv["saturation"] = color.S;
+        hsv["value"] = color.V;
+        hsv["alpha"] = color.A;
+    }
+
+    const char* ColorSourceSerializer::getEasingCurveName(EasingCurve curve) {
+        if (curve == Easing::Linear) return "Linear";
+        else if (curve == Easing::QuadraticIn) return "QuadraticIn";
+        else if (curve == Easing::QuadraticOut) return "QuadraticOut";
+        else if (curve == Easing::QuadraticInOut) return "QuadraticInOut";
+        else if (curve == Easing::CubicIn) return "CubicIn";
+        else if (curve == Easing::CubicOut) return "CubicOut";
+        else if (curve == Easing::CubicInOut) return "CubicInOut";
+        else if (curve == Easing::QuarticIn) return "QuarticIn";
+        else if (curve == Easing::QuarticOut) return "QuarticOut";
+        else if (curve == Easing::QuarticInOut) return "QuarticInOut";
+        else if (curve == Easing::QuinticIn) return "QuinticIn";
+        else if (curve == Easing::QuinticOut) return "QuinticOut";
+        else if (curve == Easing::QuinticInOut) return "QuinticInOut";
+        else if (curve == Easing::SinusoidalIn) return "SinusoidalIn";
+        else if (curve == Easing::SinusoidalOut) return "SinusoidalOut";
+        else if (curve == Easing::SinusoidalInOut) return "SinusoidalInOut";
+        else if (curve == Easing::ExponentialIn) return "ExponentialIn";
+        else if (curve == Easing::ExponentialOut) return "ExponentialOut";
+        else if (curve == Easing::ExponentialInOut) return "ExponentialInOut";
+        return nullptr;
+    }
+
+    void ColorSourceSerializer::serializeEasingFunction(const EasingFunction& easing, JsonVariant obj) {
+        // Modifiers are nested outermost first, e.g. {"name":"Mirror","easing":{"name":"Reverse","easing":"CubicIn"}}
+        for (uint8_t i = 0; i < EasingFunction::MAXIMUM_MODIFIERS && easing.modifiers[i] != EasingFunction::Modifier::None; i++) {
+            JsonObject modifier = obj.to<JsonObject>();
+            modifier["name"] = easing.modifiers[i] == EasingFunction::Modifier::Reverse ? "Reverse" : "Mirror";
+            obj = modifier.createNestedObject("easing");
+        }
+
+        const char* name = getEasingCurveName(easing.curve);
+        obj.set(name ? name : "Linear");
+    }
+
+    void ColorSourceSerializer::serializeColorSet(const ColorSet& colorSet, JsonVariant obj) {
+        JsonArray colors = obj.to<JsonArray>();
+        for (uint8_t i = 0; i < colorSet.size; i++) {
+            serializeColor(colorSet.colors[i], colors.addElement());
+        }
+    }
+
+    void ColorSourceSerializer::serializeGradient(const Gradient& gradient, JsonVariant obj) {
+        JsonObject gradientObj = obj.to<JsonObject>();
+        serializeEasingFunction(gradient.easing, gradientObj.getOrAddMember("easing"));
+
+        // Evenly spaced colors are written as an array, matching the positions Gradient generates for one
+        Gradient evenlySpaced{gradient.colorSet, gradient.easing};
+        if (gradient == evenlySpaced) {
+            serializeColorSet(gradient.colorSet, gradientObj.getOrAddMember("colors"));
+        } else {
+            JsonObject colors = gradientObj.createNestedObject("colors");
+            for (uint8_t i = 0; i < gradient.colorSet.size; i++) {
+                serializeColor(gradient.colorSet.colors[i], colors.getOrAddMember(String(gradient.colorPositions[i])));
+            }
+        }
+    }
+
+    void ColorSourceSerializer::serializePixelOffsetConfig(const PixelOffsetConfig& config, JsonVariant obj) {
+        JsonObject configObj = obj.to<JsonObject>();
+        switch (config.getType()) {
+            case PixelOffsetConfig::Type::SCALE:
+                configObj["type"] = "Scale";
+                configObj["scale"] = config.getScale();
+                break;
+            case PixelOffsetConfig::Type::RANDOM:
+                configObj["type"] = "Random";
+                break;
+            case PixelOffsetConfig::Type::LIST: {
+                configObj["type"] = "OffsetList";
+                JsonArray offsets = configObj.createNestedArray("offsets");
+                for (uint16_t i = 0; i < config.getOffsetCount(); i++) {
+                    offsets.add(config.getOffsets()[i]);
+                }
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * ColorSource Serializers
+ */
+namespace LightWeaver {
+    void ColorSourceSerializer::serialize(const ColorSource& colorSource, JsonVariant obj) {
+        JsonObject colorSourceObj = obj.to<JsonObject>();
+        colorSourceObj["uid"] = colorSource.uid;
+        colorSourceObj["type"] = ColorSourceDeserializer::getTypeName(colorSource.getType());
+
+        switch (colorSource.getType()) {
+            case ColorSource::Type::Solid:
+                serializeSolidColorSource(static_cast<const SolidColorSource&>(colorSource), colorSourceObj);
+                break;
+            case ColorSource::Type::Fade:
+                serializeFadeColorSource(static_cast<const FadeColorSource&>(colorSource), colorSourceObj);
+                break;
+            case ColorSource::Type::Overlay:
+                serializeOverlayColorSource(static_cast<const OverlayColorSource&>(colorSource), colorSourceObj);
+                break;
+            case ColorSource::Type::Gradient:
+                serializeGradientColorSource(static_cast<const GradientColorSource&>(colorSource), colorSourceObj);
+                break;
+            case ColorSource::Type::HsvMeander:
+                serializeHsvMeanderColorSource(static_cast<const HsvMeanderColorSource&>(colorSource), colorSourceObj);
+                break;
+        }
+    }
+
+    Serializer(SolidColorSource) {
+        serializeColor(colorSource.getColor(), obj.getOrAddMember("color"));
+    }
+
+    Serializer(FadeColorSource) {
+        obj["duration"] = colorSource.getDuration();
+        obj["loop"] = colorSource.isLooping();
+        serializeColor(colorSource.getStart(), obj.getOrAddMember("start"));
+        serializeColor(colorSource.getEnd(), obj.getOrAddMember("end"));
+        serializeEasingFunction(colorSource.getEasing(), obj.getOrAddMember("easing"));
+    }
+
+    Serializer(OverlayColorSource) {
+        serialize(colorSource.getBackground(), obj.getOrAddMember("background"));
+        serialize(colorSource.getOverlay(), obj.getOrAddMember("overlay"));
+    }
+
+    Serializer(GradientColorSource) {
+        obj["duration"] = colorSource.getDuration();
+        obj["loop"] = colorSource.isLooping();
+        serializeGradient(colorSource.getGradient(), obj.getOrAddMember("gradient"));
+        serializeEasingFunction(colorSource.getEasing(), obj.getOrAddMember("easing"));
+        serializePixelOffsetConfig(colorSource.getPixelOffsets(), obj.getOrAddMember("pixelOffsets"));
+    }
+
+    Serializer(HsvMeanderColorSource) {
+        // The base color is kept as HSV, since converting it to RGB would not round trip exactly
+        serializeColor(colorSource.getBaseColor(), obj.getOrAddMember("color"));
+        obj["duration"] = colorSource.getDuration();
+        obj["hueDistance"] = colorSource.getHueDistance();
+        obj["saturationDistance"] = colorSource.getSaturationDistance();
+        obj["valueDistance"] = colorSource.getValueDistance();
+        serializePixelOffsetConfig(colorSource.getPixelOffsets(), obj.getOrAddMember("pixelOffsets"));
+    }
+}
@@ -0,0 +1,37 @@
+#pragma once
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <LightWeaver/ColorSource.h>
+#include <LightWeaver/ColorSet.h>
+#include <LightWeaver/Gradient.h>
+#include <LightWeaver/PixelOffsetConfig.h>
+#include <LightWeaver/colorSources/SolidColorSource.h>
+#include <LightWeaver/colorSources/FadeColorSource.h>
+#include <LightWeaver/colorSources/OverlayColorSource.h>
+#include <LightWeaver/colorSources/GradientColorSource.h>
+#include <LightWeaver/colorSources/HsvMeanderColorSource.h>
+
+namespace LightWeaver {
+    /**
+     * Serializes a ColorSource to JSON in the format accepted by ColorSourceDeserializer
+     */
+    class ColorSourceSerializer {
+        private:
+            static void serializeColor(const RgbaColor& color, JsonVariant obj);
+            static void serializeColor(const HsvaColor& color, JsonVariant obj);
+            static void serializeEasingFunction(const EasingFunction& easing, JsonVariant obj);
+            static void serializeColorSet(const ColorSet& colorSet, JsonVariant obj);
+            static void serializeGradient(const Gradient& gradient, JsonVariant obj);
+            static void serializePixelOffsetConfig(const PixelOffsetConfig& config, JsonVariant obj);
+
+            static void serializeSolidColorSource(const SolidColorSource& colorSource, JsonVariant obj);
+            static void serializeFadeColorSource(const FadeColorSource& colorSource, JsonVariant obj);
+            static void serializeOverlayColorSource(const OverlayColorSource& colorSource, JsonVariant obj);
+            static void serializeGradientColorSource(const GradientColorSource& colorSource, JsonVariant obj);
+            static void serializeHsvMeanderColorSource(const HsvMeanderColorSource& colorSource, JsonVariant obj);
+        public:
+            static void serialize(const ColorSource& colorSource, JsonVariant obj);
+            static String serializeHexColor(const RgbaColor& color);
+            static const char* getEasingCurveName(EasingCurve curve);
+    };
+}
@@ -0,0 +1,234 @@
+#include "JsonStreamParser.h"
+
+namespace LightWeaver {
+    JsonStreamParser::Status JsonStreamParser::write(const uint8_t* data, size_t length) {
+        for (size_t i = 0; i < length && status == Status::Parsing; i++) {
+            parseCharacter((char)data[i]);
+        }
+        return status;
+    }
+
+    JsonStreamParser::Status JsonStreamParser::finish() {
+        if (status != Status::Parsing) return status;
+
+        // A top level number has no terminating character, so it can only be completed once the input ends
+        if (state == State::Number && depth == 0) {
+            completeNumber();
+        } else if (state == State::Literal && depth == 0) {
+            completeLiteral();
+        }
+
+        if (status == Status::Parsing) {
+            if (state == State::Done) {
+                status = Status::Complete;
+            } else {
+                fail("Unexpected end of input");
+            }
+        }
+        return status;
+    }
+
+    bool JsonStreamParser::fail(const char* reason) {
+        error = reason;
+        status = Status::Error;
+        return false;
+    }
+
+    bool JsonStreamParser::parseCharacter(char c) {
+        switch (state) {
+            case State::String:
+                if (c == '"') {
+                    token[tokenLength] = '\0';
+                    if (isKey) {
+                        listener.onKey(token);
+                        state = State::Colon;
+                        return true;
+                    }
+                    listener.onValue(JsonStreamListener::ValueType::String, token);
+                    return completeValue();
+                } else if (c == '\\') {
+                    state = State::StringEscape;
+                    return true;
+                } else if ((uint8_t)c < 0x20) {
+                    return fail("Control character in string");
+                }
+                return appendToken(c);
+            case State::StringEscape:
+                state = State::String;
+                switch (c) {
+                    case '"': return appendToken('"');
+                    case '\\': return appendToken('\\');
+                    case '/': return appendToken('/');
+                    case 'b': return appendToken('\b');
+                    case 'f': return appendToken('\f');
+                    case 'n': return appendToken('\n');
+                    case 'r': return appendToken('\r');
+                    case 't': return appendToken('\t');
+                    case 'u':
+                        unicodeValue = 0;
+                        unicodeDigits = 0;
+                        state = State::StringUnicode;
+                        return true;
+                }
+                return fail("Invalid escape sequence");
+            case State::StringUnicode:
+                unicodeValue <<= 4;
+                if (c >= '0' && c <= '9') unicodeValue |= c - '0';
+                else if (c >= 'a' && c <= 'f') unicodeValue |= c - 'a' + 10;
+                else if (c >= 'A' && c <= 'F') unicodeValue |= c - 'A' + 10;
+                else return fail("Invalid escape sequence");
+
+                if (++unicodeDigits == 4) {
+                    state = State::String;
+                    return appendCodepoint(unicodeValue);
+                }
+                return true;
+            case State::Number:
+                if ((c >= '0' && c <= '9') || c == '-' || c == '+') {
+                    return appendToken(c);
+                } else if (c == '.' || c == 'e' || c == 'E') {
+                    isFloat = true;
+                    return appendToken(c);
+                }
+                // Any other character terminates the number and must then be parsed on its own
+                return completeNumber() && parseCharacter(c);
+            case State::Literal:
+                if (c >= 'a' && c <= 'z') {
+                    return appendToken(c);
+                }
+                return completeLiteral() && parseCharacter(c);
+            default:
+                break;
+        }
+
+        if (c == ' ' || c == '\t' || c == '\n' || c == '\r') {
+            return true;
+        }
+
+        switch (state) {
+            case State::Value:
+                return startValue(c);
+            case State::ValueOrArrayEnd:
+                if (c == ']') {
+                    depth--;
+                    listener.onArrayEnd();
+                    return completeValue();
+                }
+                return startValue(c);
+            case State::KeyOrObjectEnd:
+                if (c == '}') {
+                    depth--;
+                    listener.onObjectEnd();
+                    return completeValue();
+                }
+                // Fall through
+            case State::Key:
+                if (c != '"') return fail("Expected object key");
+                tokenLength = 0;
+                isKey = true;
+                state = State::String;
+                return true;
+            case State::Colon:
+                if (c != ':') return fail("Expected ':'");
+                state = State::Value;
+                return true;
+            case State::CommaOrEnd: {
+                bool isObject = containers[depth - 1];
+                if (c == ',') {
+                    state = isObject ? State::Key : State::Value;
+                    return true;
+                } else if (isObject && c == '}') {
+                    depth--;
+                    listener.onObjectEnd();
+                    return completeValue();
+                } else if (!isObject && c == ']') {
+                    depth--;
+                    listener.onArrayEnd();
+                    return completeValue();
+                }
+                return fail(isObject ? "Expected ',' or '}'" : "Expected ',' or ']'");
+            }
+            case State::Done:
+                return fail("Unexpected data after end of document");
+            default:
+                return fail("Invalid parser state");
+        }
+    }
+
+    bool JsonStreamParser::startValue(char c) {
+        tokenLength = 0;
+        if (c == '{' || c == '[') {
+            if (depth >= MAX_DEPTH) return fail("Maximum nesting depth exceeded");
+            bool isObject = c == '{';
+            containers[depth++] = isObject;
+            if (isObject) {
+                listener.onObjectStart();
+                state = State::KeyOrObjectEnd;
+            } else {
+                listener.onArrayStart();
+                state = State::ValueOrArrayEnd;
+            }
+            return true;
+        } else if (c == '"') {
+            isKey = false;
+            state = State::String;
+            return true;
+        } else if ((c >= '0' && c <= '9') || c == '-') {
+            isFloat = false;
+            state = State::Number;
+            return appendToken(c);
+        } else if (c >= 'a' && c <= 'z') {
+            state = State::Literal;
+            return appendToken(c);
+        }
+        return fail("Unexpected character");
+    }
+
+    bool JsonStreamParser::appendToken(char c) {
+        if (tokenLength >= MAX_TOKEN_LENGTH - 1) {
+            return fail("Token too long");
+        }
+        token[tokenLength++] = c;
+        return true;
+    }
+
+    bool JsonStreamParser::appendCodepoint(uint16_t codepoint) {
+        if (codepoint < 0x80) {
+            return appendToken((char)codepoint);
+        } else if (codepoint < 0x800) {
+            return appendToken((char)(0xC0 | (codepoint >> 6)))
+                && appendToken((char)(0x80 | (codepoint & 0x3F)));
+        }
+        return appendToken((char)(0xE0 | (codepoint >> 12)))
+            && appendToken((char)(0x80 | ((codepoint >> 6) & 0x3F)))
+            && appendToken((char)(0x80 | (codepoint & 0x3F)));
+    }
+
+    bool JsonStreamParser::completeValue() {
+        state = depth == 0 ? State::Done : State::CommaOrEnd;
+        return true;
+    }
+
+    bool JsonStreamParser::completeNumber() {
+        token[tokenLength] = '\0';
+        char* end = nullptr;
+        strtod(token, &end);
+        if (tokenLength == 0 || end != token + tokenLength) {
+            return fail("Invalid number");
+        }
+        listener.onValue(isFloat ? JsonStreamListener::ValueType::Float : JsonStreamListener::ValueType::Integer, token);
+        return completeValue();
+    }
+
+    bool JsonStreamParser::completeLiteral() {
+        token[tokenLength] = '\0';
+        if (strcmp(token, "true") == 0 || strcmp(token, "false") == 0) {
+            listener.onValue(JsonStreamListener::ValueType::Bool, token);
+        } else if (strcmp(token, "null") == 0) {
+            listener.onValue(JsonStreamListener::ValueType::Null, token);
+        } else {
+            return fail("Invalid literal");
+        }
+        return completeValue();
+    }
+}
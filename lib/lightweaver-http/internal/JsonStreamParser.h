@@ -0,0 +1,101 @@
+#pragma once
+#include <Arduino.h>
+
+namespace LightWeaver {
+    /**
+     * Receives the tokens produced by a JsonStreamParser
+     * Strings passed to the listener are only valid for the duration of the call
+     */
+    class JsonStreamListener {
+        public:
+            enum class ValueType {
+                String,
+                Integer,
+                Float,
+                Bool,
+                Null
+            };
+
+            virtual ~JsonStreamListener() {}
+
+            virtual void onObjectStart() = 0;
+            virtual void onObjectEnd() = 0;
+            virtual void onArrayStart() = 0;
+            virtual void onArrayEnd() = 0;
+            virtual void onKey(const char* key) = 0;
+            virtual void onValue(ValueType type, const char* value) = 0;
+    };
+
+    /**
+     * Incremental JSON tokenizer
+     * Input can be provided in arbitrarily sized chunks (such as HTTP body segments as they arrive)
+     * and each token is reported to the listener as soon as it is complete. Memory use is fixed by
+     * the maximum nesting depth and token length, regardless of the size of the document.
+     */
+    class JsonStreamParser {
+        public:
+            static const uint8_t MAX_DEPTH = 16;
+            static const uint8_t MAX_TOKEN_LENGTH = 64;
+
+            enum class Status {
+                Parsing,
+                Complete,
+                Error
+            };
+        private:
+            enum class State {
+                Value,
+                ValueOrArrayEnd,
+                Key,
+                KeyOrObjectEnd,
+                Colon,
+                CommaOrEnd,
+                String,
+                StringEscape,
+                StringUnicode,
+                Number,
+                Literal,
+                Done
+            };
+
+            JsonStreamListener& listener;
+            State state = State::Value;
+            Status status = Status::Parsing;
+            const char* error = nullptr;
+
+            // Whether each open container is an object (true) or an array (false)
+            bool containers[MAX_DEPTH];
+            uint8_t depth = 0;
+
+            char token[MAX_TOKEN_LENGTH];
+            uint8_t tokenLength = 0;
+            bool isKey = false;
+            bool isFloat = false;
+            uint16_t unicodeValue = 0;
+            uint8_t unicodeDigits = 0;
+
+            bool parseCharacter(char c);
+            bool startValue(char c);
+            bool appendToken(char c);
+            bool appendCodepoint(uint16_t codepoint);
+            bool completeValue();
+            bool completeNumber();
+            bool completeLiteral();
+            bool fail(const char* reason);
+        public:
+            JsonStreamParser(JsonStreamListener& listener): listener(listener) {}
+
+            // Consumes the next chunk of the document
+            Status write(const uint8_t* data, size_t length);
+            // Signals that the document has ended, flushing any trailing top-level number
+            Status finish();
+
+            Status getStatus() const {
+                return status;
+            }
+
+            const char* getError() const {
+                return error;
+            }
+    };
+}
@@ -0,0 +1,51 @@
+#include "PixelMapDeserializer.h"
+
+namespace LightWeaver {
+    PixelMapDeserializer::Result PixelMapDeserializer::deserialize(const JsonVariant& obj) {
+        JsonVariant spans = obj["spans"];
+        if (spans.isNull()) {
+            return Result::withError("Required fields missing: spans");
+        }
+        if (!spans.is<JsonArray>() || spans.size() > PixelMap::MAXIMUM_SPANS) {
+            return Result::withError("Invalid value for fields: spans");
+        }
+
+        const uint8_t count = spans.size();
+        if (count == 0) {
+            return Result::withSuccess(nullptr);
+        }
+
+        PixelSpan spanList[PixelMap::MAXIMUM_SPANS];
+        for (uint8_t i = 0; i < count; i++) {
+            JsonVariant span = spans.getElement(i);
+            String fieldName = "spans." + String(i) + ".";
+            JsonVariant length = span["length"];
+            JsonVariant start = span["start"];
+            JsonVariant groupSize = span["groupSize"];
+            JsonVariant reversed = span["reversed"];
+
+            if (length.isNull() || start.isNull()) {
+                return Result::withError("Required fields missing: " + fieldName + "length, " + fieldName + "start");
+            }
+            if (!length.is<uint16_t>() || length.as<uint16_t>() == 0) {
+                return Result::withError("Invalid value for fields: " + fieldName + "length");
+            }
+            if (!start.is<uint16_t>()) {
+                return Result::withError("Invalid value for fields: " + fieldName + "start");
+            }
+            if (!groupSize.isNull() && (!groupSize.is<uint8_t>() || groupSize.as<uint8_t>() == 0)) {
+                return Result::withError("Invalid value for fields: " + fieldName + "groupSize");
+            }
+            if (!reversed.isNull() && !reversed.is<bool>()) {
+                return Result::withError("Invalid value for fields: " + fieldName + "reversed");
+            }
+
+            spanList[i].length = length;
+            spanList[i].physicalStart = start;
+            spanList[i].groupSize = groupSize.isNull() ? 1 : groupSize.as<uint8_t>();
+            spanList[i].isReversed = reversed.isNull() ? false : reversed.as<bool>();
+        }
+
+        return Result::withSuccess(std::unique_ptr<PixelMap>{new PixelMap(PixelMap::withSpans(count, spanList))});
+    }
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include <memory>
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <LightWeaver/PixelMap.h>
+
+namespace LightWeaver {
+    /**
+     * Deserializes a pixel map as a list of spans, e.g.
+     *   {"spans": [{"length": 30, "start": 0}, {"length": 30, "start": 30, "reversed": true}]}
+     * groupSize defaults to 1 and reversed to false. An empty list restores the default map.
+     */
+    class PixelMapDeserializer {
+        public:
+            struct Result {
+                public:
+                    bool success;
+                    // Null when the default map is requested
+                    std::unique_ptr<PixelMap> value;
+                    String error;
+                private:
+                    Result(std::unique_ptr<PixelMap> value):
+                        success(true),
+                        value(std::move(value)) {};
+
+                    Result(String error):
+                        success(false),
+                        error(error) {};
+                public:
+                    static Result withSuccess(std::unique_ptr<PixelMap> pixelMap) {
+                        return Result(std::move(pixelMap));
+                    }
+
+                    static Result withError(const String error) {
+                        return Result(error);
+                    }
+
+                    operator bool () const {
+                        return success;
+                    }
+            };
+
+            static Result deserialize(const JsonVariant& obj);
+    };
+}
@@ -0,0 +1,15 @@
+#include "PixelMapSerializer.h"
+
+namespace LightWeaver {
+    void PixelMapSerializer::serialize(const PixelMap& pixelMap, JsonVariant obj) {
+        JsonArray spans = obj.createNestedArray("spans");
+        for (uint8_t i = 0; i < pixelMap.getSpanCount(); i++) {
+            const PixelSpan& span = pixelMap.getSpans()[i];
+            JsonObject spanObj = spans.createNestedObject();
+            spanObj["length"] = span.length;
+            spanObj["start"] = span.physicalStart;
+            spanObj["groupSize"] = span.groupSize;
+            spanObj["reversed"] = span.isReversed;
+        }
+    }
+}
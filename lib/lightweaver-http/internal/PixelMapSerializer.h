@@ -0,0 +1,14 @@
+#pragma once
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <LightWeaver/PixelMap.h>
+
+namespace LightWeaver {
+    /**
+     * Serializes a pixel map to JSON in the format accepted by PixelMapDeserializer
+     */
+    class PixelMapSerializer {
+        public:
+            static void serialize(const PixelMap& pixelMap, JsonVariant obj);
+    };
+}
@@ -0,0 +1,133 @@
+#include "PresetDeserializer.h"
+
+/**
+ * The document is {"id": 1, "name": "...", "colorSource": {...}}, where the fields are at depth 1. Anything else
+ * in the document is ignored.
+ */
+namespace LightWeaver {
+    void PresetDeserializer::onContainerStart() {
+        if (depth != 1) return;
+
+        if (key == "id") {
+            hasId = true;
+            isIdValid = false;
+        } else if (key == "name") {
+            hasName = true;
+            isNameValid = false;
+        } else if (key == "colorSource") {
+            hasColorSource = true;
+            colorSource.reset();
+            colorSourceError = "";
+        }
+    }
+
+    void PresetDeserializer::onObjectStart() {
+        if (colorSourceDeserializer) {
+            colorSourceDeserializer->getListener().onObjectStart();
+            return;
+        }
+
+        onContainerStart();
+        if (depth == 1 && key == "colorSource") {
+            // The ColorSource tracks its own nesting, so depth is left as it is until the ColorSource has ended
+            colorSourceDeserializer = std::unique_ptr<StreamingColorSourceDeserializer>{new StreamingColorSourceDeserializer()};
+            colorSourceDeserializer->getListener().onObjectStart();
+            return;
+        }
+        depth++;
+        key = "";
+    }
+
+    void PresetDeserializer::onObjectEnd() {
+        if (colorSourceDeserializer) {
+            colorSourceDeserializer->getListener().onObjectEnd();
+            if (colorSourceDeserializer->isComplete()) {
+                StreamingColorSourceDeserializer::Result result = colorSourceDeserializer->getResult();
+                if (result) {
+                    colorSource = std::move(result.value);
+                } else {
+                    colorSourceError = result.error;
+                }
+                colorSourceDeserializer.reset();
+            }
+            return;
+        }
+
+        depth--;
+        key = "";
+    }
+
+    void PresetDeserializer::onArrayStart() {
+        if (colorSourceDeserializer) {
+            colorSourceDeserializer->getListener().onArrayStart();
+            return;
+        }
+
+        onContainerStart();
+        depth++;
+        key = "";
+    }
+
+    void PresetDeserializer::onArrayEnd() {
+        if (colorSourceDeserializer) {
+            colorSourceDeserializer->getListener().onArrayEnd();
+            return;
+        }
+
+        depth--;
+        key = "";
+    }
+
+    void PresetDeserializer::onKey(const char* key) {
+        if (colorSourceDeserializer) {
+            colorSourceDeserializer->getListener().onKey(key);
+            return;
+        }
+        this->key = key;
+    }
+
+    void PresetDeserializer::onValue(ValueType type, const char* value) {
+        if (colorSourceDeserializer) {
+            colorSourceDeserializer->getListener().onValue(type, value);
+            return;
+        }
+
+        if (depth == 1 && key == "id") {
+            hasId = type != ValueType::Null;
+            isIdValid = type == ValueType::Integer && value[0] != '-' && strtoul(value, nullptr, 10) <= 0xFF;
+            id = isIdValid ? strtoul(value, nullptr, 10) : 0;
+        } else if (depth == 1 && key == "name") {
+            hasName = type != ValueType::Null;
+            isNameValid = type == ValueType::String;
+            name = isNameValid ? value : "";
+        } else if (depth == 1 && key == "colorSource") {
+            // A null ColorSource saves the current ColorSource, as if it was left out
+            hasColorSource = type != ValueType::Null;
+            colorSource.reset();
+            colorSourceError = "";
+        }
+    }
+
+    bool PresetDeserializer::write(const uint8_t* data, size_t length) {
+        return parser.write(data, length) != JsonStreamParser::Status::Error;
+    }
+
+    PresetDeserializer::Result PresetDeserializer::finish() {
+        if (parser.finish() == JsonStreamParser::Status::Error) {
+            return Result::withError(String("Invalid JSON: ") + parser.getError());
+        }
+        if (!hasId || !hasName) {
+            return Result::withError("Required fields missing: id, name");
+        }
+        if (!isIdValid || !isNameValid) {
+            return Result::withError("Invalid value for fields: id, name");
+        }
+        if (colorSourceError.length() > 0) {
+            return Result::withError("colorSource: " + colorSourceError);
+        }
+        if (hasColorSource && !colorSource) {
+            return Result::withError("Invalid value for fields: colorSource");
+        }
+        return Result::withSuccess(id, name, std::move(colorSource));
+    }
+}
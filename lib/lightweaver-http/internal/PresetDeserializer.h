@@ -0,0 +1,83 @@
+#pragma once
+#include <memory>
+#include <Arduino.h>
+#include <LightWeaver/ColorSource.h>
+
+#include "JsonStreamParser.h"
+#include "StreamingColorSourceDeserializer.h"
+
+namespace LightWeaver {
+    /**
+     * Deserializes the id and name of a preset and an optional ColorSource to save in it, from a JSON document
+     * that arrives in chunks. The tokens of the ColorSource are passed to a StreamingColorSourceDeserializer
+     * as they are parsed, so the request is never held in memory.
+     */
+    class PresetDeserializer : private JsonStreamListener {
+        public:
+            struct Result {
+                public:
+                    bool success;
+                    uint8_t id;
+                    String name;
+                    // nullptr if the document has no ColorSource
+                    std::unique_ptr<ColorSource> colorSource;
+                    String error;
+                private:
+                    Result(uint8_t id, const String& name, std::unique_ptr<ColorSource> colorSource):
+                        success(true),
+                        id(id),
+                        name(name),
+                        colorSource(std::move(colorSource)) {};
+
+                    Result(String error):
+                        success(false),
+                        id(0),
+                        colorSource(nullptr),
+                        error(error) {};
+                public:
+                    static Result withSuccess(uint8_t id, const String& name, std::unique_ptr<ColorSource> colorSource) {
+                        return Result(id, name, std::move(colorSource));
+                    }
+
+                    static Result withError(const String error) {
+                        return Result(error);
+                    }
+
+                    operator bool () const {
+                        return success;
+                    }
+            };
+        private:
+            JsonStreamParser parser{*this};
+            // Number of objects and arrays open in the document, not counting those inside of the ColorSource
+            uint8_t depth = 0;
+            String key;
+            bool hasId = false;
+            bool isIdValid = false;
+            uint8_t id = 0;
+            bool hasName = false;
+            bool isNameValid = false;
+            String name;
+            bool hasColorSource = false;
+            // Set while the tokens of the ColorSource object are being passed on to it
+            std::unique_ptr<StreamingColorSourceDeserializer> colorSourceDeserializer;
+            std::unique_ptr<ColorSource> colorSource;
+            String colorSourceError;
+
+            // Resets the field whose value is the object or array starting at the current key
+            void onContainerStart();
+
+            virtual void onObjectStart();
+            virtual void onObjectEnd();
+            virtual void onArrayStart();
+            virtual void onArrayEnd();
+            virtual void onKey(const char* key);
+            virtual void onValue(ValueType type, const char* value);
+        public:
+            PresetDeserializer() {}
+
+            // Consumes the next chunk of the document, returning false once the document is known to be invalid
+            bool write(const uint8_t* data, size_t length);
+            Result finish();
+    };
+}
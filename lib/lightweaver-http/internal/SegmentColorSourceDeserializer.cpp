@@ -0,0 +1,124 @@
+#include "SegmentColorSourceDeserializer.h"
+
+/**
+ * The document is {"id": 1, "colorSource": {...}}, where the fields are at depth 1. Anything else in the
+ * document is ignored.
+ */
+namespace LightWeaver {
+    void SegmentColorSourceDeserializer::onObjectStart() {
+        if (colorSourceDeserializer) {
+            colorSourceDeserializer->getListener().onObjectStart();
+            return;
+        }
+
+        if (depth == 1 && key == "id") {
+            hasId = true;
+            isIdValid = false;
+        } else if (depth == 1 && key == "colorSource") {
+            // The ColorSource tracks its own nesting, so depth is left as it is until the ColorSource has ended
+            hasColorSource = true;
+            colorSource.reset();
+            colorSourceError = "";
+            colorSourceDeserializer = std::unique_ptr<StreamingColorSourceDeserializer>{new StreamingColorSourceDeserializer()};
+            colorSourceDeserializer->getListener().onObjectStart();
+            return;
+        }
+        depth++;
+        key = "";
+    }
+
+    void SegmentColorSourceDeserializer::onObjectEnd() {
+        if (colorSourceDeserializer) {
+            colorSourceDeserializer->getListener().onObjectEnd();
+            if (colorSourceDeserializer->isComplete()) {
+                StreamingColorSourceDeserializer::Result result = colorSourceDeserializer->getResult();
+                if (result) {
+                    colorSource = std::move(result.value);
+                } else {
+                    colorSourceError = result.error;
+                }
+                colorSourceDeserializer.reset();
+            }
+            return;
+        }
+
+        depth--;
+        key = "";
+    }
+
+    void SegmentColorSourceDeserializer::onArrayStart() {
+        if (colorSourceDeserializer) {
+            colorSourceDeserializer->getListener().onArrayStart();
+            return;
+        }
+
+        if (depth == 1 && key == "id") {
+            hasId = true;
+            isIdValid = false;
+        } else if (depth == 1 && key == "colorSource") {
+            hasColorSource = true;
+            colorSource.reset();
+            colorSourceError = "";
+        }
+        depth++;
+        key = "";
+    }
+
+    void SegmentColorSourceDeserializer::onArrayEnd() {
+        if (colorSourceDeserializer) {
+            colorSourceDeserializer->getListener().onArrayEnd();
+            return;
+        }
+
+        depth--;
+        key = "";
+    }
+
+    void SegmentColorSourceDeserializer::onKey(const char* key) {
+        if (colorSourceDeserializer) {
+            colorSourceDeserializer->getListener().onKey(key);
+            return;
+        }
+        this->key = key;
+    }
+
+    void SegmentColorSourceDeserializer::onValue(ValueType type, const char* value) {
+        if (colorSourceDeserializer) {
+            colorSourceDeserializer->getListener().onValue(type, value);
+            return;
+        }
+
+        if (depth == 1 && key == "id") {
+            hasId = type != ValueType::Null;
+            isIdValid = type == ValueType::Integer && value[0] != '-' && strtoul(value, nullptr, 10) <= 0xFF;
+            id = isIdValid ? strtoul(value, nullptr, 10) : 0;
+        } else if (depth == 1 && key == "colorSource") {
+            hasColorSource = type != ValueType::Null;
+            colorSource.reset();
+            colorSourceError = "";
+        }
+    }
+
+    bool SegmentColorSourceDeserializer::write(const uint8_t* data, size_t length) {
+        return parser.write(data, length) != JsonStreamParser::Status::Error;
+    }
+
+    SegmentColorSourceDeserializer::Result SegmentColorSourceDeserializer::finish() {
+        if (parser.finish() == JsonStreamParser::Status::Error) {
+            return Result::withError(String("Invalid JSON: ") + parser.getError());
+        }
+        if (!hasId || !hasColorSource) {
+            return Result::withError("Required fields missing: id, colorSource");
+        }
+        if (!isIdValid) {
+            return Result::withError("Invalid value for fields: id");
+        }
+        if (colorSourceError.length() > 0) {
+            return Result::withError("colorSource: " + colorSourceError);
+        }
+        if (!colorSource) {
+            return Result::withError("Invalid value for fields: colorSource");
+        }
+        return Result::withSuccess(id, std::move(colorSource));
+    }
+}
@@ -0,0 +1,743 @@
+#include <algorithm>
+#include <vector>
+#include <string.h>
+#include <LightWeaver/colorSources/SolidColorSource.h>
+#include <LightWeaver/colorSources/FadeColorSource.h>
+#include <LightWeaver/colorSources/OverlayColorSource.h>
+#include <LightWeaver/colorSources/GradientColorSource.h>
+#include <LightWeaver/colorSources/HsvMeanderColorSource.h>
+#include "StreamingColorSourceDeserializer.h"
+
+/**
+ * Frame Types
+ * Each JSON object or array being parsed is represented by a Frame, which collects the values nested directly
+ * inside of it. When the object or array ends the frame validates what it received (following the same rules as
+ * ColorSourceDeserializer) and writes the result into a destination owned by its parent frame.
+ */
+namespace LightWeaver {
+    namespace {
+        typedef JsonStreamListener::ValueType ValueType;
+
+        struct Errors {
+            StringListBuilder& missingFields;
+            StringListBuilder& invalidFields;
+        };
+
+        struct Scalar {
+            ValueType type = ValueType::Null;
+            String text;
+
+            Scalar() {}
+            Scalar(ValueType type, const char* text): type(type), text(text) {}
+
+            bool isNull() const { return type == ValueType::Null; }
+            bool isString() const { return type == ValueType::String; }
+            bool isBool() const { return type == ValueType::Bool; }
+            bool isFloat() const { return type == ValueType::Integer || type == ValueType::Float; }
+            bool isUInt8() const { return isUnsigned(0xFF); }
+            bool isUInt16() const { return isUnsigned(0xFFFF); }
+            bool isUInt32() const { return isUnsigned(0xFFFFFFFF); }
+
+            bool isUnsigned(uint32_t max) const {
+                return type == ValueType::Integer && text.charAt(0) != '-' && strtoull(text.c_str(), nullptr, 10) <= max;
+            }
+
+            uint32_t asUnsigned(uint32_t fallback) const {
+                return type == ValueType::Integer ? strtoul(text.c_str(), nullptr, 10) : fallback;
+            }
+
+            float asFloat(float fallback) const {
+                return isFloat() ? strtod(text.c_str(), nullptr) : fallback;
+            }
+
+            bool asBool(bool fallback) const {
+                return isBool() ? text == "true" : fallback;
+            }
+        };
+
+        struct ColorField {
+            bool present = false;
+            RgbaColor value;
+        };
+
+        struct EasingField {
+            bool present = false;
+            EasingFunction value = Easing::Linear;
+        };
+
+        struct GradientField {
+            bool present = false;
+            std::unique_ptr<Gradient> value;
+        };
+
+        struct PixelOffsetField {
+            std::unique_ptr<PixelOffsetConfig> value;
+        };
+
+        // Collects offsets in fixed size blocks, so that the list is never copied as it grows, and is then
+        // copied once into the exactly sized list that the PixelOffsetConfig takes ownership of
+        struct OffsetBlocks {
+            static const uint16_t BLOCK_SIZE = 64;
+            // Offsets past the largest list a PixelOffsetConfig can hold are counted but not kept
+            static const uint32_t MAXIMUM_COUNT = 0xFFFF;
+
+            std::vector<std::unique_ptr<float[]>> blocks;
+            uint32_t count = 0;
+
+            void add(float offset) {
+                if (count < MAXIMUM_COUNT) {
+                    if (count % BLOCK_SIZE == 0) {
+                        blocks.emplace_back(new float[BLOCK_SIZE]);
+                    }
+                    blocks.back()[count % BLOCK_SIZE] = offset;
+                }
+                count++;
+            }
+
+            // Frees each block once it has been copied
+            std::unique_ptr<float[]> release() {
+                std::unique_ptr<float[]> offsets{count > 0 ? new float[count] : nullptr};
+                for (size_t i = 0; i < blocks.size(); i++) {
+                    uint32_t start = i * BLOCK_SIZE;
+                    memcpy(offsets.get() + start, blocks[i].get(), sizeof(float) * std::min<uint32_t>(BLOCK_SIZE, count - start));
+                    blocks[i].reset();
+                }
+                std::vector<std::unique_ptr<float[]>>().swap(blocks);
+                return offsets;
+            }
+        };
+
+        struct ColorSourceField {
+            bool present = false;
+            std::unique_ptr<ColorSource> value;
+        };
+    }
+
+    struct StreamingColorSourceDeserializer::Frame {
+        Frame* const parent;
+        const StringListBuilder fieldName;
+
+        Frame(Frame* parent, const StringListBuilder& fieldName): parent(parent), fieldName(fieldName) {}
+        virtual ~Frame() {}
+
+        // The key is empty for the elements of an array
+        virtual void onValue(const String& key, const Scalar& value, Errors& errors) {}
+        virtual Frame* onObject(const String& key, Errors& errors);
+        virtual Frame* onArray(const String& key, Errors& errors);
+        // Called after a nested frame returned from onObject/onArray has ended
+        virtual void onChildEnd(Errors& errors) {}
+        virtual void onEnd(Errors& errors) {}
+
+        bool requiredField(const Scalar& field, const char* name, bool (Scalar::*isType)() const, Errors& errors) const {
+            if (field.isNull()) {
+                errors.missingFields += fieldName + name;
+                return false;
+            } else if (!(field.*isType)()) {
+                errors.invalidFields += fieldName + name;
+                return false;
+            }
+            return true;
+        }
+
+        bool optionalField(const Scalar& field, const char* name, bool (Scalar::*isType)() const, Errors& errors) const {
+            if (!field.isNull() && !(field.*isType)()) {
+                errors.invalidFields += fieldName + name;
+                return false;
+            }
+            return true;
+        }
+
+        void deserializeColor(const Scalar& value, const String& name, ColorField& color, Errors& errors) const {
+            if (value.isNull()) return;
+            color.present = true;
+            if (!value.isString() || !ColorSourceDeserializer::deserializeHexColor(value.text, color.value)) {
+                errors.invalidFields += fieldName + name;
+                color.value = RgbaColor();
+            }
+        }
+
+        void deserializeEasing(const Scalar& value, const String& name, EasingField& easing, Errors& errors) const {
+            if (value.isNull()) return;
+            easing.present = true;
+            EasingFunction function = value.isString() ? ColorSourceDeserializer::deserializeEasingFunctionFromName(value.text) : nullptr;
+            if (!function) {
+                errors.invalidFields += fieldName + name;
+                return;
+            }
+            easing.value = function;
+        }
+    };
+
+    namespace {
+        typedef StreamingColorSourceDeserializer::Frame Frame;
+
+        // Discards everything nested inside of an unrecognized field
+        struct IgnoredFrame : public Frame {
+            IgnoredFrame(Frame* parent): Frame(parent, StringListBuilder(".", "")) {}
+
+            virtual Frame* onObject(const String& key, Errors& errors) { return new IgnoredFrame(this); }
+            virtual Frame* onArray(const String& key, Errors& errors) { return new IgnoredFrame(this); }
+        };
+
+        struct ColorFrame : public Frame {
+            ColorField& color;
+            Scalar red;
+            Scalar green;
+            Scalar blue;
+            Scalar hue;
+            Scalar saturation;
+            Scalar value;
+            Scalar lightness;
+            Scalar alpha;
+
+            ColorFrame(Frame* parent, const StringListBuilder& fieldName, ColorField& color): Frame(parent, fieldName), color(color) {}
+
+            virtual void onValue(const String& key, const Scalar& scalar, Errors& errors) {
+                if (key == "red") red = scalar;
+                else if (key == "green") green = scalar;
+                else if (key == "blue") blue = scalar;
+                else if (key == "hue") hue = scalar;
+                else if (key == "saturation") saturation = scalar;
+                else if (key == "value") value = scalar;
+                else if (key == "lightness") lightness = scalar;
+                else if (key == "alpha") alpha = scalar;
+            }
+
+            virtual void onEnd(Errors& errors) {
+                color.present = true;
+                uint8_t a = alpha.asUnsigned(255);
+                if (!red.isNull() || !green.isNull() || !blue.isNull()) {
+                    requiredField(red, "red", &Scalar::isUInt8, errors);
+                    requiredField(green, "green", &Scalar::isUInt8, errors);
+                    requiredField(blue, "blue", &Scalar::isUInt8, errors);
+                    optionalField(alpha, "alpha", &Scalar::isUInt8, errors);
+                    color.value = RgbaColor(red.asUnsigned(0), green.asUnsigned(0), blue.asUnsigned(0), a);
+                } else if (!lightness.isNull()) { // Only consider it HSL if lightness is present, otherwise assume HSV
+                    requiredField(hue, "hue", &Scalar::isFloat, errors);
+                    requiredField(saturation, "saturation", &Scalar::isFloat, errors);
+                    requiredField(lightness, "lightness", &Scalar::isFloat, errors);
+                    optionalField(alpha, "alpha", &Scalar::isUInt8, errors);
+                    color.value = HslaColor(hue.asFloat(0.0f), saturation.asFloat(0.0f), lightness.asFloat(0.0f), a);
+                } else if (!value.isNull() || !hue.isNull() || !saturation.isNull()) { // Treat HSV as the default over HSL
+                    requiredField(hue, "hue", &Scalar::isFloat, errors);
+                    requiredField(saturation, "saturation", &Scalar::isFloat, errors);
+                    requiredField(value, "value", &Scalar::isFloat, errors);
+                    optionalField(alpha, "alpha", &Scalar::isUInt8, errors);
+                    color.value = HsvaColor(hue.asFloat(0.0f), saturation.asFloat(0.0f), value.asFloat(0.0f), a);
+                } else {
+                    errors.invalidFields += fieldName;
+                }
+            }
+        };
+
+        struct EasingFrame : public Frame {
+            EasingField& easing;
+            Scalar name;
+            EasingField innerEasing;
+
+            EasingFrame(Frame* parent, const StringListBuilder& fieldName, EasingField& easing): Frame(parent, fieldName), easing(easing) {}
+
+            virtual void onValue(const String& key, const Scalar& value, Errors& errors) {
+                if (key == "name") name = value;
+                else if (key == "easing") deserializeEasing(value, key, innerEasing, errors);
+            }
+
+            virtual Frame* onObject(const String& key, Errors& errors) {
+                if (key == "easing") return new EasingFrame(this, fieldName + key, innerEasing);
+                return Frame::onObject(key, errors);
+            }
+
+            virtual void onEnd(Errors& errors) {
+                easing.present = true;
+                if (!requiredField(name, "name", &Scalar::isString, errors)) return;
+
+                if (name.text == "Mirror") {
+                    easing.value = Easing::Mirror(innerEasing.value);
+                } else if (name.text == "Reverse") {
+                    easing.value = Easing::Reverse(innerEasing.value);
+                } else {
+                    deserializeEasing(name, "name", easing, errors);
+                }
+            }
+        };
+
+        // Accumulates the elements of an array of colors
+        struct ColorListFrame : public Frame {
+            std::vector<RgbaColor>& colors;
+            ColorField element;
+
+            ColorListFrame(Frame* parent, const StringListBuilder& fieldName, std::vector<RgbaColor>& colors): Frame(parent, fieldName), colors(colors) {}
+
+            String elementName() const {
+                return String((unsigned)colors.size());
+            }
+
+            virtual void onValue(const String& key, const Scalar& value, Errors& errors) {
+                element = ColorField();
+                if (value.isNull()) {
+                    errors.missingFields += fieldName + elementName();
+                }
+                deserializeColor(value, elementName(), element, errors);
+                colors.push_back(element.value);
+            }
+
+            virtual Frame* onObject(const String& key, Errors& errors) {
+                element = ColorField();
+                return new ColorFrame(this, fieldName + elementName(), element);
+            }
+
+            virtual Frame* onArray(const String& key, Errors& errors) {
+                errors.invalidFields += fieldName + elementName();
+                // The placeholder is pushed by onChildEnd() once the array has been skipped
+                element = ColorField();
+                return Frame::onArray(key, errors);
+            }
+
+            virtual void onChildEnd(Errors& errors) {
+                colors.push_back(element.value);
+            }
+        };
+
+        // Accumulates the entries of an object mapping gradient positions to colors
+        struct ColorPositionFrame : public Frame {
+            std::vector<RgbaColor>& colors;
+            std::vector<uint8_t>& positions;
+            ColorField element;
+
+            ColorPositionFrame(Frame* parent, const StringListBuilder& fieldName, std::vector<RgbaColor>& colors, std::vector<uint8_t>& positions):
+                Frame(parent, fieldName), colors(colors), positions(positions) {}
+
+            virtual void onValue(const String& key, const Scalar& value, Errors& errors) {
+                element = ColorField();
+                if (value.isNull()) {
+                    errors.missingFields += fieldName + key;
+                }
+                deserializeColor(value, key, element, errors);
+                positions.push_back(key.toInt());
+                colors.push_back(element.value);
+            }
+
+            virtual Frame* onObject(const String& key, Errors& errors) {
+                element = ColorField();
+                positions.push_back(key.toInt());
+                return new ColorFrame(this, fieldName + key, element);
+            }
+
+            virtual Frame* onArray(const String& key, Errors& errors) {
+                errors.invalidFields += fieldName + key;
+                positions.push_back(key.toInt());
+                element = ColorField();
+                return Frame::onArray(key, errors);
+            }
+
+            virtual void onChildEnd(Errors& errors) {
+                colors.push_back(element.value);
+            }
+        };
+
+        struct GradientFrame : public Frame {
+            GradientField& gradient;
+            bool hasColors = false;
+            std::vector<RgbaColor> colors;
+            std::vector<uint8_t> positions;
+            EasingField easing;
+
+            GradientFrame(Frame* parent, const StringListBuilder& fieldName, GradientField& gradient): Frame(parent, fieldName), gradient(gradient) {}
+
+            virtual void onValue(const String& key, const Scalar& value, Errors& errors) {
+                if (key == "colors" && !value.isNull()) {
+                    hasColors = true;
+                    errors.invalidFields += fieldName + key;
+                } else if (key == "easing") {
+                    deserializeEasing(value, key, easing, errors);
+                }
+            }
+
+            virtual Frame* onObject(const String& key, Errors& errors) {
+                if (key == "colors") {
+                    hasColors = true;
+                    return new ColorPositionFrame(this, fieldName + key, colors, positions);
+                } else if (key == "easing") {
+                    return new EasingFrame(this, fieldName + key, easing);
+                }
+                return Frame::onObject(key, errors);
+            }
+
+            virtual Frame* onArray(const String& key, Errors& errors) {
+                if (key == "colors") {
+                    hasColors = true;
+                    return new ColorListFrame(this, fieldName + key, colors);
+                }
+                return Frame::onArray(key, errors);
+            }
+
+            virtual void onEnd(Errors& errors) {
+                gradient.present = true;
+                if (!hasColors) {
+                    errors.missingFields += fieldName + "colors";
+                } else if (colors.empty() || colors.size() > 0xFF) {
+                    errors.invalidFields += fieldName + "colors";
+                    colors.clear();
+                    positions.clear();
+                }
+
+                ColorSet colorSet{(uint8_t)colors.size(), colors.data()};
+                gradient.value = std::unique_ptr<Gradient>{new Gradient(colorSet, positions.empty() ? nullptr : positions.data(), easing.value)};
+            }
+        };
+
+        // Accumulates a list of pixel offsets, which may contain an entry for every pixel of a long strip
+        struct OffsetListFrame : public Frame {
+            OffsetBlocks& offsets;
+
+            OffsetListFrame(Frame* parent, const StringListBuilder& fieldName, OffsetBlocks& offsets): Frame(parent, fieldName), offsets(offsets) {}
+
+            virtual void onValue(const String& key, const Scalar& value, Errors& errors) {
+                String elementName = String((unsigned)offsets.count);
+                if (value.isNull()) {
+                    errors.missingFields += fieldName + elementName;
+                } else if (!value.isFloat()) {
+                    errors.invalidFields += fieldName + elementName;
+                }
+                offsets.add(value.asFloat(0.0f));
+            }
+
+            virtual Frame* onObject(const String& key, Errors& errors) {
+                errors.invalidFields += fieldName + String((unsigned)offsets.count);
+                offsets.add(0.0f);
+                return Frame::onObject(key, errors);
+            }
+
+            virtual Frame* onArray(const String& key, Errors& errors) {
+                errors.invalidFields += fieldName + String((unsigned)offsets.count);
+                offsets.add(0.0f);
+                return Frame::onArray(key, errors);
+            }
+        };
+
+        struct PixelOffsetFrame : public Frame {
+            PixelOffsetField& pixelOffsets;
+            Scalar type;
+            Scalar scale;
+            bool hasOffsets = false;
+            OffsetBlocks offsets;
+
+            PixelOffsetFrame(Frame* parent, const StringListBuilder& fieldName, PixelOffsetField& pixelOffsets): Frame(parent, fieldName), pixelOffsets(pixelOffsets) {}
+
+            virtual void onValue(const String& key, const Scalar& value, Errors& errors) {
+                if (key == "type") type = value;
+                else if (key == "scale") scale = value;
+                else if (key == "offsets" && !value.isNull()) {
+                    hasOffsets = true;
+                    errors.invalidFields += fieldName + key;
+                }
+            }
+
+            virtual Frame* onObject(const String& key, Errors& errors) {
+                if (key == "offsets") {
+                    hasOffsets = true;
+                    errors.invalidFields += fieldName + key;
+                }
+                return Frame::onObject(key, errors);
+            }
+
+            virtual Frame* onArray(const String& key, Errors& errors) {
+                if (key == "offsets") {
+                    hasOffsets = true;
+                    return new OffsetListFrame(this, fieldName + key, offsets);
+                }
+                return Frame::onArray(key, errors);
+            }
+
+            virtual void onEnd(Errors& errors) {
+                if (!requiredField(type, "type", &Scalar::isString, errors)) return;
+
+                if (type.text == "Scale") {
+                    requiredField(scale, "scale", &Scalar::isFloat, errors);
+                    pixelOffsets.value = std::unique_ptr<PixelOffsetConfig>{new PixelOffsetConfig(PixelOffsetConfig::withScale(scale.asFloat(0.0f)))};
+                } else if (type.text == "OffsetList") {
+                    if (!hasOffsets) {
+                        errors.missingFields += fieldName + "offsets";
+                    } else if (offsets.count > OffsetBlocks::MAXIMUM_COUNT) {
+                        errors.invalidFields += fieldName + "offsets";
+                    } else {
+                        uint16_t count = offsets.count;
+                        pixelOffsets.value = std::unique_ptr<PixelOffsetConfig>{new PixelOffsetConfig(PixelOffsetConfig::withList(count, offsets.release()))};
+                    }
+                } else if (type.text == "Random") {
+                    pixelOffsets.value = std::unique_ptr<PixelOffsetConfig>{new PixelOffsetConfig(PixelOffsetConfig::withRandom())};
+                } else {
+                    errors.invalidFields += fieldName;
+                }
+            }
+        };
+
+        struct ColorSourceFrame : public Frame {
+            ColorSourceField& colorSource;
+
+            Scalar type;
+            Scalar uid;
+            Scalar duration;
+            Scalar loop;
+            Scalar hueDistance;
+            Scalar saturationDistance;
+            Scalar valueDistance;
+            ColorField color;
+            ColorField start;
+            ColorField end;
+            EasingField easing;
+            GradientField gradient;
+            PixelOffsetField pixelOffsets;
+            ColorSourceField background;
+            ColorSourceField overlay;
+
+            ColorSourceFrame(Frame* parent, const StringListBuilder& fieldName, ColorSourceField& colorSource): Frame(parent, fieldName), colorSource(colorSource) {}
+
+            ColorField* getColorField(const String& key) {
+                if (key == "color") return &color;
+                if (key == "start") return &start;
+                if (key == "end") return &end;
+                return nullptr;
+            }
+
+            ColorSourceField* getColorSourceField(const String& key) {
+                if (key == "background") return &background;
+                if (key == "overlay") return &overlay;
+                return nullptr;
+            }
+
+            bool isObjectField(const String& key) {
+                return getColorField(key) || getColorSourceField(key) || key == "easing" || key == "gradient" || key == "pixelOffsets";
+            }
+
+            virtual void onValue(const String& key, const Scalar& value, Errors& errors) {
+                if (key == "type") type = value;
+                else if (key == "uid") uid = value;
+                else if (key == "duration") duration = value;
+                else if (key == "loop") loop = value;
+                else if (key == "hueDistance") hueDistance = value;
+                else if (key == "saturationDistance") saturationDistance = value;
+                else if (key == "valueDistance") valueDistance = value;
+                else if (ColorField* field = getColorField(key)) deserializeColor(value, key, *field, errors);
+                else if (key == "easing") deserializeEasing(value, key, easing, errors);
+                else if (!value.isNull() && isObjectField(key)) {
+                    errors.invalidFields += fieldName + key;
+                    if (key == "gradient") gradient.present = true;
+                    if (ColorSourceField* field = getColorSourceField(key)) field->present = true;
+                }
+            }
+
+            virtual Frame* onObject(const String& key, Errors& errors) {
+                if (ColorField* field = getColorField(key)) return new ColorFrame(this, fieldName + key, *field);
+                if (ColorSourceField* field = getColorSourceField(key)) return new ColorSourceFrame(this, fieldName + key, *field);
+                if (key == "easing") return new EasingFrame(this, fieldName + key, easing);
+                if (key == "gradient") return new GradientFrame(this, fieldName + key, gradient);
+                if (key == "pixelOffsets") return new PixelOffsetFrame(this, fieldName + key, pixelOffsets);
+                return Frame::onObject(key, errors);
+            }
+
+            virtual Frame* onArray(const String& key, Errors& errors) {
+                if (isObjectField(key)) {
+                    errors.invalidFields += fieldName + key;
+                    if (key == "gradient") gradient.present = true;
+                    if (ColorSourceField* field = getColorSourceField(key)) field->present = true;
+                }
+                return Frame::onArray(key, errors);
+            }
+
+            bool requiredColor(const ColorField& field, const char* name, Errors& errors) {
+                if (!field.present) {
+                    errors.missingFields += fieldName + name;
+                    return false;
+                }
+                return true;
+            }
+
+            bool requiredColorSource(const ColorSourceField& field, const char* name, Errors& errors) {
+                if (!field.present) {
+                    errors.missingFields += fieldName + name;
+                    return false;
+                }
+                return (bool)field.value;
+            }
+
+            // Moves the offsets into the ColorSource, so that offset lists are not copied
+            PixelOffsetConfig takePixelOffsets() {
+                return pixelOffsets.value ? std::move(*pixelOffsets.value) : PixelOffsetConfig::withNone();
+            }
+
+            bool isValid(const Errors& errors) {
+                return errors.missingFields.value.length() == 0 && errors.invalidFields.value.length() == 0;
+            }
+
+            virtual void onEnd(Errors& errors) {
+                colorSource.present = true;
+                if (!requiredField(type, "type", &Scalar::isString, errors)) return;
+
+                if (type.text == "Solid") {
+                    requiredField(uid, "uid", &Scalar::isUInt32, errors);
+                    requiredColor(color, "color", errors);
+                    if (!isValid(errors)) return;
+
+                    colorSource.value = std::unique_ptr<ColorSource>{new SolidColorSource(uid.asUnsigned(0), color.value)};
+                } else if (type.text == "Fade") {
+                    requiredField(uid, "uid", &Scalar::isUInt32, errors);
+                    requiredField(duration, "duration", &Scalar::isUInt16, errors);
+                    optionalField(loop, "loop", &Scalar::isBool, errors);
+                    requiredColor(start, "start", errors);
+                    requiredColor(end, "end", errors);
+                    if (!isValid(errors)) return;
+
+                    colorSource.value = std::unique_ptr<ColorSource>{new FadeColorSource(uid.asUnsigned(0), start.value, end.value, duration.asUnsigned(0), loop.asBool(false), easing.value)};
+                } else if (type.text == "Overlay") {
+                    requiredField(uid, "uid", &Scalar::isUInt32, errors);
+                    bool hasBackground = requiredColorSource(background, "background", errors);
+                    bool hasOverlay = requiredColorSource(overlay, "overlay", errors);
+                    if (!isValid(errors) || !hasBackground || !hasOverlay) return;
+
+                    colorSource.value = std::unique_ptr<ColorSource>{new OverlayColorSource(uid.asUnsigned(0), *background.value, *overlay.value)};
+                } else if (type.text == "Gradient") {
+                    requiredField(uid, "uid", &Scalar::isUInt32, errors);
+                    requiredField(duration, "duration", &Scalar::isUInt16, errors);
+                    optionalField(loop, "loop", &Scalar::isBool, errors);
+                    if (!gradient.present) {
+                        errors.missingFields += fieldName + "gradient";
+                    }
+                    if (!isValid(errors) || !gradient.value) return;
+
+                    colorSource.value = std::unique_ptr<ColorSource>{new GradientColorSource(uid.asUnsigned(0), *gradient.value, duration.asUnsigned(0), loop.asBool(false), easing.value, takePixelOffsets())};
+                } else if (type.text == "HsvMeander") {
+                    requiredField(uid, "uid", &Scalar::isUInt32, errors);
+                    requiredField(duration, "duration", &Scalar::isUInt16, errors);
+                    optionalField(hueDistance, "hueDistance", &Scalar::isFloat, errors);
+                    optionalField(saturationDistance, "saturationDistance", &Scalar::isFloat, errors);
+                    optionalField(valueDistance, "valueDistance", &Scalar::isFloat, errors);
+                    requiredColor(color, "color", errors);
+                    if (!isValid(errors)) return;
+
+                    colorSource.value = std::unique_ptr<ColorSource>{new HsvMeanderColorSource(uid.asUnsigned(0), color.value, duration.asUnsigned(0),
+                        hueDistance.asFloat(0.0f), saturationDistance.asFloat(0.0f), valueDistance.asFloat(0.0f), takePixelOffsets())};
+                } else {
+                    errors.invalidFields += fieldName + "type";
+                }
+            }
+        };
+    }
+
+    Frame* StreamingColorSourceDeserializer::Frame::onObject(const String& key, Errors& errors) {
+        return new IgnoredFrame(this);
+    }
+
+    Frame* StreamingColorSourceDeserializer::Frame::onArray(const String& key, Errors& errors) {
+        return new IgnoredFrame(this);
+    }
+}
+
+/**
+ * Deserializer
+ */
+namespace LightWeaver {
+    namespace {
+        // The root frame owns the result of the whole document
+        struct RootFrame : public ColorSourceFrame {
+            ColorSourceField result;
+            RootFrame(): ColorSourceFrame(nullptr, StringListBuilder(".", ""), result) {}
+        };
+    }
+
+    StreamingColorSourceDeserializer::~StreamingColorSourceDeserializer() {
+        while (frame) {
+            Frame* parent = frame->parent;
+            delete frame;
+            frame = parent;
+        }
+    }
+
+    void StreamingColorSourceDeserializer::pushFrame(Frame* child) {
+        frame = child;
+    }
+
+    void StreamingColorSourceDeserializer::popFrame() {
+        Errors errors{missingFields, invalidFields};
+        Frame* child = frame;
+        child->onEnd(errors);
+        frame = child->parent;
+
+        if (frame) {
+            frame->onChildEnd(errors);
+        } else if (hasRootObject) {
+            colorSource = std::move(static_cast<RootFrame*>(child)->result.value);
+        }
+        delete child;
+    }
+
+    void StreamingColorSourceDeserializer::onObjectStart() {
+        Errors errors{missingFields, invalidFields};
+        if (!frame) {
+            hasRootObject = !hasRootValue;
+            hasRootValue = true;
+            pushFrame(hasRootObject ? new RootFrame() : (Frame*)new IgnoredFrame(nullptr));
+        } else {
+            pushFrame(frame->onObject(key, errors));
+        }
+    }
+
+    void StreamingColorSourceDeserializer::onObjectEnd() {
+        popFrame();
+    }
+
+    void StreamingColorSourceDeserializer::onArrayStart() {
+        Errors errors{missingFields, invalidFields};
+        if (frame) {
+            pushFrame(frame->onArray(key, errors));
+        } else {
+            hasRootValue = true;
+            pushFrame(new IgnoredFrame(nullptr));
+        }
+    }
+
+    void StreamingColorSourceDeserializer::onArrayEnd() {
+        popFrame();
+    }
+
+    void StreamingColorSourceDeserializer::onKey(const char* key) {
+        this->key = key;
+    }
+
+    void StreamingColorSourceDeserializer::onValue(ValueType type, const char* value) {
+        Errors errors{missingFields, invalidFields};
+        if (frame) {
+            frame->onValue(key, Scalar(type, value), errors);
+        } else {
+            hasRootValue = true;
+        }
+    }
+
+    bool StreamingColorSourceDeserializer::write(const uint8_t* data, size_t length) {
+        return parser.write(data, length) != JsonStreamParser::Status::Error;
+    }
+
+    StreamingColorSourceDeserializer::Result StreamingColorSourceDeserializer::finish() {
+        if (parser.finish() == JsonStreamParser::Status::Error) {
+            return Result::withError(String("Invalid JSON: ") + parser.getError());
+        }
+        return getResult();
+    }
+
+    StreamingColorSourceDeserializer::Result StreamingColorSourceDeserializer::getResult() {
+        if (!hasRootObject) {
+            return Result::withMissingFields("type");
+        }
+        if (!missingFields.empty()) {
+            return Result::withMissingFields(missingFields);
+        } else if (!invalidFields.empty()) {
+            return Result::withInvalidFields(invalidFields);
+        }
+
+        if (!colorSource) {
+            return Result::withError("Unknown Error");
+        }
+
+        return Result::withSuccess(std::move(colorSource));
+    }
+}
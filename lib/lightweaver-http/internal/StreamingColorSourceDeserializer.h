@@ -0,0 +1,67 @@
+#pragma once
+#include <memory>
+#include <Arduino.h>
+#include <LightWeaver/ColorSource.h>
+#include <LightWeaver/util/StringListBuilder.h>
+
+#include "ColorSourceDeserializer.h"
+#include "JsonStreamParser.h"
+
+namespace LightWeaver {
+    /**
+     * Deserializes a ColorSource from a JSON document that arrives in chunks
+     *
+     * Accepts the same format as ColorSourceDeserializer, but the JSON text is never held in memory.
+     * ColorSets and pixel offset lists are built directly from the tokens as they are parsed,
+     * so the peak memory used is bounded by the size of the resulting ColorSource
+     * rather than the size of the request.
+     */
+    class StreamingColorSourceDeserializer : private JsonStreamListener {
+        public:
+            typedef ColorSourceDeserializer::Result Result;
+
+            // Holds intermediate state for one JSON object or array that is currently being parsed
+            struct Frame;
+        private:
+            JsonStreamParser parser{*this};
+            StringListBuilder missingFields{", ", ""};
+            StringListBuilder invalidFields{", ", ""};
+
+            // The innermost object or array that is currently open
+            Frame* frame = nullptr;
+            std::unique_ptr<ColorSource> colorSource;
+            bool hasRootValue = false;
+            // Whether the document is a JSON object, rather than an array or a single value
+            bool hasRootObject = false;
+            String key;
+
+            void pushFrame(Frame* child);
+            void popFrame();
+
+            virtual void onObjectStart();
+            virtual void onObjectEnd();
+            virtual void onArrayStart();
+            virtual void onArrayEnd();
+            virtual void onKey(const char* key);
+            virtual void onValue(ValueType type, const char* value);
+        public:
+            StreamingColorSourceDeserializer() {}
+            virtual ~StreamingColorSourceDeserializer();
+
+            // Consumes the next chunk of the document, returning false once the document is known to be invalid
+            bool write(const uint8_t* data, size_t length);
+            Result finish();
+
+            // For a ColorSource nested inside of another document, the listener of that document passes every
+            // token of the ColorSource to getListener() instead of calling write(), until isComplete()
+            JsonStreamListener& getListener() {
+                return *this;
+            }
+
+            bool isComplete() const {
+                return hasRootValue && !frame;
+            }
+
+            Result getResult();
+    };
+}
@@ -28,7 +28,8 @@ namespace LightWeaver {
                 return builder;
             }
         public:
-            static const String type;
+            // MDNS.update() only needs to answer queries, which can wait a few frames
+            static const uint16_t LOOP_INTERVAL = 100;
 
             LightWeaverMdns(LightWeaverCore& lightWeaver):
                 LightWeaverWebPlugin(lightWeaver) {};
@@ -42,7 +43,7 @@ namespace LightWeaver {
                 MDNS.addServiceTxt("lightweaver", "tcp", "firmware-version", LIGHTWEAVER_VERSION);
                 MDNS.addServiceTxt("lightweaver", "tcp", "supported-features", getFeatureString(lightWeaver->getSupportedFeatures()));
                 
-                if (lightWeaver->getPluginOfType(LightWeaverHttpServer::type)) {
+                if (lightWeaver->getPlugin<LightWeaverHttpServer>()) {
                     MDNS.addServiceTxt("lightweaver", "tcp", "http-api-version", LightWeaverHttpServer::apiVersion);
                     MDNS.addService("http","tcp",LightWeaverHttpServer::port);
                     MDNS.addServiceTxt("http", "tcp", "path", LightWeaverHttpServer::rootPath);
@@ -54,15 +55,7 @@ namespace LightWeaver {
             }
 
             virtual void loop() {
-                LightWeaverWebPlugin::loop();
-
                 MDNS.update();
             }
-
-            virtual const String& getType() {
-                return LightWeaverMdns::type;
-            }
     };
-
-    const String LightWeaverMdns::type = "MDNS";
 }
\ No newline at end of file
@@ -9,7 +9,7 @@ namespace LightWeaver {
     class LightWeaverOta : public LightWeaverWebPlugin {
         private:
         public:
-            static const String type;
+            static const uint16_t LOOP_INTERVAL = 10;
             const String password;
             const String hostname;
 
@@ -37,15 +37,7 @@ namespace LightWeaver {
 
 
             virtual void loop() {
-                LightWeaverWebPlugin::loop();
-
                 ArduinoOTA.handle();
             }
-
-            virtual const String& getType() {
-                return LightWeaverOta::type;
-            }
     };
-
-    const String LightWeaverOta::type = "OTA";
 }
\ No newline at end of file
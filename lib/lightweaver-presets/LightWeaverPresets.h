@@ -0,0 +1,47 @@
+#pragma once
+#include <Arduino.h>
+#include <LightWeaver/LightWeaverPlugin.h>
+
+#include "PresetStore.h"
+
+namespace LightWeaver {
+    /**
+     * Saves and recalls named ColorSources from flash
+     * Presets can be recalled by id directly on the device, without any network client
+     */
+    class LightWeaverPresets : public LightWeaverPlugin {
+        private:
+            PresetStore store;
+        public:
+
+            LightWeaverPresets(LightWeaverCore& lightWeaver):
+                LightWeaverPlugin(lightWeaver) {};
+            virtual ~LightWeaverPresets() {
+            }
+
+            virtual void setup() {
+                store.begin();
+            }
+
+            bool savePreset(uint8_t id, const String& name, const ColorSource& colorSource) {
+                return store.save(id, name, colorSource);
+            }
+
+            bool recallPreset(uint8_t id) {
+                std::unique_ptr<ColorSource> colorSource = store.load(id);
+                if (!colorSource) {
+                    return false;
+                }
+                lightWeaver->setColorSource(std::move(colorSource));
+                return true;
+            }
+
+            bool removePreset(uint8_t id) {
+                return store.remove(id);
+            }
+
+            const PresetStore& getStore() const {
+                return store;
+            }
+    };
+}
@@ -0,0 +1,196 @@
+#include "PresetStore.h"
+#include <LightWeaver/persistence/ColorSourceCodec.h>
+
+#define PRESET_DIRECTORY "/presets"
+#define PRESET_INDEX_PATH PRESET_DIRECTORY "/index"
+#define PRESET_INDEX_TEMP_PATH PRESET_DIRECTORY "/index.tmp"
+
+namespace LightWeaver {
+    String PresetStore::getPresetPath(uint8_t id) {
+        return PRESET_DIRECTORY "/" + String(id);
+    }
+
+    int PresetStore::findPreset(uint8_t id) const {
+        for (uint8_t i = 0; i < presetCount; i++) {
+            if (presets[i].id == id) {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    void PresetStore::loadIndex() {
+        presetCount = 0;
+        File index = LittleFS.open(PRESET_INDEX_PATH, "r");
+        if (!index) {
+            // No presets have been saved yet
+            return;
+        }
+
+        uint32_t magic = 0;
+        uint8_t count = 0;
+        bool isValid = index.read(reinterpret_cast<uint8_t*>(&magic), sizeof(magic)) == sizeof(magic)
+            && magic == INDEX_MAGIC
+            && index.read(&count, sizeof(count)) == sizeof(count)
+            && count <= MAXIMUM_PRESETS
+            && index.read(reinterpret_cast<uint8_t*>(presets), sizeof(PresetInfo) * count) == sizeof(PresetInfo) * count;
+        index.close();
+
+        if (!isValid) {
+            // The presets can't be found without the index, so it is removed and the store starts
+            // empty rather than failing every save and recall until the flash is erased
+            Serial.println("Preset index is invalid, presets have been reset");
+            LittleFS.remove(PRESET_INDEX_PATH);
+            return;
+        }
+
+        presetCount = count;
+        for (uint8_t i = 0; i < presetCount; i++) {
+            presets[i].name[PresetInfo::MAXIMUM_NAME_LENGTH] = '\0';
+        }
+    }
+
+    bool PresetStore::saveIndex() {
+        // The index is written to a temporary file and then renamed over the old one,
+        // so a reset while saving leaves either the old or the new index intact
+        File index = LittleFS.open(PRESET_INDEX_TEMP_PATH, "w");
+        if (!index) {
+            return false;
+        }
+
+        uint32_t magic = INDEX_MAGIC;
+        size_t expectedSize = sizeof(magic) + sizeof(presetCount) + sizeof(PresetInfo) * presetCount;
+        size_t writtenSize = index.write(reinterpret_cast<const uint8_t*>(&magic), sizeof(magic));
+        writtenSize += index.write(&presetCount, sizeof(presetCount));
+        writtenSize += index.write(reinterpret_cast<const uint8_t*>(presets), sizeof(PresetInfo) * presetCount);
+        index.close();
+
+        if (writtenSize != expectedSize) {
+            LittleFS.remove(PRESET_INDEX_TEMP_PATH);
+            return false;
+        }
+
+        return LittleFS.rename(PRESET_INDEX_TEMP_PATH, PRESET_INDEX_PATH);
+    }
+
+    bool PresetStore::begin() {
+        if (isStarted) return true;
+        if (!LittleFS.begin()) {
+            return false;
+        }
+        LittleFS.mkdir(PRESET_DIRECTORY);
+        loadIndex();
+        isStarted = true;
+        return true;
+    }
+
+    bool PresetStore::save(uint8_t id, const String& name, const ColorSource& colorSource) {
+        if (!isStarted) return false;
+
+        int index = findPreset(id);
+        if (index < 0 && presetCount >= MAXIMUM_PRESETS) {
+            return false;
+        }
+
+        size_t size = ColorSourceCodec::getEncodedSize(colorSource);
+        if (size == 0 || size > MAXIMUM_PRESET_SIZE) {
+            return false;
+        }
+
+        std::unique_ptr<uint8_t[]> data = std::unique_ptr<uint8_t[]>{new uint8_t[size]};
+        if (ColorSourceCodec::encode(colorSource, data.get(), size) != size) {
+            return false;
+        }
+
+        // Like the index, the preset is written to a temporary file and renamed over the old one,
+        // so that overwriting a preset can't leave it truncated
+        String path = getPresetPath(id);
+        String tempPath = path + ".tmp";
+        File file = LittleFS.open(tempPath, "w");
+        if (!file) {
+            return false;
+        }
+        size_t writtenSize = file.write(data.get(), size);
+        file.close();
+        if (writtenSize != size) {
+            LittleFS.remove(tempPath);
+            return false;
+        }
+
+        // The index is saved before the preset is renamed into place, so if either fails the old
+        // entry is restored and still matches the preset on flash
+        uint8_t oldPresetCount = presetCount;
+        if (index < 0) {
+            index = presetCount++;
+        }
+        PresetInfo oldPreset = presets[index];
+        PresetInfo& preset = presets[index];
+        preset.id = id;
+        memset(preset.name, 0, sizeof(preset.name));
+        strncpy(preset.name, name.c_str(), PresetInfo::MAXIMUM_NAME_LENGTH);
+        preset.size = size;
+        preset.checksum = ColorSourceCodec::getChecksum(data.get(), size);
+
+        if (!saveIndex()) {
+            presets[index] = oldPreset;
+            presetCount = oldPresetCount;
+            LittleFS.remove(tempPath);
+            return false;
+        }
+        if (!LittleFS.rename(tempPath, path)) {
+            presets[index] = oldPreset;
+            presetCount = oldPresetCount;
+            LittleFS.remove(tempPath);
+            saveIndex();
+            return false;
+        }
+        return true;
+    }
+
+    std::unique_ptr<ColorSource> PresetStore::load(uint8_t id) const {
+        const PresetInfo* preset = getPreset(id);
+        if (!preset) {
+            return nullptr;
+        }
+
+        File file = LittleFS.open(getPresetPath(id), "r");
+        if (!file) {
+            return nullptr;
+        }
+
+        // The size is known from the index, so the file is read in a single call
+        std::unique_ptr<uint8_t[]> data = std::unique_ptr<uint8_t[]>{new uint8_t[preset->size]};
+        size_t readSize = file.read(data.get(), preset->size);
+        file.close();
+
+        if (readSize != preset->size || ColorSourceCodec::getChecksum(data.get(), preset->size) != preset->checksum) {
+            return nullptr;
+        }
+
+        return ColorSourceCodec::decode(data.get(), preset->size);
+    }
+
+    bool PresetStore::remove(uint8_t id) {
+        int index = findPreset(id);
+        if (index < 0) {
+            return false;
+        }
+
+        presets[index] = presets[--presetCount];
+        LittleFS.remove(getPresetPath(id));
+        return saveIndex();
+    }
+
+    const PresetInfo* PresetStore::getPreset(uint8_t id) const {
+        int index = findPreset(id);
+        return index < 0 ? nullptr : &presets[index];
+    }
+
+    uint8_t PresetStore::getPresetCount() const {
+        return presetCount;
+    }
+
+    const PresetInfo& PresetStore::getPresetAt(uint8_t index) const {
+        return presets[index];
+    }
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include <memory>
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <LightWeaver/ColorSource.h>
+
+namespace LightWeaver {
+    struct PresetInfo {
+        static const uint8_t MAXIMUM_NAME_LENGTH = 23;
+
+        uint8_t id;
+        char name[MAXIMUM_NAME_LENGTH + 1];
+        uint16_t size;
+        uint16_t checksum;
+    };
+
+    /**
+     * Stores named ColorSources on LittleFS using ColorSourceCodec
+     *
+     * Each preset is stored in its own file named by id, alongside a single index file holding the
+     * name, size and checksum of every preset. The index is read once in begin() and kept in memory,
+     * so listing presets and recalling one by id never requires scanning the directory.
+     */
+    class PresetStore {
+        public:
+            static const uint8_t MAXIMUM_PRESETS = 16;
+            static const uint16_t MAXIMUM_PRESET_SIZE = 4096;
+        private:
+            static const uint32_t INDEX_MAGIC = 0x3150574C; // "LWP1"
+
+            PresetInfo presets[MAXIMUM_PRESETS];
+            uint8_t presetCount = 0;
+            bool isStarted = false;
+
+            static String getPresetPath(uint8_t id);
+            int findPreset(uint8_t id) const;
+            void loadIndex();
+            bool saveIndex();
+        public:
+            bool begin();
+
+            bool save(uint8_t id, const String& name, const ColorSource& colorSource);
+            std::unique_ptr<ColorSource> load(uint8_t id) const;
+            bool remove(uint8_t id);
+
+            const PresetInfo* getPreset(uint8_t id) const;
+            uint8_t getPresetCount() const;
+            const PresetInfo& getPresetAt(uint8_t index) const;
+    };
+}
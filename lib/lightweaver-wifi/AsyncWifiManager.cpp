@@ -27,41 +27,151 @@ namespace LightWeaver {
         request->redirect("/");
     }
 
-    bool AsyncWifiManager::isConnectedToWifi() {
-        if (WiFi.waitForConnectResult() == WL_CONNECTED) {
-            if (onWifiConnectedHandler) onWifiConnectedHandler();
-            return true;
+    void AsyncWifiManager::loadConnectionCache() {
+        hasConnectionCache = false;
+        File file = LittleFS.open("/wifi", "r");
+        if (!file) return;
+
+        hasConnectionCache = file.read(reinterpret_cast<uint8_t*>(&connectionCache), sizeof(connectionCache)) == sizeof(connectionCache)
+            && connectionCache.magic == CONNECTION_CACHE_MAGIC;
+        file.close();
+
+        // The cache only applies to the network the SDK is configured for
+        connectionCache.ssid[sizeof(connectionCache.ssid) - 1] = '\0';
+        if (hasConnectionCache && WiFi.SSID() != connectionCache.ssid) {
+            hasConnectionCache = false;
         }
-        return false;
+    }
+
+    void AsyncWifiManager::saveConnectionCache() {
+        ConnectionCache cache;
+        memset(&cache, 0, sizeof(cache));
+        cache.magic = CONNECTION_CACHE_MAGIC;
+        strncpy(cache.ssid, WiFi.SSID().c_str(), sizeof(cache.ssid) - 1);
+        memcpy(cache.bssid, WiFi.BSSID(), sizeof(cache.bssid));
+        cache.channel = WiFi.channel();
+
+        // Only write when the access point has changed, to avoid a flash write on every connection
+        if (hasConnectionCache && memcmp(&cache, &connectionCache, sizeof(cache)) == 0) {
+            return;
+        }
+
+        File file = LittleFS.open("/wifi", "w");
+        if (!file) return;
+        file.write(reinterpret_cast<const uint8_t*>(&cache), sizeof(cache));
+        file.close();
+
+        connectionCache = cache;
+        hasConnectionCache = true;
+    }
+
+    void AsyncWifiManager::clearConnectionCache() {
+        hasConnectionCache = false;
+        LittleFS.remove("/wifi");
+    }
+
+    void AsyncWifiManager::startConnecting(State connectingState) {
+        state = connectingState;
+        connectStartTime = millis();
+        startConnectionAttempt();
+    }
+
+    void AsyncWifiManager::startConnectionAttempt() {
+        startConnectionAttempt(WiFi.SSID(), WiFi.psk());
+    }
+
+    void AsyncWifiManager::startConnectionAttempt(const String& ssid, const String& psk) {
+        attemptStartTime = millis();
+        hasDisconnectedEvent = false;
+
+        if (useStaticIP) {
+            WiFi.config(staticIP, staticGateway, staticSubnet, staticDns);
+        }
+
+        // Connecting to a known BSSID and channel skips the scan for the access point
+        isFastConnecting = hasConnectionCache;
+        if (isFastConnecting) {
+            WiFi.begin(ssid.c_str(), psk.c_str(), connectionCache.channel, connectionCache.bssid);
+        } else {
+            beginWithScan(ssid, psk);
+        }
+    }
+
+    // A fast connection sets the BSSID in the SDK configuration, and WiFi.begin() without arguments
+    // would keep connecting to that BSSID only. Passing the credentials again clears it
+    void AsyncWifiManager::beginWithScan(const String& ssid, const String& psk) {
+        WiFi.begin(ssid.c_str(), psk.c_str());
+    }
+
+    void AsyncWifiManager::onConnected() {
+        state = State::Connected;
+        saveConnectionCache();
+        if (onWifiConnectedHandler) onWifiConnectedHandler();
     }
 
     bool AsyncWifiManager::connectToWifi() {
-        WiFi.begin();
+        startConnecting(State::Connecting);
         return false;
     };
 
     bool AsyncWifiManager::connectToWifi(String& ssid, String& psk) {
-        WiFi.begin(ssid, psk);
+        clearConnectionCache();
+        state = State::Connecting;
+        connectStartTime = millis();
+
+        // Credentials from the portal are the only station configuration written to flash,
+        // later attempts read them back with WiFi.SSID() and WiFi.psk()
+        WiFi.persistent(true);
+        startConnectionAttempt(ssid, psk);
+        WiFi.persistent(false);
         return false;
     };
 
     void AsyncWifiManager::begin(String softApName) {
+        this->softApName = softApName;
+
+        LittleFS.begin();
+        loadConnectionCache();
+
+        gotIPHandler = WiFi.onStationModeGotIP([this](const WiFiEventStationModeGotIP&) {
+            hasGotIPEvent = true;
+        });
+        disconnectedHandler = WiFi.onStationModeDisconnected([this](const WiFiEventStationModeDisconnected&) {
+            hasDisconnectedEvent = true;
+        });
+
+        // Every attempt calls WiFi.begin(), switching between a fast connection and a scan, which
+        // would otherwise rewrite the SDK configuration on flash each time
+        WiFi.persistent(false);
+        // Reconnection is handled in loop(), where the cached access point can be used
+        WiFi.setAutoReconnect(false);
+        WiFi.mode(WIFI_STA);
         connectToWifi();
-        if (isConnectedToWifi()) {
-            return;
-        }
+    };
 
-        SPIFFS.begin();
+    void AsyncWifiManager::setStaticIP(IPAddress ip, IPAddress gateway, IPAddress subnet, IPAddress dns) {
+        useStaticIP = true;
+        staticIP = ip;
+        staticGateway = gateway;
+        staticSubnet = subnet;
+        staticDns = dns;
+    }
+
+    AsyncWifiManager::State AsyncWifiManager::getState() const {
+        return state;
+    }
+
+    void AsyncWifiManager::startCaptivePortal() {
+        isCaptivePortalStarted = true;
+
+        // The station keeps trying to connect while the access point is running
+        WiFi.mode(WIFI_AP_STA);
         WiFi.softAPConfig(apIP, apIP, netMsk);
         WiFi.softAP(softApName);
         if (onAPStartedHandler) {
             onAPStartedHandler();
         }
 
-        startCaptivePortal();
-    };
-
-    void AsyncWifiManager::startCaptivePortal() {
         dnsServer.setTTL(600);
         dnsServer.setErrorReplyCode(AsyncDNSReplyCode::ServerFailure);
 
@@ -77,8 +187,8 @@ namespace LightWeaver {
         });
 
         // Serve the CSS file w/out a template processor to avoid mangling percentages
-        server.serveStatic("/style.css", SPIFFS, "/www/style.css");
-        server.serveStatic("/", SPIFFS, "/www/")
+        server.serveStatic("/style.css", LittleFS, "/www/style.css");
+        server.serveStatic("/", LittleFS, "/www/")
             .setDefaultFile("index.html")
             .setTemplateProcessor(std::bind(&AsyncWifiManager::templateProcessor,this,std::placeholders::_1));
 
@@ -88,9 +198,12 @@ namespace LightWeaver {
     }
 
     void AsyncWifiManager::end() {
+        if (!isCaptivePortalStarted) return;
+        isCaptivePortalStarted = false;
         dnsServer.stop();
         server.end();
         WiFi.softAPdisconnect(true);
+        WiFi.mode(WIFI_STA);
     };
 
     void AsyncWifiManager::setOnAPStartedHandler(OnAPStartedHandler handler) {
@@ -102,9 +215,38 @@ namespace LightWeaver {
     };
     
     void AsyncWifiManager::loop() {
-        if (!hasFiredWifiCallbacks && WiFi.status() == WL_CONNECTED) {
-            if (onWifiConnectedHandler) onWifiConnectedHandler();
-            hasFiredWifiCallbacks = true;        
+        if (hasGotIPEvent) {
+            hasGotIPEvent = false;
+            hasDisconnectedEvent = false;
+            if (state != State::Connected) {
+                onConnected();
+            }
+            return;
+        }
+
+        if (hasDisconnectedEvent && state == State::Connected) {
+            hasDisconnectedEvent = false;
+            startConnecting(State::Reconnecting);
+            return;
+        }
+
+        if (state != State::Connecting && state != State::Reconnecting) {
+            return;
+        }
+
+        uint32_t now = millis();
+        uint32_t attemptDuration = now - attemptStartTime;
+        if (isFastConnecting && attemptDuration > FAST_CONNECT_TIMEOUT) {
+            // The access point may have changed channel, or been replaced
+            isFastConnecting = false;
+            attemptStartTime = now;
+            beginWithScan(WiFi.SSID(), WiFi.psk());
+        } else if (!isFastConnecting && hasDisconnectedEvent && attemptDuration > RETRY_INTERVAL) {
+            startConnectionAttempt();
+        }
+
+        if (state == State::Connecting && !isCaptivePortalStarted && now - connectStartTime > CONNECT_TIMEOUT) {
+            startCaptivePortal();
         }
     };
 }
\ No newline at end of file
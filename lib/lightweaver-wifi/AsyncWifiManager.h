@@ -4,28 +4,88 @@
 #include <ESPAsyncTCP.h>
 #include <ESPAsyncWebServer.h>
 #include <ESPAsyncDNSServer.h>
+#include <LittleFS.h>
 
 
 namespace LightWeaver {
+    /**
+     * Connects to WiFi without blocking, starting a captive portal to configure WiFi if
+     * a connection can not be made. Connection progress is advanced from loop()
+     *
+     * The BSSID and channel of the last successful connection are cached on flash, allowing
+     * later connections to skip scanning for the access point
+     */
     class AsyncWifiManager {
         typedef std::function<void()> OnAPStartedHandler;
         typedef std::function<void()> OnWifiConnectedHandler;
 
-        bool hasFiredWifiCallbacks = false;
+        public:
+            enum class State {
+                Idle,
+                Connecting,
+                Connected,
+                Reconnecting
+            };
+
+            // Time to wait for a connection at startup before starting the captive portal
+            static const uint32_t CONNECT_TIMEOUT = 10000;
+            // Time to wait for a connection using the cached BSSID and channel before falling back to a full scan
+            static const uint32_t FAST_CONNECT_TIMEOUT = 2000;
+            // Minimum time between failed connection attempts
+            static const uint32_t RETRY_INTERVAL = 5000;
+        private:
+            struct ConnectionCache {
+                uint32_t magic;
+                char ssid[33];
+                uint8_t bssid[6];
+                int32_t channel;
+            };
+
+            static const uint32_t CONNECTION_CACHE_MAGIC = 0x3157574C; // "LWW1"
+
+            const byte DNS_PORT = 53;
+            const IPAddress apIP{192,168,0,1};
+            const IPAddress netMsk{255,255,255,0};
+
+            AsyncWebServer server{80};
+            AsyncDNSServer dnsServer;
+            OnAPStartedHandler onAPStartedHandler = nullptr;
+            OnWifiConnectedHandler onWifiConnectedHandler = nullptr;
+
+            String softApName;
+            bool isCaptivePortalStarted = false;
 
-        const byte DNS_PORT = 53;
-        const IPAddress apIP{192,168,0,1};
-        const IPAddress netMsk{255,255,255,0};
+            State state = State::Idle;
+            uint32_t connectStartTime = 0;
+            uint32_t attemptStartTime = 0;
+            bool isFastConnecting = false;
+            bool hasConnectionCache = false;
+            ConnectionCache connectionCache;
 
-        AsyncWebServer server{80};
-        AsyncDNSServer dnsServer;
-        OnAPStartedHandler onAPStartedHandler = nullptr;
-        OnWifiConnectedHandler onWifiConnectedHandler = nullptr;
+            bool useStaticIP = false;
+            IPAddress staticIP;
+            IPAddress staticGateway;
+            IPAddress staticSubnet;
+            IPAddress staticDns;
 
-        void startCaptivePortal();
-        void handleCaptivePortal(AsyncWebServerRequest*);
-        String templateProcessor(const String& var);
-        bool isConnectedToWifi();
+            // WiFi events are raised from the SDK, so they are only recorded here and handled in loop()
+            WiFiEventHandler gotIPHandler;
+            WiFiEventHandler disconnectedHandler;
+            volatile bool hasGotIPEvent = false;
+            volatile bool hasDisconnectedEvent = false;
+
+            void startCaptivePortal();
+            void handleCaptivePortal(AsyncWebServerRequest*);
+            String templateProcessor(const String& var);
+
+            void loadConnectionCache();
+            void saveConnectionCache();
+            void clearConnectionCache();
+            void startConnecting(State connectingState);
+            void startConnectionAttempt();
+            void startConnectionAttempt(const String& ssid, const String& psk);
+            void beginWithScan(const String& ssid, const String& psk);
+            void onConnected();
 
         public:
             bool connectToWifi();
@@ -33,8 +93,13 @@ namespace LightWeaver {
             void begin(String softApName);
             void loop();
             void end();
-            
+
+            // Uses the given address instead of DHCP, which avoids waiting for a lease on every connection
+            void setStaticIP(IPAddress ip, IPAddress gateway, IPAddress subnet, IPAddress dns = IPAddress());
+
+            State getState() const;
+
             void setOnAPStartedHandler(OnAPStartedHandler handler);
             void setOnWifiConnectedHandler(OnWifiConnectedHandler handler);
     };
-}
\ No newline at end of file
+}
@@ -9,16 +9,18 @@
 namespace LightWeaver {
     class LightWeaverWifi : public LightWeaverPlugin {
         private:
+            static const uint32_t IDLE_ANIMATION_UID = 0x0001;
             AsyncWifiManager wifiManager;
 
             void playIdleAnimation() {
-                lightWeaver->setColorSource(LightWeaver::FadeColorSource{0x0001,
+                lightWeaver->setColorSource(LightWeaver::FadeColorSource{IDLE_ANIMATION_UID,
                     LightWeaver::RgbColor(128,128,128),
                     LightWeaver::RgbColor(255,255,255),
                     5000, true, Easing::Mirror(Easing::QuadraticInOut)});
             }
         public:
-            static const String type;
+            // Connection timeouts are measured in seconds, so the state machine does not need every frame
+            static const uint16_t LOOP_INTERVAL = 50;
 
             LightWeaverWifi(LightWeaverCore& lightWeaver):
                 LightWeaverPlugin(lightWeaver) {};
@@ -27,12 +29,19 @@ namespace LightWeaver {
 
             virtual void setup() {
                 wifiManager.setOnAPStartedHandler([this]() {
-                    playIdleAnimation();
+                    // The router may simply be slower to start after a power loss, so a restored scene is kept
+                    if (!lightWeaver->getColorSource()) {
+                        playIdleAnimation();
+                    }
                 });
 
                 wifiManager.setOnWifiConnectedHandler([this]() {
                     wifiManager.end();
-                    lightWeaver->clearColorSource();
+                    // Only clear the idle animation, a scene restored at boot is left as is
+                    const ColorSource* colorSource = lightWeaver->getColorSource();
+                    if (colorSource && colorSource->uid == IDLE_ANIMATION_UID) {
+                        lightWeaver->clearColorSource();
+                    }
                 });
 
                 wifiManager.begin("Lightweaver-"+String(ESP.getChipId()));
@@ -42,10 +51,9 @@ namespace LightWeaver {
                 wifiManager.loop();
             }
 
-            virtual const String& getType() {
-                return LightWeaverWifi::type;
+            // Must be called before setup()
+            void setStaticIP(IPAddress ip, IPAddress gateway, IPAddress subnet, IPAddress dns = IPAddress()) {
+                wifiManager.setStaticIP(ip, gateway, subnet, dns);
             }
     };
-
-    const String LightWeaverWifi::type = "WIFI";
 }
\ No newline at end of file
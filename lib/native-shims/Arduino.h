@@ -0,0 +1,103 @@
+#pragma once
+/**
+ * Minimal stand-in for the Arduino core on the host
+ *
+ * Only the parts of the Arduino API used by LightWeaver are provided. Time does not pass on its own,
+ * it is controlled through NativeClock so that tests are deterministic.
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <math.h>
+#include <algorithm>
+#include <functional>
+#include <string>
+
+#include "NativeClock.h"
+
+typedef uint8_t byte;
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+#define HALF_PI 1.5707963267948966192313216916398
+#define TWO_PI 6.283185307179586476925286766559
+
+class String {
+    private:
+        std::string value;
+    public:
+        String() {}
+        String(const char* value): value(value ? value : "") {}
+        String(const std::string& value): value(value) {}
+        explicit String(char value): value(1, value) {}
+        explicit String(int value): value(std::to_string(value)) {}
+        explicit String(unsigned int value): value(std::to_string(value)) {}
+        explicit String(long value): value(std::to_string(value)) {}
+        explicit String(unsigned long value): value(std::to_string(value)) {}
+        explicit String(float value, unsigned char decimals = 2): String((double)value, decimals) {}
+        explicit String(double value, unsigned char decimals = 2) {
+            char buffer[32];
+            snprintf(buffer, sizeof(buffer), "%.*f", decimals, value);
+            this->value = buffer;
+        }
+
+        unsigned int length() const { return value.length(); }
+        const char* c_str() const { return value.c_str(); }
+        char charAt(unsigned int index) const { return index < value.length() ? value[index] : 0; }
+        String substring(unsigned int from) const { return from < value.length() ? String(value.substr(from)) : String(); }
+        String substring(unsigned int from, unsigned int to) const { return from < value.length() && from < to ? String(value.substr(from, to - from)) : String(); }
+        int indexOf(char c) const { size_t index = value.find(c); return index == std::string::npos ? -1 : (int)index; }
+        long toInt() const { return atol(value.c_str()); }
+        float toFloat() const { return atof(value.c_str()); }
+        bool equals(const String& other) const { return value == other.value; }
+        bool equalsIgnoreCase(const String& other) const {
+            return value.length() == other.value.length() && strncasecmp(value.c_str(), other.value.c_str(), value.length()) == 0;
+        }
+        bool endsWith(const String& suffix) const {
+            return value.length() >= suffix.value.length() && value.compare(value.length() - suffix.value.length(), suffix.value.length(), suffix.value) == 0;
+        }
+        bool isEmpty() const { return value.empty(); }
+        void toLowerCase() { for (char& c : value) c = tolower(c); }
+        void toUpperCase() { for (char& c : value) c = toupper(c); }
+        bool startsWith(const String& prefix) const { return value.compare(0, prefix.value.length(), prefix.value) == 0; }
+        bool reserve(unsigned int size) { value.reserve(size); return true; }
+        bool concat(const String& other) { value += other.value; return true; }
+        bool concat(const char* other, unsigned int length) { value.append(other, length); return true; }
+        bool concat(char c) { value += c; return true; }
+        const char* begin() const { return value.data(); }
+        const char* end() const { return value.data() + value.size(); }
+
+        String& operator+=(const String& other) { value += other.value; return *this; }
+        String& operator+=(const char* other) { value += other; return *this; }
+        String& operator+=(char other) { value += other; return *this; }
+        friend String operator+(const String& a, const String& b) { return String(a.value + b.value); }
+        friend String operator+(const String& a, const char* b) { return String(a.value + b); }
+        friend String operator+(const char* a, const String& b) { return String(a + b.value); }
+        bool operator==(const String& other) const { return value == other.value; }
+        bool operator==(const char* other) const { return value == other; }
+        bool operator!=(const String& other) const { return value != other.value; }
+        bool operator<(const String& other) const { return value < other.value; }
+        char operator[](unsigned int index) const { return value[index]; }
+};
+
+// ArduinoJson detects Arduino strings by this type as well as String
+class StringSumHelper : public String {
+    public:
+        StringSumHelper(const String& value): String(value) {}
+        StringSumHelper(const char* value): String(value) {}
+};
+
+unsigned long millis();
+unsigned long micros();
+
+// Seeded with 0 at startup, so sequences are repeatable unless randomSeed() is called
+long random(long max);
+long random(long min, long max);
+void randomSeed(unsigned long seed);
+
+void yield();
+void delay(unsigned long ms);
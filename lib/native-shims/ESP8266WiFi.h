@@ -0,0 +1,58 @@
+#pragma once
+#include <Arduino.h>
+#include <memory>
+
+class IPAddress {
+    private:
+        uint32_t address = 0;
+    public:
+        IPAddress() {}
+        IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d): address(a | b << 8 | c << 16 | (uint32_t)d << 24) {}
+
+        uint8_t operator[](int index) const { return address >> (8 * index); }
+        bool operator==(const IPAddress& other) const { return address == other.address; }
+        bool operator!=(const IPAddress& other) const { return address != other.address; }
+        String toString() const {
+            return String((int)(*this)[0]) + "." + String((int)(*this)[1]) + "." + String((int)(*this)[2]) + "." + String((int)(*this)[3]);
+        }
+};
+
+typedef enum {
+    WL_IDLE_STATUS = 0,
+    WL_CONNECTED = 3,
+    WL_DISCONNECTED = 6
+} wl_status_t;
+
+struct WiFiEventStationModeGotIP {
+    IPAddress ip;
+    IPAddress mask;
+    IPAddress gw;
+};
+
+struct WiFiEventStationModeDisconnected {
+    uint8_t reason;
+};
+
+typedef std::shared_ptr<void> WiFiEventHandler;
+
+/**
+ * Never connects on its own, tests raise the station events with simulateGotIP() and simulateDisconnected()
+ */
+class ESP8266WiFiClass {
+    private:
+        wl_status_t currentStatus = WL_DISCONNECTED;
+        IPAddress ip;
+        std::function<void(const WiFiEventStationModeGotIP&)> gotIPHandler;
+        std::function<void(const WiFiEventStationModeDisconnected&)> disconnectedHandler;
+    public:
+        wl_status_t status() const { return currentStatus; }
+        IPAddress localIP() const { return ip; }
+
+        WiFiEventHandler onStationModeGotIP(std::function<void(const WiFiEventStationModeGotIP&)> handler);
+        WiFiEventHandler onStationModeDisconnected(std::function<void(const WiFiEventStationModeDisconnected&)> handler);
+
+        void simulateGotIP(const IPAddress& ip);
+        void simulateDisconnected();
+};
+
+extern ESP8266WiFiClass WiFi;
@@ -0,0 +1,3 @@
+#pragma once
+// Nothing from ESPAsyncTCP is used directly, ESPAsyncWebServer.h provides the server stand-in
+#include <Arduino.h>
@@ -0,0 +1,135 @@
+#pragma once
+#include <Arduino.h>
+#include <functional>
+#include <memory>
+#include <vector>
+
+/**
+ * Stand-in for ESPAsyncWebServer without any networking
+ *
+ * Requests are created directly and passed to handlers, and record the response sent to them
+ */
+typedef enum {
+    HTTP_GET     = 0b00000001,
+    HTTP_POST    = 0b00000010,
+    HTTP_DELETE  = 0b00000100,
+    HTTP_PUT     = 0b00001000,
+    HTTP_PATCH   = 0b00010000,
+    HTTP_HEAD    = 0b00100000,
+    HTTP_OPTIONS = 0b01000000,
+    HTTP_ANY     = 0b01111111
+} WebRequestMethod;
+
+typedef uint8_t WebRequestMethodComposite;
+typedef std::function<void(void)> ArDisconnectHandler;
+
+class AsyncWebServerRequest {
+    private:
+        WebRequestMethodComposite requestMethod;
+        String requestUrl;
+        String requestContentType;
+        size_t requestContentLength;
+        ArDisconnectHandler disconnectHandler;
+    public:
+        void* _tempObject = nullptr;
+
+        // The last response sent
+        int responseCode = 0;
+        String responseContentType;
+        String responseContent;
+
+        AsyncWebServerRequest(WebRequestMethodComposite method, const String& url, const String& contentType = "", size_t contentLength = 0):
+            requestMethod(method),
+            requestUrl(url),
+            requestContentType(contentType),
+            requestContentLength(contentLength) {}
+        ~AsyncWebServerRequest() {
+            if (disconnectHandler) disconnectHandler();
+            // Matches ESPAsyncWebServer, which frees _tempObject without running its destructor
+            free(_tempObject);
+        }
+
+        WebRequestMethodComposite method() const { return requestMethod; }
+        const String& url() const { return requestUrl; }
+        const String& contentType() const { return requestContentType; }
+        size_t contentLength() const { return requestContentLength; }
+
+        void onDisconnect(ArDisconnectHandler handler) { disconnectHandler = handler; }
+
+        void send(int code, const String& contentType = "", const String& content = "") {
+            responseCode = code;
+            responseContentType = contentType;
+            responseContent = content;
+        }
+};
+
+typedef std::function<void(AsyncWebServerRequest* request)> ArRequestHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest* request, uint8_t* data, size_t length, size_t index, size_t total)> ArBodyHandlerFunction;
+
+class AsyncWebHandler {
+    public:
+        virtual ~AsyncWebHandler() {}
+        virtual bool canHandle(AsyncWebServerRequest* request) { return false; }
+        virtual void handleRequest(AsyncWebServerRequest* request) {}
+        virtual void handleUpload(AsyncWebServerRequest* request, const String& filename, size_t index, uint8_t* data, size_t length, bool final) {}
+        virtual void handleBody(AsyncWebServerRequest* request, uint8_t* data, size_t length, size_t index, size_t total) {}
+        virtual bool isRequestHandlerTrivial() { return true; }
+};
+
+class AsyncCallbackWebHandler : public AsyncWebHandler {
+    private:
+        String uri;
+        WebRequestMethodComposite method;
+        ArRequestHandlerFunction onRequest;
+        ArBodyHandlerFunction onBody;
+    public:
+        AsyncCallbackWebHandler(const String& uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest, ArBodyHandlerFunction onBody = nullptr):
+            uri(uri),
+            method(method),
+            onRequest(onRequest),
+            onBody(onBody) {}
+
+        virtual bool canHandle(AsyncWebServerRequest* request) {
+            return (request->method() & method) && request->url() == uri;
+        }
+        virtual void handleRequest(AsyncWebServerRequest* request) {
+            if (onRequest) onRequest(request);
+        }
+        virtual void handleBody(AsyncWebServerRequest* request, uint8_t* data, size_t length, size_t index, size_t total) {
+            if (onBody) onBody(request, data, length, index, total);
+        }
+};
+
+class AsyncWebServer {
+    private:
+        std::vector<std::unique_ptr<AsyncWebHandler>> handlers;
+    public:
+        AsyncWebServer(uint16_t port) {}
+
+        void begin() {}
+        void end() {}
+
+        AsyncWebHandler& addHandler(AsyncWebHandler* handler) {
+            handlers.emplace_back(handler);
+            return *handler;
+        }
+        AsyncCallbackWebHandler& on(const char* uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest, ArBodyHandlerFunction onBody = nullptr) {
+            AsyncCallbackWebHandler* handler = new AsyncCallbackWebHandler(uri, method, onRequest, onBody);
+            addHandler(handler);
+            return *handler;
+        }
+
+        // Passes the body and then the request to the first handler that can handle it, returns false if there is none
+        bool handle(AsyncWebServerRequest* request, uint8_t* body = nullptr, size_t length = 0) {
+            for (std::unique_ptr<AsyncWebHandler>& handler : handlers) {
+                if (handler->canHandle(request)) {
+                    if (body && length > 0) {
+                        handler->handleBody(request, body, length, 0, length);
+                    }
+                    handler->handleRequest(request);
+                    return true;
+                }
+            }
+            return false;
+        }
+};
@@ -0,0 +1,39 @@
+#pragma once
+#include <Arduino.h>
+#include <map>
+#include <vector>
+
+// An in-memory filesystem, which starts empty and is cleared by format()
+class File {
+    private:
+        std::string path;
+        bool isWrite = false;
+        bool isOpen = false;
+        size_t position = 0;
+        std::vector<uint8_t> data;
+    public:
+        File() {}
+        File(const std::string& path, const char* mode);
+
+        explicit operator bool() const { return isOpen; }
+        size_t size() const { return data.size(); }
+        size_t read(uint8_t* buffer, size_t size);
+        size_t write(const uint8_t* buffer, size_t size);
+        void close();
+};
+
+class LittleFSClass {
+    public:
+        std::map<std::string, std::vector<uint8_t>> files;
+
+        bool begin() { return true; }
+        void end() {}
+        bool format() { files.clear(); return true; }
+        bool exists(const String& path) const { return files.count(path.c_str()) > 0; }
+        File open(const String& path, const char* mode) { return File(path.c_str(), mode); }
+        bool remove(const String& path) { return files.erase(path.c_str()) > 0; }
+        bool rename(const String& from, const String& to);
+        bool mkdir(const String& path) { return true; }
+};
+
+extern LittleFSClass LittleFS;
@@ -0,0 +1,15 @@
+#pragma once
+#include <stdint.h>
+
+/**
+ * Controls the time reported by millis() and micros() on the host
+ *
+ * Time starts at 0 and only advances when told to, so rendering is fully deterministic
+ */
+namespace NativeClock {
+    void setMicros(uint64_t micros);
+    void advanceMicros(uint64_t micros);
+    void advanceMillis(uint32_t millis);
+    // The full time, since micros() wraps like it does on the device
+    uint64_t getMicros();
+}
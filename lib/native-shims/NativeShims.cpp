@@ -0,0 +1,126 @@
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <ESP8266WiFi.h>
+#include <NeoPixelBus.h>
+
+namespace {
+    uint64_t currentMicros = 0;
+    uint32_t randomState = 0;
+}
+
+void NativeClock::setMicros(uint64_t micros) {
+    currentMicros = micros;
+}
+
+void NativeClock::advanceMicros(uint64_t micros) {
+    currentMicros += micros;
+}
+
+void NativeClock::advanceMillis(uint32_t millis) {
+    currentMicros += (uint64_t)millis * 1000;
+}
+
+uint64_t NativeClock::getMicros() {
+    return currentMicros;
+}
+
+unsigned long millis() {
+    return (unsigned long)(currentMicros / 1000);
+}
+
+unsigned long micros() {
+    return (unsigned long)currentMicros;
+}
+
+// A 32 bit LCG, the same sequence on every host
+long random(long max) {
+    if (max <= 0) return 0;
+    randomState = randomState * 1664525UL + 1013904223UL;
+    return (randomState >> 8) % max;
+}
+
+long random(long min, long max) {
+    if (min >= max) return min;
+    return min + random(max - min);
+}
+
+void randomSeed(unsigned long seed) {
+    randomState = seed;
+}
+
+void yield() {}
+
+void delay(unsigned long ms) {
+    NativeClock::advanceMillis(ms);
+}
+
+bool NeoTransmissionLog::isRecording = false;
+std::vector<NeoTransmission> NeoTransmissionLog::transmissions;
+
+LittleFSClass LittleFS;
+
+File::File(const std::string& path, const char* mode): path(path) {
+    isWrite = mode[0] == 'w';
+    if (isWrite) {
+        isOpen = true;
+    } else {
+        auto file = LittleFS.files.find(path);
+        if (file != LittleFS.files.end()) {
+            isOpen = true;
+            data = file->second;
+        }
+    }
+}
+
+size_t File::read(uint8_t* buffer, size_t size) {
+    if (!isOpen || isWrite) return 0;
+    size_t readSize = std::min(size, data.size() - position);
+    memcpy(buffer, data.data() + position, readSize);
+    position += readSize;
+    return readSize;
+}
+
+size_t File::write(const uint8_t* buffer, size_t size) {
+    if (!isOpen || !isWrite) return 0;
+    data.insert(data.end(), buffer, buffer + size);
+    return size;
+}
+
+void File::close() {
+    if (isOpen && isWrite) {
+        LittleFS.files[path] = data;
+    }
+    isOpen = false;
+}
+
+bool LittleFSClass::rename(const String& from, const String& to) {
+    auto file = files.find(from.c_str());
+    if (file == files.end()) return false;
+    std::vector<uint8_t> data = std::move(file->second);
+    files.erase(file);
+    files[to.c_str()] = std::move(data);
+    return true;
+}
+
+ESP8266WiFiClass WiFi;
+
+WiFiEventHandler ESP8266WiFiClass::onStationModeGotIP(std::function<void(const WiFiEventStationModeGotIP&)> handler) {
+    gotIPHandler = handler;
+    return std::make_shared<int>(0);
+}
+
+WiFiEventHandler ESP8266WiFiClass::onStationModeDisconnected(std::function<void(const WiFiEventStationModeDisconnected&)> handler) {
+    disconnectedHandler = handler;
+    return std::make_shared<int>(0);
+}
+
+void ESP8266WiFiClass::simulateGotIP(const IPAddress& ip) {
+    currentStatus = WL_CONNECTED;
+    this->ip = ip;
+    if (gotIPHandler) gotIPHandler(WiFiEventStationModeGotIP{ip, IPAddress(255,255,255,0), IPAddress()});
+}
+
+void ESP8266WiFiClass::simulateDisconnected() {
+    currentStatus = WL_DISCONNECTED;
+    if (disconnectedHandler) disconnectedHandler(WiFiEventStationModeDisconnected{1});
+}
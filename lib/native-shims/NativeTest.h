@@ -0,0 +1,82 @@
+#pragma once
+#include <stdint.h>
+#include <vector>
+#include <unity.h>
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <LightWeaver/Color.h>
+#include <LightWeaver/Features.h>
+
+#include "NativeClock.h"
+
+/**
+ * Fixtures shared by the host tests
+ */
+namespace NativeTest {
+    /**
+     * Keeps the pixels written by the core, and the pixels of the last frame shown
+     *
+     * The core creates its own driver, so the pixels are kept in static members. Each ID has its own
+     * members, for tests that need several drivers at once.
+     */
+    template <int ID = 0>
+    class CapturingDriver {
+        public:
+            static const int SupportedFeatures = LightWeaver::SupportedFeature::BRIGHTNESS | LightWeaver::SupportedFeature::COLOR | LightWeaver::SupportedFeature::ANIMATION | LightWeaver::SupportedFeature::ADDRESSABLE;
+            static const bool IsAsync = true;
+
+            static std::vector<LightWeaver::RgbColor> pixels;
+            static std::vector<LightWeaver::RgbColor> shownPixels;
+            static uint32_t frameCount;
+            // When set, the RGB values of every frame shown are appended to frames. Off by default,
+            // since growing frames allocates while the core renders
+            static bool isRecordingFrames;
+            static std::vector<uint8_t> frames;
+
+            CapturingDriver(uint16_t pixelCount) {
+                pixels.assign(pixelCount, LightWeaver::RgbColor());
+                shownPixels.assign(pixelCount, LightWeaver::RgbColor());
+                frameCount = 0;
+                frames.clear();
+            }
+            void setup() {}
+            void setColor(LightWeaver::RgbColor color) {
+                pixels.assign(pixels.size(), color);
+            }
+            void setColor(LightWeaver::RgbColor color, uint16_t index, uint16_t length) {
+                for (uint16_t i = index; i < index + length; i++) {
+                    TEST_ASSERT_TRUE_MESSAGE(i < pixels.size(), "Pixel written past the end of the strip");
+                    pixels[i] = color;
+                }
+            }
+            void loop() {
+                frameCount++;
+                shownPixels = pixels;
+                if (isRecordingFrames) {
+                    for (const LightWeaver::RgbColor& pixel : pixels) {
+                        frames.push_back(pixel.R);
+                        frames.push_back(pixel.G);
+                        frames.push_back(pixel.B);
+                    }
+                }
+            }
+    };
+
+    template <int ID>
+    std::vector<LightWeaver::RgbColor> CapturingDriver<ID>::pixels;
+    template <int ID>
+    std::vector<LightWeaver::RgbColor> CapturingDriver<ID>::shownPixels;
+    template <int ID>
+    uint32_t CapturingDriver<ID>::frameCount = 0;
+    template <int ID>
+    bool CapturingDriver<ID>::isRecordingFrames = false;
+    template <int ID>
+    std::vector<uint8_t> CapturingDriver<ID>::frames;
+
+    // Starts every test from the same time, random sequence and empty filesystem (so no scene is restored)
+    inline void reset() {
+        NativeClock::setMicros(1000000);
+        randomSeed(1);
+        LittleFS.format();
+    }
+}
@@ -0,0 +1,92 @@
+#pragma once
+#include <Arduino.h>
+#include <memory>
+#include <vector>
+
+// Only the NeoPixelBus API used by the LightWeaver drivers, pixels are kept in memory and Show() only simulates the timing
+struct RgbColor {
+    uint8_t R, G, B;
+    RgbColor(uint8_t r = 0, uint8_t g = 0, uint8_t b = 0): R(r), G(g), B(b) {}
+};
+
+struct RgbwColor {
+    uint8_t R, G, B, W;
+    RgbwColor(uint8_t r = 0, uint8_t g = 0, uint8_t b = 0, uint8_t w = 0): R(r), G(g), B(b), W(w) {}
+    RgbwColor(const RgbColor& color): R(color.R), G(color.G), B(color.B), W(0) {}
+};
+
+struct NeoGrbFeature { typedef RgbColor ColorObject; };
+struct NeoRgbFeature { typedef RgbColor ColorObject; };
+struct NeoGrbwFeature { typedef RgbwColor ColorObject; };
+struct NeoRgbwFeature { typedef RgbwColor ColorObject; };
+
+// Asynchronous methods send in the background, as DMA and the async UART do on the ESP8266.
+// The others block in Show() until every pixel is sent
+struct NeoEsp8266Dma800KbpsMethod { static const bool IsAsync = true; };
+struct NeoEsp8266Uart1800KbpsMethod { static const bool IsAsync = false; };
+struct NeoEsp8266AsyncUart1800KbpsMethod { static const bool IsAsync = true; };
+struct NeoEsp8266BitBang800KbpsMethod { static const bool IsAsync = false; };
+
+// Simulated transmission of a bus, from Show() until the strip has latched the pixels
+struct NeoTransmission {
+    const void* bus;
+    uint16_t pixelCount;
+    uint64_t start;
+    uint64_t end;
+    // The pixels as they were when the transmission started
+    std::vector<uint8_t> data;
+};
+
+// Records every transmission while isRecording is set, for tests of output timing
+struct NeoTransmissionLog {
+    static bool isRecording;
+    static std::vector<NeoTransmission> transmissions;
+};
+
+template <typename T_COLOR_FEATURE, typename T_METHOD>
+class NeoPixelBus {
+    protected:
+        typedef typename T_COLOR_FEATURE::ColorObject ColorObject;
+        // 800Kbps sends a byte every 10us, and the strip latches after 50us without data
+        static const uint32_t BYTE_TIME = 10;
+        static const uint32_t LATCH_TIME = 50;
+
+        uint16_t pixelCount;
+        std::unique_ptr<ColorObject[]> pixels;
+        uint64_t transmissionEnd = 0;
+    public:
+        NeoPixelBus(uint16_t pixelCount):
+            pixelCount(pixelCount),
+            pixels(new ColorObject[pixelCount]) {}
+        NeoPixelBus(uint16_t pixelCount, uint8_t pin): NeoPixelBus(pixelCount) {}
+        NeoPixelBus(NeoPixelBus&& other) = default;
+
+        void Begin() {}
+        // Advances the clock by the time the real method would block for
+        void Show() {
+            // A bus that is still sending waits for the previous transmission first
+            uint64_t start = std::max(NativeClock::getMicros(), transmissionEnd);
+            transmissionEnd = start + (uint64_t)pixelCount * sizeof(ColorObject) * BYTE_TIME + LATCH_TIME;
+            if (NeoTransmissionLog::isRecording) {
+                const uint8_t* data = reinterpret_cast<const uint8_t*>(pixels.get());
+                NeoTransmissionLog::transmissions.push_back({this, pixelCount, start, transmissionEnd,
+                    std::vector<uint8_t>(data, data + pixelCount * sizeof(ColorObject))});
+            }
+            NativeClock::advanceMicros((T_METHOD::IsAsync ? start : transmissionEnd) - NativeClock::getMicros());
+        }
+        bool CanShow() const { return NativeClock::getMicros() >= transmissionEnd; }
+        uint16_t PixelCount() const { return pixelCount; }
+
+        void SetPixelColor(uint16_t index, ColorObject color) {
+            if (index < pixelCount) pixels[index] = color;
+        }
+        ColorObject GetPixelColor(uint16_t index) const {
+            return index < pixelCount ? pixels[index] : ColorObject();
+        }
+        void ClearTo(ColorObject color) {
+            ClearTo(color, 0, pixelCount - 1);
+        }
+        void ClearTo(ColorObject color, uint16_t first, uint16_t last) {
+            for (uint16_t i = first; i <= last && i < pixelCount; i++) pixels[i] = color;
+        }
+};
@@ -3,29 +3,30 @@
 #include <LightWeaverWifi.h>
 #include <LightWeaverHttpServer.h>
 #include <LightWeaverMdns.h>
+#include <LightWeaverPresets.h>
 #include <LightWeaver/drivers/NeoRgbDriver.h>
 
 using namespace LightWeaver;
 
 #define PIXEL_COUNT 12
 #define PIXEL_GROUP_SIZE 1
-#define MAX_PLUGINS 4
 #define DRIVER NeoRgbDriver<NeoGrbFeature, NeoEsp8266Dma800KbpsMethod>
+#define PLUGINS LightWeaverWifi, LightWeaverHttpServer, LightWeaverMdns, LightWeaverPresets
 
-// LightWeaverCoreImpl<NeoDriverSK6812_RGBW<PIXEL_GROUP_SIZE>,MAX_PLUGINS> lightWeaver(PIXEL_COUNT, 255);
-LightWeaverCoreImpl<DRIVER,MAX_PLUGINS> lightWeaver(PIXEL_COUNT, PIXEL_GROUP_SIZE, 255);
-// LightWeaverCoreImpl<NoopDriver,MAX_PLUGINS> lightWeaver(PIXEL_COUNT, 255);
+// LightWeaverCoreImpl<NeoDriverSK6812_RGBW<PIXEL_GROUP_SIZE>,PLUGINS> lightWeaver(PIXEL_COUNT, 255);
+LightWeaverCoreImpl<DRIVER,PLUGINS> lightWeaver(PIXEL_COUNT, PIXEL_GROUP_SIZE, 64);
+// LightWeaverCoreImpl<NoopDriver,PLUGINS> lightWeaver(PIXEL_COUNT, 255);
 
 void setup()
 {
     Serial.begin(115200);
     while(!Serial);
 
-    lightWeaver.addPlugin<LightWeaverWifi>();
-    lightWeaver.addPlugin<LightWeaverHttpServer>();
-    lightWeaver.addPlugin<LightWeaverMdns>();
     lightWeaver.setup();
-    lightWeaver.setBrightness(64);
+
+    const BootMetrics& metrics = lightWeaver.getBootMetrics();
+    Serial.printf("First frame after %uus (scene %s in %uus)\n", metrics.firstFrameTime,
+        metrics.isSceneRestored ? "restored" : "not restored", metrics.restoreDuration);
 }
 
 void loop()
@@ -0,0 +1,69 @@
+/**
+ * Host entry point for profiling the render path, built by the native environment
+ *
+ * Deserializes a ColorSource from stdin and renders it for a number of frames with the fake clock:
+ *   pio run -e native
+ *   echo '{"type":"HsvMeander"}' | valgrind --tool=callgrind .pio/build/native/program 150 1000
+ *
+ * Arguments are the pixel count and frame count. The wall clock time per frame is printed on exit,
+ * since the fake clock only advances between frames.
+ */
+#include <chrono>
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <LightWeaver.h>
+#include <LightWeaver/drivers/NeoRGBDriver.h>
+#include <internal/ColorSourceDeserializer.h>
+
+using namespace LightWeaver;
+
+#define DEFAULT_PIXEL_COUNT 150
+#define DEFAULT_FRAME_COUNT 1000
+#define FRAME_INTERVAL 20
+#define DRIVER NeoRgbDriver<NeoGrbFeature, NeoEsp8266Dma800KbpsMethod>
+
+static String readInput(FILE* input) {
+    String result;
+    char buffer[256];
+    size_t length;
+    while ((length = fread(buffer, 1, sizeof(buffer), input)) > 0) {
+        result.concat(buffer, length);
+    }
+    return result;
+}
+
+int main(int argc, char** argv) {
+    uint16_t pixelCount = argc > 1 ? atoi(argv[1]) : DEFAULT_PIXEL_COUNT;
+    uint32_t frameCount = argc > 2 ? atol(argv[2]) : DEFAULT_FRAME_COUNT;
+
+    String json = readInput(stdin);
+    DynamicJsonDocument doc(16384);
+    DeserializationError error = deserializeJson(doc, json.c_str());
+    if (error) {
+        fprintf(stderr, "Invalid JSON: %s\n", error.c_str());
+        return 1;
+    }
+
+    ColorSourceDeserializer::Result result = ColorSourceDeserializer::deserialize(doc.as<JsonVariant>());
+    if (!result.success) {
+        fprintf(stderr, "Invalid ColorSource: %s\n", result.error.c_str());
+        return 1;
+    }
+
+    LightWeaverCoreImpl<DRIVER> lightWeaver(pixelCount, 1);
+    // Every loop() renders a whole frame, so the frame count is exact
+    lightWeaver.setRenderBudget(0);
+    lightWeaver.setup();
+    lightWeaver.setColorSource(*result.value);
+
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < frameCount; i++) {
+        NativeClock::advanceMillis(FRAME_INTERVAL);
+        lightWeaver.loop();
+    }
+    std::chrono::nanoseconds duration = std::chrono::steady_clock::now() - startTime;
+
+    printf("Rendered %u frames of %u pixels in %.3fms (%.0fns per frame)\n", frameCount, pixelCount,
+        duration.count() / 1e6, frameCount ? (double)duration.count() / frameCount : 0.0);
+    return 0;
+}
@@ -0,0 +1,129 @@
+/**
+ * Heap allocation tests
+ *
+ * Checks that rendering a steady scene does not allocate, since allocation churn fragments the small
+ * ESP8266 heap. Requires a build with the allocation audit enabled, which the native-audit environment
+ * provides:
+ *   pio test -e native-audit
+ */
+#include <unity.h>
+#include <LightWeaver.h>
+#include <LightWeaver/colorSources/SolidColorSource.h>
+#include <LightWeaver/colorSources/FadeColorSource.h>
+#include <LightWeaver/colorSources/GradientColorSource.h>
+#include <LightWeaver/colorSources/HsvMeanderColorSource.h>
+#include <LightWeaver/colorSources/OverlayColorSource.h>
+#include <LightWeaver/util/AllocationAudit.h>
+#include <NativeTest.h>
+
+#ifndef LIGHTWEAVER_ALLOCATION_AUDIT
+#error "test_allocations requires LIGHTWEAVER_ALLOCATION_AUDIT, run it with the native-audit environment"
+#endif
+
+using namespace LightWeaver;
+
+#define PIXEL_COUNT 150
+#define FRAME_INTERVAL 20
+// Long enough for transitions to finish, key frame buffers to be allocated and the scene to be persisted
+#define SETTLE_TIME 3000
+#define MEASURED_FRAMES 200
+
+namespace {
+    typedef LightWeaverCoreImpl<NativeTest::CapturingDriver<>> Core;
+
+    const RgbaColor RED{255, 0, 0, 255};
+    const RgbaColor BLUE{0, 0, 255, 255};
+
+    Gradient createGradient() {
+        RgbaColor colors[] = {RED, RgbaColor(0, 255, 0, 255), BLUE};
+        return Gradient(ColorSet(3, colors));
+    }
+
+    void renderFrames(Core& core, uint32_t frameCount) {
+        for (uint32_t i = 0; i < frameCount; i++) {
+            NativeClock::advanceMillis(FRAME_INTERVAL);
+            core.loop();
+        }
+    }
+
+    // Renders the ColorSource until it is steady, and returns the allocations made by the frames after that
+    uint32_t countSteadyStateAllocations(const ColorSource& colorSource) {
+        Core core(PIXEL_COUNT, 1);
+        core.setRenderBudget(0);
+        core.setup();
+        core.setColorSource(colorSource);
+        renderFrames(core, SETTLE_TIME / FRAME_INTERVAL);
+
+        uint32_t start = AllocationAudit::getCounts().allocations;
+        renderFrames(core, MEASURED_FRAMES);
+        return AllocationAudit::getCounts().allocations - start;
+    }
+}
+
+void setUp() {
+    NativeTest::reset();
+    AllocationAudit::reset();
+}
+
+void tearDown() {}
+
+void test_allocations_are_counted() {
+    uint32_t start = AllocationAudit::getCounts().allocations;
+    // Stored in a volatile pointer so that the optimizer cannot remove the allocation
+    void* volatile value = malloc(sizeof(int));
+    TEST_ASSERT_EQUAL_UINT32(start + 1, AllocationAudit::getCounts().allocations);
+    free(value);
+}
+
+void test_sites() {
+    Core core(PIXEL_COUNT, 1);
+    core.setup();
+    core.setColorSource(SolidColorSource(1, RED));
+    renderFrames(core, 3);
+
+    const AllocationAudit::Site* setColorSource = AllocationAudit::getSite("setColorSource");
+    TEST_ASSERT_EQUAL_UINT32(1, setColorSource->calls);
+    TEST_ASSERT_TRUE(setColorSource->last.allocations > 0);
+
+    const AllocationAudit::Site* loop = AllocationAudit::getSite("loop");
+    TEST_ASSERT_EQUAL_UINT32(3, loop->calls);
+}
+
+void test_solid() {
+    TEST_ASSERT_EQUAL_UINT32(0, countSteadyStateAllocations(SolidColorSource(1, RED)));
+}
+
+void test_fade() {
+    TEST_ASSERT_EQUAL_UINT32(0, countSteadyStateAllocations(FadeColorSource(1, RED, BLUE, 1000, true, Easing::QuadraticInOut)));
+}
+
+void test_gradient() {
+    TEST_ASSERT_EQUAL_UINT32(0, countSteadyStateAllocations(GradientColorSource(1, createGradient(), 3000, true, Easing::Linear, PixelOffsetConfig::withScale(0.5))));
+}
+
+void test_gradient_random() {
+    TEST_ASSERT_EQUAL_UINT32(0, countSteadyStateAllocations(GradientColorSource(1, createGradient(), 3000, true, Easing::Linear, PixelOffsetConfig::withRandom())));
+}
+
+void test_hsv_meander() {
+    TEST_ASSERT_EQUAL_UINT32(0, countSteadyStateAllocations(HsvMeanderColorSource(1, HsvaColor(200, 0.8, 0.7), 10000, 60, 0.2, 0.3, PixelOffsetConfig::withScale(0.2))));
+}
+
+void test_overlay() {
+    GradientColorSource background(2, createGradient(), 2000, true, Easing::Linear, PixelOffsetConfig::withScale(1.0));
+    FadeColorSource overlay(3, RgbaColor(255, 255, 255, 0), RgbaColor(255, 255, 255, 128), 1000, true, Easing::Linear);
+    TEST_ASSERT_EQUAL_UINT32(0, countSteadyStateAllocations(OverlayColorSource(1, background, overlay)));
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_allocations_are_counted);
+    RUN_TEST(test_sites);
+    RUN_TEST(test_solid);
+    RUN_TEST(test_fade);
+    RUN_TEST(test_gradient);
+    RUN_TEST(test_gradient_random);
+    RUN_TEST(test_hsv_meander);
+    RUN_TEST(test_overlay);
+    return UNITY_END();
+}
@@ -0,0 +1,350 @@
+/**
+ * Microbenchmarks for the render path
+ *
+ * Times each ColorSource, each easing function, Gradient::getColor, the color conversions and full
+ * LightWeaverCoreImpl::loop() frames. On the host results are in nanoseconds of wall clock time, on
+ * the device they are in CPU cycles from ESP.getCycleCount().
+ *
+ * Results are printed as a single line of JSON once every benchmark has run, e.g.
+ *   pio test -e native -f test_benchmark -v | grep '^{"benchmarks"'
+ *   pio test -e d1 -f test_benchmark -v | grep '^{"benchmarks"'
+ *
+ * Every result is the cost per pixel. Benchmarks that do not render pixels, such as the easing
+ * functions, count each call as one pixel.
+ */
+#include <unity.h>
+#include <vector>
+#include <LightWeaver.h>
+#include <LightWeaver/colorSources/SolidColorSource.h>
+#include <LightWeaver/colorSources/FadeColorSource.h>
+#include <LightWeaver/colorSources/GradientColorSource.h>
+#include <LightWeaver/colorSources/HsvMeanderColorSource.h>
+#include <LightWeaver/colorSources/OverlayColorSource.h>
+
+#ifndef ARDUINO
+#include <chrono>
+#include <LittleFS.h>
+#endif
+
+using namespace LightWeaver;
+
+// Number of calls timed together for the benchmarks that do not render pixels
+#define BATCH_SIZE 256
+// Pixels rendered by the ColorSource and Gradient benchmarks
+#define SOURCE_PIXEL_COUNT 150
+#define FRAME_INTERVAL 20
+
+namespace {
+#ifdef ARDUINO
+    typedef uint32_t Counter;
+    const char* PLATFORM = "esp8266";
+    const char* UNIT = "cycles";
+    // Each benchmark runs for at least this many cycles, well within the watchdog timeout
+    const Counter MINIMUM_DURATION = F_CPU / 20;
+
+    Counter readCounter() {
+        return ESP.getCycleCount();
+    }
+
+    void waitMillis(uint32_t duration) {
+        delay(duration);
+    }
+#else
+    typedef uint64_t Counter;
+    const char* PLATFORM = "native";
+    const char* UNIT = "ns";
+    const Counter MINIMUM_DURATION = 50000000;
+
+    Counter readCounter() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    void waitMillis(uint32_t duration) {
+        NativeClock::advanceMillis(duration);
+    }
+#endif
+
+    const uint32_t MINIMUM_ITERATIONS = 10;
+
+    struct BenchmarkResult {
+        String name;
+        uint16_t pixels;
+        uint32_t iterations;
+        float perPixel;
+    };
+
+    std::vector<BenchmarkResult> results;
+
+    // Keeps the compiler from discarding the work being timed
+    volatile uint32_t sink;
+
+    void consume(const RgbaColor& color) {
+        sink = sink + color.R + color.G + color.B + color.A;
+    }
+
+    void consume(const RgbColor& color) {
+        sink = sink + color.R + color.G + color.B;
+    }
+
+    void consume(float value) {
+        sink = sink + (uint32_t)(value * 255);
+    }
+
+    // Times iterations of body, each rendering the given number of pixels, until both the minimum
+    // duration and number of iterations are reached
+    template <typename BODY>
+    void runBenchmark(const String& name, uint16_t pixels, BODY body) {
+        body();
+
+        uint32_t iterations = 0;
+        Counter elapsed = 0;
+        while (elapsed < MINIMUM_DURATION || iterations < MINIMUM_ITERATIONS) {
+            Counter start = readCounter();
+            body();
+            elapsed += readCounter() - start;
+            iterations++;
+            yield();
+        }
+
+        results.push_back({name, pixels, iterations, (float)elapsed / iterations / pixels});
+    }
+
+    // Moves the animation of a ColorSource part way through, so that it is not benchmarked at its first frame
+    void setProgress(const ColorSource& colorSource, float progress) {
+        const Animation* animation = colorSource.getAnimation();
+        if (animation && animation->callback) {
+            animation->callback(AnimationParam(progress, animation->easingFunction(progress), 0, AnimationState::Running));
+        }
+    }
+
+    // Records the rendered pixels without sending them anywhere, so that only the core is measured
+    class BenchmarkDriver {
+        private:
+            std::unique_ptr<RgbColor[]> pixels;
+            uint16_t pixelCount;
+        public:
+            static const int SupportedFeatures = SupportedFeature::BRIGHTNESS | SupportedFeature::COLOR | SupportedFeature::ANIMATION | SupportedFeature::ADDRESSABLE;
+            BenchmarkDriver(uint16_t pixelCount):
+                pixels(new RgbColor[pixelCount]),
+                pixelCount(pixelCount) {}
+            void setup() {}
+            void setColor(RgbColor color, uint16_t index, uint16_t length) {
+                for (uint16_t i = index; i < index + length && i < pixelCount; i++) {
+                    pixels[i] = color;
+                }
+            }
+            void loop() {
+                consume(pixels[pixelCount - 1]);
+            }
+    };
+
+    const RgbaColor RED{255, 0, 0, 255};
+    const RgbaColor BLUE{0, 0, 255, 255};
+
+    Gradient createGradient() {
+        RgbaColor colors[] = {RED, RgbaColor(0, 255, 0, 255), BLUE};
+        return Gradient(ColorSet(3, colors));
+    }
+
+    void benchmarkColorSource(const String& name, const ColorSource& colorSource) {
+        std::unique_ptr<ColorSource> instance{colorSource.clone()};
+        setProgress(*instance, 0.37f);
+        runBenchmark("ColorSource/" + name, SOURCE_PIXEL_COUNT, [&]() {
+            for (uint16_t i = 0; i < SOURCE_PIXEL_COUNT; i++) {
+                consume(instance->getColor(i, SOURCE_PIXEL_COUNT));
+            }
+        });
+    }
+
+    void benchmarkFrame(const String& name, uint16_t pixelCount, const ColorSource& colorSource) {
+        LightWeaverCoreImpl<BenchmarkDriver> core(pixelCount, 1);
+        core.setRenderBudget(0);
+        core.setup();
+        core.setColorSource(colorSource);
+        // Lets the transition from the empty scene finish, so that only the ColorSource is rendered
+        waitMillis(1000);
+        core.loop();
+
+        runBenchmark("Frame/" + name + "/" + String(pixelCount), pixelCount, [&]() {
+#ifndef ARDUINO
+            NativeClock::advanceMillis(FRAME_INTERVAL);
+#endif
+            core.loop();
+        });
+    }
+}
+
+void setUp() {
+#ifndef ARDUINO
+    NativeClock::setMicros(1000000);
+    LittleFS.format();
+#endif
+    randomSeed(1);
+}
+
+void tearDown() {}
+
+void test_color_sources() {
+    benchmarkColorSource("Solid", SolidColorSource(1, RED));
+    benchmarkColorSource("Fade", FadeColorSource(1, RED, BLUE, 2000, true, Easing::QuadraticInOut));
+    benchmarkColorSource("Gradient", GradientColorSource(1, createGradient(), 3000, true, Easing::Linear, PixelOffsetConfig::withScale(0.5)));
+    benchmarkColorSource("Gradient/Random", GradientColorSource(1, createGradient(), 3000, true, Easing::Linear, PixelOffsetConfig::withRandom()));
+    benchmarkColorSource("HsvMeander", HsvMeanderColorSource(1, HsvaColor(200, 0.8, 0.7), 10000, 60, 0.2, 0.3, PixelOffsetConfig::withScale(0.2)));
+    GradientColorSource background(2, createGradient(), 2000, true, Easing::Linear, PixelOffsetConfig::withScale(1.0));
+    FadeColorSource overlay(3, RgbaColor(255, 255, 255, 0), RgbaColor(255, 255, 255, 128), 1000, true, Easing::Linear);
+    benchmarkColorSource("Overlay", OverlayColorSource(1, background, overlay));
+}
+
+void test_easings() {
+    struct EasingCase {
+        const char* name;
+        EasingFunction easing;
+    };
+
+    const EasingCase easings[] = {
+        {"Linear", Easing::Linear},
+        {"QuadraticIn", Easing::QuadraticIn},
+        {"QuadraticOut", Easing::QuadraticOut},
+        {"QuadraticInOut", Easing::QuadraticInOut},
+        {"CubicIn", Easing::CubicIn},
+        {"CubicOut", Easing::CubicOut},
+        {"CubicInOut", Easing::CubicInOut},
+        {"QuarticIn", Easing::QuarticIn},
+        {"QuarticOut", Easing::QuarticOut},
+        {"QuarticInOut", Easing::QuarticInOut},
+        {"QuinticIn", Easing::QuinticIn},
+        {"QuinticOut", Easing::QuinticOut},
+        {"QuinticInOut", Easing::QuinticInOut},
+        {"SinusoidalIn", Easing::SinusoidalIn},
+        {"SinusoidalOut", Easing::SinusoidalOut},
+        {"SinusoidalInOut", Easing::SinusoidalInOut},
+        {"ExponentialIn", Easing::ExponentialIn},
+        {"ExponentialOut", Easing::ExponentialOut},
+        {"ExponentialInOut", Easing::ExponentialInOut},
+        {"Mirror(QuadraticIn)", Easing::Mirror(Easing::QuadraticIn)},
+        {"Reverse(Mirror(SinusoidalIn))", Easing::Reverse(Easing::Mirror(Easing::SinusoidalIn))}
+    };
+
+    for (const EasingCase& easingCase : easings) {
+        const EasingFunction easing = easingCase.easing;
+        runBenchmark(String("Easing/") + easingCase.name, BATCH_SIZE, [&]() {
+            for (uint16_t i = 0; i < BATCH_SIZE; i++) {
+                consume(easing(i / (float)BATCH_SIZE));
+            }
+        });
+    }
+}
+
+void test_gradient() {
+    const Gradient gradient = createGradient();
+    runBenchmark("Gradient::getColor", BATCH_SIZE, [&]() {
+        for (uint16_t i = 0; i < BATCH_SIZE; i++) {
+            consume(gradient.getColor(i / (float)BATCH_SIZE));
+        }
+    });
+
+    RgbaColor colors[] = {RED, RgbaColor(0, 255, 0, 255), BLUE, RgbaColor(255, 255, 255, 255)};
+    uint8_t positions[] = {0, 40, 160, 255};
+    const Gradient positioned(ColorSet(4, colors), positions, Easing::CubicInOut);
+    runBenchmark("Gradient::getColor/Positions", BATCH_SIZE, [&]() {
+        for (uint16_t i = 0; i < BATCH_SIZE; i++) {
+            consume(positioned.getColor(i / (float)BATCH_SIZE));
+        }
+    });
+}
+
+void test_color_conversions() {
+    RgbColor rgb[BATCH_SIZE];
+    HsvaColor hsv[BATCH_SIZE];
+    HslaColor hsl[BATCH_SIZE];
+    for (uint16_t i = 0; i < BATCH_SIZE; i++) {
+        rgb[i] = RgbColor(random(256), random(256), random(256));
+        hsv[i] = HsvaColor(random(360), random(101) / 100.0f, random(101) / 100.0f);
+        hsl[i] = HslaColor(random(360), random(101) / 100.0f, random(101) / 100.0f);
+    }
+
+    runBenchmark("Color/HsvaColor->RgbColor", BATCH_SIZE, [&]() {
+        for (uint16_t i = 0; i < BATCH_SIZE; i++) {
+            consume(RgbColor(hsv[i]));
+        }
+    });
+    runBenchmark("Color/HslaColor->RgbColor", BATCH_SIZE, [&]() {
+        for (uint16_t i = 0; i < BATCH_SIZE; i++) {
+            consume(RgbColor(hsl[i]));
+        }
+    });
+    runBenchmark("Color/RgbColor->HsvaColor", BATCH_SIZE, [&]() {
+        for (uint16_t i = 0; i < BATCH_SIZE; i++) {
+            consume(HsvaColor(rgb[i]).H);
+        }
+    });
+    runBenchmark("Color/RgbColor->HslaColor", BATCH_SIZE, [&]() {
+        for (uint16_t i = 0; i < BATCH_SIZE; i++) {
+            consume(HslaColor(rgb[i]).H);
+        }
+    });
+    runBenchmark("Color/RgbColor::linearBlend", BATCH_SIZE, [&]() {
+        for (uint16_t i = 0; i < BATCH_SIZE; i++) {
+            consume(RgbColor::linearBlend(rgb[i], rgb[BATCH_SIZE - 1 - i], i / (float)BATCH_SIZE));
+        }
+    });
+    runBenchmark("Color/RgbaColor::linearBlend", BATCH_SIZE, [&]() {
+        for (uint16_t i = 0; i < BATCH_SIZE; i++) {
+            consume(RgbaColor::linearBlend(RgbaColor(rgb[i]), RgbaColor(rgb[BATCH_SIZE - 1 - i]), i / (float)BATCH_SIZE));
+        }
+    });
+}
+
+void test_frames() {
+    const uint16_t pixelCounts[] = {12, 150, 600};
+    for (uint16_t pixelCount : pixelCounts) {
+        benchmarkFrame("Solid", pixelCount, SolidColorSource(1, RED));
+        benchmarkFrame("Gradient", pixelCount, GradientColorSource(1, createGradient(), 3000, true, Easing::Linear, PixelOffsetConfig::withScale(0.5)));
+        benchmarkFrame("Gradient/Random", pixelCount, GradientColorSource(1, createGradient(), 3000, true, Easing::Linear, PixelOffsetConfig::withRandom()));
+        benchmarkFrame("HsvMeander", pixelCount, HsvMeanderColorSource(1, HsvaColor(200, 0.8, 0.7), 10000, 60, 0.2, 0.3, PixelOffsetConfig::withScale(0.2)));
+    }
+}
+
+// Names are generated by the benchmarks above and never need escaping
+void printResults() {
+    String json = String("{\"benchmarks\":{\"platform\":\"") + PLATFORM + "\",\"unit\":\"" + UNIT + "\",\"results\":[";
+    for (size_t i = 0; i < results.size(); i++) {
+        const BenchmarkResult& result = results[i];
+        if (i > 0) json += ",";
+        json += "{\"name\":\"" + result.name + "\",\"pixels\":" + String(result.pixels)
+            + ",\"iterations\":" + String(result.iterations)
+            + ",\"perPixel\":" + String(result.perPixel, 3) + "}";
+    }
+    json += "]}}";
+#ifdef ARDUINO
+    Serial.println(json);
+#else
+    printf("%s\n", json.c_str());
+#endif
+}
+
+void runBenchmarks() {
+    UNITY_BEGIN();
+    RUN_TEST(test_color_sources);
+    RUN_TEST(test_easings);
+    RUN_TEST(test_gradient);
+    RUN_TEST(test_color_conversions);
+    RUN_TEST(test_frames);
+    printResults();
+    UNITY_END();
+}
+
+#ifdef ARDUINO
+void setup() {
+    // Gives the test runner time to open the serial port
+    delay(2000);
+    runBenchmarks();
+}
+
+void loop() {}
+#else
+int main(int argc, char** argv) {
+    runBenchmarks();
+    return 0;
+}
+#endif
@@ -0,0 +1,116 @@
+/**
+ * Temporal dithering tests
+ *
+ * Checks that pixels average to their exact output level over several frames. Requires a build with
+ * dithering enabled, which the native-dithering environment provides:
+ *   pio test -e native-dithering
+ */
+#include <unity.h>
+#include <vector>
+#include <LightWeaver.h>
+#include <LightWeaver/OutputLut.h>
+#include <LightWeaver/colorSources/SolidColorSource.h>
+#include <NativeTest.h>
+
+#ifndef LIGHTWEAVER_DITHERING
+#error "test_dithering requires LIGHTWEAVER_DITHERING, run it with the native-dithering environment"
+#endif
+
+using namespace LightWeaver;
+
+#define PIXEL_COUNT 4
+#define FRAME_COUNT 256
+
+namespace {
+    typedef NativeTest::CapturingDriver<> CapturingDriver;
+
+    // Average red level shown for the color over FRAME_COUNT frames
+    float getAverageLevel(const OutputLut& lut, const FrameColor& color) {
+        DitherError error;
+        uint32_t total = 0;
+        for (uint16_t i = 0; i < FRAME_COUNT; i++) {
+            total += lut.apply(color, error).R;
+        }
+        return (float)total / FRAME_COUNT;
+    }
+}
+
+void setUp() {
+    NativeTest::reset();
+}
+
+void tearDown() {}
+
+void test_full_levels_are_not_dithered() {
+    OutputLut lut;
+    DitherError error;
+    for (uint16_t i = 0; i < FRAME_COUNT; i++) {
+        TEST_ASSERT_EQUAL_UINT8(255, lut.apply(FrameColor(RgbColor(255, 255, 255)), error).R);
+        TEST_ASSERT_EQUAL_UINT8(0, lut.apply(FrameColor(), error).G);
+        TEST_ASSERT_EQUAL_UINT8(100, lut.apply(FrameColor(RgbColor(0, 0, 100)), error).B);
+    }
+}
+
+void test_fractional_levels() {
+    OutputLut lut;
+    // Halfway between 18 and 19
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 18.5f, getAverageLevel(lut, FrameColor(18 * 256 + 128, 0, 0)));
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 200.25f, getAverageLevel(lut, FrameColor(200 * 256 + 64, 0, 0)));
+}
+
+void test_low_brightness_levels() {
+    OutputLut lut;
+    lut.setBrightness(64);
+    // Without dithering 100 and 101 are both shown as 25
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 100 * 64 / 255.0f, getAverageLevel(lut, FrameColor(RgbColor(100, 0, 0))));
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 101 * 64 / 255.0f, getAverageLevel(lut, FrameColor(RgbColor(101, 0, 0))));
+}
+
+void test_gamma_levels() {
+    OutputLut lut;
+    ColorCalibration calibration;
+    calibration.gamma = 2.2f;
+    lut.setCalibration(calibration);
+    for (uint16_t i = 0; i < 256; i += 15) {
+        TEST_ASSERT_FLOAT_WITHIN(0.02f, powf(i / 255.0f, 2.2f) * 255.0f, getAverageLevel(lut, FrameColor(RgbColor(i, 0, 0))));
+    }
+}
+
+void test_core_dithers_frames() {
+    LightWeaverCoreImpl<CapturingDriver> core(PIXEL_COUNT, 1, 64);
+    core.setRenderBudget(0);
+    core.setup();
+    core.setColorSource(SolidColorSource(1, RgbaColor(100, 0, 0, 255)));
+    for (uint16_t i = 0; i < 50; i++) {
+        NativeClock::advanceMillis(20);
+        core.loop();
+    }
+
+    CapturingDriver::frames.clear();
+    CapturingDriver::isRecordingFrames = true;
+    for (uint16_t i = 0; i < FRAME_COUNT; i++) {
+        NativeClock::advanceMillis(1);
+        core.loop();
+    }
+    // The red level of the first pixel of every frame shown
+    const std::vector<uint8_t>& frames = CapturingDriver::frames;
+    uint32_t frameCount = frames.size() / (PIXEL_COUNT * 3);
+    uint32_t total = 0;
+    for (uint32_t i = 0; i < frameCount; i++) {
+        uint8_t level = frames[i * PIXEL_COUNT * 3];
+        TEST_ASSERT_TRUE(level == 25 || level == 26);
+        total += level;
+    }
+    TEST_ASSERT_TRUE(frameCount >= FRAME_COUNT);
+    TEST_ASSERT_FLOAT_WITHIN(0.02f, 100 * 64 / 255.0f, (float)total / frameCount);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_full_levels_are_not_dithered);
+    RUN_TEST(test_fractional_levels);
+    RUN_TEST(test_low_brightness_levels);
+    RUN_TEST(test_gamma_levels);
+    RUN_TEST(test_core_dithers_frames);
+    return UNITY_END();
+}
@@ -0,0 +1,838 @@
+#pragma once
+// Generated by test_golden_frames with GOLDEN_FRAMES_UPDATE defined, do not edit by hand
+#include <stdint.h>
+
+struct GoldenFrames {
+    const char* name;
+    const uint8_t* frames;
+    uint32_t size;
+};
+
+// solid
+static const uint8_t GOLDEN_FRAMES_0[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    5,2,0,5,2,0,5,2,0,5,2,0,5,2,0,5,2,0,5,2,0,5,2,0,5,2,0,5,2,0,5,2,0,5,2,0,
+    20,10,0,20,10,0,20,10,0,20,10,0,20,10,0,20,10,0,20,10,0,20,10,0,20,10,0,20,10,0,20,10,0,20,10,0,
+    45,23,0,45,23,0,45,23,0,45,23,0,45,23,0,45,23,0,45,23,0,45,23,0,45,23,0,45,23,0,45,23,0,45,23,0,
+    81,40,0,81,40,0,81,40,0,81,40,0,81,40,0,81,40,0,81,40,0,81,40,0,81,40,0,81,40,0,81,40,0,81,40,0,
+    127,64,0,127,64,0,127,64,0,127,64,0,127,64,0,127,64,0,127,64,0,127,64,0,127,64,0,127,64,0,127,64,0,127,64,0,
+    173,87,0,173,87,0,173,87,0,173,87,0,173,87,0,173,87,0,173,87,0,173,87,0,173,87,0,173,87,0,173,87,0,173,87,0,
+    209,104,0,209,104,0,209,104,0,209,104,0,209,104,0,209,104,0,209,104,0,209,104,0,209,104,0,209,104,0,209,104,0,209,104,0,
+    234,117,0,234,117,0,234,117,0,234,117,0,234,117,0,234,117,0,234,117,0,234,117,0,234,117,0,234,117,0,234,117,0,234,117,0,
+    255,128,0,255,128,0,255,128,0,255,128,0,255,128,0,255,128,0,255,128,0,255,128,0,255,128,0,255,128,0,255,128,0,255,128,0,
+    255,128,0,255,128,0,255,128,0,255,128,0,255,128,0,255,128,0,255,128,0,255,128,0,255,128,0,255,128,0,255,128,0,255,128,0
+};
+
+// fade/Linear
+static const uint8_t GOLDEN_FRAMES_1[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    29,0,1,29,0,1,29,0,1,29,0,1,29,0,1,29,0,1,29,0,1,29,0,1,29,0,1,29,0,1,29,0,1,29,0,1,
+    111,0,15,111,0,15,111,0,15,111,0,15,111,0,15,111,0,15,111,0,15,111,0,15,111,0,15,111,0,15,111,0,15,111,0,15,
+    207,0,47,207,0,47,207,0,47,207,0,47,207,0,47,207,0,47,207,0,47,207,0,47,207,0,47,207,0,47,207,0,47,207,0,47,
+    191,0,63,191,0,63,191,0,63,191,0,63,191,0,63,191,0,63,191,0,63,191,0,63,191,0,63,191,0,63,191,0,63,191,0,63,
+    175,0,79,175,0,79,175,0,79,175,0,79,175,0,79,175,0,79,175,0,79,175,0,79,175,0,79,175,0,79,175,0,79,175,0,79,
+    159,0,95,159,0,95,159,0,95,159,0,95,159,0,95,159,0,95,159,0,95,159,0,95,159,0,95,159,0,95,159,0,95,159,0,95,
+    143,0,111,143,0,111,143,0,111,143,0,111,143,0,111,143,0,111,143,0,111,143,0,111,143,0,111,143,0,111,143,0,111,143,0,111,
+    127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,
+    111,0,143,111,0,143,111,0,143,111,0,143,111,0,143,111,0,143,111,0,143,111,0,143,111,0,143,111,0,143,111,0,143,111,0,143,
+    95,0,159,95,0,159,95,0,159,95,0,159,95,0,159,95,0,159,95,0,159,95,0,159,95,0,159,95,0,159,95,0,159,95,0,159,
+    79,0,175,79,0,175,79,0,175,79,0,175,79,0,175,79,0,175,79,0,175,79,0,175,79,0,175,79,0,175,79,0,175,79,0,175,
+    63,0,191,63,0,191,63,0,191,63,0,191,63,0,191,63,0,191,63,0,191,63,0,191,63,0,191,63,0,191,63,0,191,63,0,191,
+    47,0,207,47,0,207,47,0,207,47,0,207,47,0,207,47,0,207,47,0,207,47,0,207,47,0,207,47,0,207,47,0,207,47,0,207,
+    31,0,223,31,0,223,31,0,223,31,0,223,31,0,223,31,0,223,31,0,223,31,0,223,31,0,223,31,0,223,31,0,223,31,0,223,
+    0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,
+    0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255
+};
+
+// fade/QuadraticIn
+static const uint8_t GOLDEN_FRAMES_2[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,
+    125,0,1,125,0,1,125,0,1,125,0,1,125,0,1,125,0,1,125,0,1,125,0,1,125,0,1,125,0,1,125,0,1,125,0,1,
+    246,0,8,246,0,8,246,0,8,246,0,8,246,0,8,246,0,8,246,0,8,246,0,8,246,0,8,246,0,8,246,0,8,246,0,8,
+    239,0,15,239,0,15,239,0,15,239,0,15,239,0,15,239,0,15,239,0,15,239,0,15,239,0,15,239,0,15,239,0,15,239,0,15,
+    230,0,24,230,0,24,230,0,24,230,0,24,230,0,24,230,0,24,230,0,24,230,0,24,230,0,24,230,0,24,230,0,24,230,0,24,
+    219,0,35,219,0,35,219,0,35,219,0,35,219,0,35,219,0,35,219,0,35,219,0,35,219,0,35,219,0,35,219,0,35,219,0,35,
+    206,0,48,206,0,48,206,0,48,206,0,48,206,0,48,206,0,48,206,0,48,206,0,48,206,0,48,206,0,48,206,0,48,206,0,48,
+    191,0,63,191,0,63,191,0,63,191,0,63,191,0,63,191,0,63,191,0,63,191,0,63,191,0,63,191,0,63,191,0,63,191,0,63,
+    174,0,80,174,0,80,174,0,80,174,0,80,174,0,80,174,0,80,174,0,80,174,0,80,174,0,80,174,0,80,174,0,80,174,0,80,
+    155,0,99,155,0,99,155,0,99,155,0,99,155,0,99,155,0,99,155,0,99,155,0,99,155,0,99,155,0,99,155,0,99,155,0,99,
+    134,0,120,134,0,120,134,0,120,134,0,120,134,0,120,134,0,120,134,0,120,134,0,120,134,0,120,134,0,120,134,0,120,134,0,120,
+    111,0,143,111,0,143,111,0,143,111,0,143,111,0,143,111,0,143,111,0,143,111,0,143,111,0,143,111,0,143,111,0,143,111,0,143,
+    86,0,168,86,0,168,86,0,168,86,0,168,86,0,168,86,0,168,86,0,168,86,0,168,86,0,168,86,0,168,86,0,168,86,0,168,
+    59,0,195,59,0,195,59,0,195,59,0,195,59,0,195,59,0,195,59,0,195,59,0,195,59,0,195,59,0,195,59,0,195,59,0,195,
+    0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,
+    0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255
+};
+
+// fade/QuadraticOut
+static const uint8_t GOLDEN_FRAMES_3[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    28,0,3,28,0,3,28,0,3,28,0,3,28,0,3,28,0,3,28,0,3,28,0,3,28,0,3,28,0,3,28,0,3,28,0,3,
+    97,0,29,97,0,29,97,0,29,97,0,29,97,0,29,97,0,29,97,0,29,97,0,29,97,0,29,97,0,29,97,0,29,97,0,29,
+    168,0,86,168,0,86,168,0,86,168,0,86,168,0,86,168,0,86,168,0,86,168,0,86,168,0,86,168,0,86,168,0,86,168,0,86,
+    143,0,111,143,0,111,143,0,111,143,0,111,143,0,111,143,0,111,143,0,111,143,0,111,143,0,111,143,0,111,143,0,111,143,0,111,
+    120,0,134,120,0,134,120,0,134,120,0,134,120,0,134,120,0,134,120,0,134,120,0,134,120,0,134,120,0,134,120,0,134,120,0,134,
+    99,0,155,99,0,155,99,0,155,99,0,155,99,0,155,99,0,155,99,0,155,99,0,155,99,0,155,99,0,155,99,0,155,99,0,155,
+    80,0,174,80,0,174,80,0,174,80,0,174,80,0,174,80,0,174,80,0,174,80,0,174,80,0,174,80,0,174,80,0,174,80,0,174,
+    63,0,191,63,0,191,63,0,191,63,0,191,63,0,191,63,0,191,63,0,191,63,0,191,63,0,191,63,0,191,63,0,191,63,0,191,
+    48,0,206,48,0,206,48,0,206,48,0,206,48,0,206,48,0,206,48,0,206,48,0,206,48,0,206,48,0,206,48,0,206,48,0,206,
+    35,0,219,35,0,219,35,0,219,35,0,219,35,0,219,35,0,219,35,0,219,35,0,219,35,0,219,35,0,219,35,0,219,35,0,219,
+    24,0,230,24,0,230,24,0,230,24,0,230,24,0,230,24,0,230,24,0,230,24,0,230,24,0,230,24,0,230,24,0,230,24,0,230,
+    15,0,239,15,0,239,15,0,239,15,0,239,15,0,239,15,0,239,15,0,239,15,0,239,15,0,239,15,0,239,15,0,239,15,0,239,
+    8,0,246,8,0,246,8,0,246,8,0,246,8,0,246,8,0,246,8,0,246,8,0,246,8,0,246,8,0,246,8,0,246,8,0,246,
+    3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,
+    0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,
+    0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255
+};
+
+// fade/QuadraticInOut
+static const uint8_t GOLDEN_FRAMES_4[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,
+    123,0,3,123,0,3,123,0,3,123,0,3,123,0,3,123,0,3,123,0,3,123,0,3,123,0,3,123,0,3,123,0,3,123,0,3,
+    237,0,17,237,0,17,237,0,17,237,0,17,237,0,17,237,0,17,237,0,17,237,0,17,237,0,17,237,0,17,237,0,17,237,0,17,
+    223,0,31,223,0,31,223,0,31,223,0,31,223,0,31,223,0,31,223,0,31,223,0,31,223,0,31,223,0,31,223,0,31,223,0,31,
+    205,0,49,205,0,49,205,0,49,205,0,49,205,0,49,205,0,49,205,0,49,205,0,49,205,0,49,205,0,49,205,0,49,205,0,49,
+    183,0,71,183,0,71,183,0,71,183,0,71,183,0,71,183,0,71,183,0,71,183,0,71,183,0,71,183,0,71,183,0,71,183,0,71,
+    157,0,97,157,0,97,157,0,97,157,0,97,157,0,97,157,0,97,157,0,97,157,0,97,157,0,97,157,0,97,157,0,97,157,0,97,
+    127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,
+    97,0,157,97,0,157,97,0,157,97,0,157,97,0,157,97,0,157,97,0,157,97,0,157,97,0,157,97,0,157,97,0,157,97,0,157,
+    71,0,183,71,0,183,71,0,183,71,0,183,71,0,183,71,0,183,71,0,183,71,0,183,71,0,183,71,0,183,71,0,183,71,0,183,
+    49,0,205,49,0,205,49,0,205,49,0,205,49,0,205,49,0,205,49,0,205,49,0,205,49,0,205,49,0,205,49,0,205,49,0,205,
+    31,0,223,31,0,223,31,0,223,31,0,223,31,0,223,31,0,223,31,0,223,31,0,223,31,0,223,31,0,223,31,0,223,31,0,223,
+    17,0,237,17,0,237,17,0,237,17,0,237,17,0,237,17,0,237,17,0,237,17,0,237,17,0,237,17,0,237,17,0,237,17,0,237,
+    7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,
+    0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,
+    0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255
+};
+
+// fade/CubicIn
+static const uint8_t GOLDEN_FRAMES_5[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,
+    127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,
+    253,0,1,253,0,1,253,0,1,253,0,1,253,0,1,253,0,1,253,0,1,253,0,1,253,0,1,253,0,1,253,0,1,253,0,1,
+    251,0,3,251,0,3,251,0,3,251,0,3,251,0,3,251,0,3,251,0,3,251,0,3,251,0,3,251,0,3,251,0,3,251,0,3,
+    247,0,7,247,0,7,247,0,7,247,0,7,247,0,7,247,0,7,247,0,7,247,0,7,247,0,7,247,0,7,247,0,7,247,0,7,
+    241,0,13,241,0,13,241,0,13,241,0,13,241,0,13,241,0,13,241,0,13,241,0,13,241,0,13,241,0,13,241,0,13,241,0,13,
+    233,0,21,233,0,21,233,0,21,233,0,21,233,0,21,233,0,21,233,0,21,233,0,21,233,0,21,233,0,21,233,0,21,233,0,21,
+    223,0,31,223,0,31,223,0,31,223,0,31,223,0,31,223,0,31,223,0,31,223,0,31,223,0,31,223,0,31,223,0,31,223,0,31,
+    209,0,45,209,0,45,209,0,45,209,0,45,209,0,45,209,0,45,209,0,45,209,0,45,209,0,45,209,0,45,209,0,45,209,0,45,
+    192,0,62,192,0,62,192,0,62,192,0,62,192,0,62,192,0,62,192,0,62,192,0,62,192,0,62,192,0,62,192,0,62,192,0,62,
+    172,0,82,172,0,82,172,0,82,172,0,82,172,0,82,172,0,82,172,0,82,172,0,82,172,0,82,172,0,82,172,0,82,172,0,82,
+    147,0,107,147,0,107,147,0,107,147,0,107,147,0,107,147,0,107,147,0,107,147,0,107,147,0,107,147,0,107,147,0,107,147,0,107,
+    118,0,136,118,0,136,118,0,136,118,0,136,118,0,136,118,0,136,118,0,136,118,0,136,118,0,136,118,0,136,118,0,136,118,0,136,
+    84,0,170,84,0,170,84,0,170,84,0,170,84,0,170,84,0,170,84,0,170,84,0,170,84,0,170,84,0,170,84,0,170,84,0,170,
+    0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,
+    0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255
+};
+
+// fade/CubicOut
+static const uint8_t GOLDEN_FRAMES_6[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    26,0,5,26,0,5,26,0,5,26,0,5,26,0,5,26,0,5,26,0,5,26,0,5,26,0,5,26,0,5,26,0,5,26,0,5,
+    85,0,42,85,0,42,85,0,42,85,0,42,85,0,42,85,0,42,85,0,42,85,0,42,85,0,42,85,0,42,85,0,42,85,0,42,
+    136,0,118,136,0,118,136,0,118,136,0,118,136,0,118,136,0,118,136,0,118,136,0,118,136,0,118,136,0,118,136,0,118,136,0,118,
+    107,0,147,107,0,147,107,0,147,107,0,147,107,0,147,107,0,147,107,0,147,107,0,147,107,0,147,107,0,147,107,0,147,107,0,147,
+    82,0,172,82,0,172,82,0,172,82,0,172,82,0,172,82,0,172,82,0,172,82,0,172,82,0,172,82,0,172,82,0,172,82,0,172,
+    62,0,192,62,0,192,62,0,192,62,0,192,62,0,192,62,0,192,62,0,192,62,0,192,62,0,192,62,0,192,62,0,192,62,0,192,
+    45,0,209,45,0,209,45,0,209,45,0,209,45,0,209,45,0,209,45,0,209,45,0,209,45,0,209,45,0,209,45,0,209,45,0,209,
+    31,0,223,31,0,223,31,0,223,31,0,223,31,0,223,31,0,223,31,0,223,31,0,223,31,0,223,31,0,223,31,0,223,31,0,223,
+    21,0,233,21,0,233,21,0,233,21,0,233,21,0,233,21,0,233,21,0,233,21,0,233,21,0,233,21,0,233,21,0,233,21,0,233,
+    13,0,241,13,0,241,13,0,241,13,0,241,13,0,241,13,0,241,13,0,241,13,0,241,13,0,241,13,0,241,13,0,241,13,0,241,
+    7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,
+    3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,
+    1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,
+    0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,
+    0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,
+    0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255
+};
+
+// fade/CubicInOut
+static const uint8_t GOLDEN_FRAMES_7[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,
+    126,0,0,126,0,0,126,0,0,126,0,0,126,0,0,126,0,0,126,0,0,126,0,0,126,0,0,126,0,0,126,0,0,126,0,0,
+    248,0,6,248,0,6,248,0,6,248,0,6,248,0,6,248,0,6,248,0,6,248,0,6,248,0,6,248,0,6,248,0,6,248,0,6,
+    239,0,15,239,0,15,239,0,15,239,0,15,239,0,15,239,0,15,239,0,15,239,0,15,239,0,15,239,0,15,239,0,15,239,0,15,
+    223,0,31,223,0,31,223,0,31,223,0,31,223,0,31,223,0,31,223,0,31,223,0,31,223,0,31,223,0,31,223,0,31,223,0,31,
+    201,0,53,201,0,53,201,0,53,201,0,53,201,0,53,201,0,53,201,0,53,201,0,53,201,0,53,201,0,53,201,0,53,201,0,53,
+    169,0,85,169,0,85,169,0,85,169,0,85,169,0,85,169,0,85,169,0,85,169,0,85,169,0,85,169,0,85,169,0,85,169,0,85,
+    127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,
+    85,0,169,85,0,169,85,0,169,85,0,169,85,0,169,85,0,169,85,0,169,85,0,169,85,0,169,85,0,169,85,0,169,85,0,169,
+    53,0,201,53,0,201,53,0,201,53,0,201,53,0,201,53,0,201,53,0,201,53,0,201,53,0,201,53,0,201,53,0,201,53,0,201,
+    31,0,223,31,0,223,31,0,223,31,0,223,31,0,223,31,0,223,31,0,223,31,0,223,31,0,223,31,0,223,31,0,223,31,0,223,
+    15,0,239,15,0,239,15,0,239,15,0,239,15,0,239,15,0,239,15,0,239,15,0,239,15,0,239,15,0,239,15,0,239,15,0,239,
+    6,0,248,6,0,248,6,0,248,6,0,248,6,0,248,6,0,248,6,0,248,6,0,248,6,0,248,6,0,248,6,0,248,6,0,248,
+    1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,
+    0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,
+    0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255
+};
+
+// fade/QuarticIn
+static const uint8_t GOLDEN_FRAMES_8[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,
+    127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,
+    254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,
+    254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,
+    252,0,2,252,0,2,252,0,2,252,0,2,252,0,2,252,0,2,252,0,2,252,0,2,252,0,2,252,0,2,252,0,2,252,0,2,
+    249,0,5,249,0,5,249,0,5,249,0,5,249,0,5,249,0,5,249,0,5,249,0,5,249,0,5,249,0,5,249,0,5,249,0,5,
+    245,0,9,245,0,9,245,0,9,245,0,9,245,0,9,245,0,9,245,0,9,245,0,9,245,0,9,245,0,9,245,0,9,245,0,9,
+    239,0,15,239,0,15,239,0,15,239,0,15,239,0,15,239,0,15,239,0,15,239,0,15,239,0,15,239,0,15,239,0,15,239,0,15,
+    229,0,25,229,0,25,229,0,25,229,0,25,229,0,25,229,0,25,229,0,25,229,0,25,229,0,25,229,0,25,229,0,25,229,0,25,
+    216,0,38,216,0,38,216,0,38,216,0,38,216,0,38,216,0,38,216,0,38,216,0,38,216,0,38,216,0,38,216,0,38,216,0,38,
+    198,0,56,198,0,56,198,0,56,198,0,56,198,0,56,198,0,56,198,0,56,198,0,56,198,0,56,198,0,56,198,0,56,198,0,56,
+    174,0,80,174,0,80,174,0,80,174,0,80,174,0,80,174,0,80,174,0,80,174,0,80,174,0,80,174,0,80,174,0,80,174,0,80,
+    143,0,111,143,0,111,143,0,111,143,0,111,143,0,111,143,0,111,143,0,111,143,0,111,143,0,111,143,0,111,143,0,111,143,0,111,
+    105,0,149,105,0,149,105,0,149,105,0,149,105,0,149,105,0,149,105,0,149,105,0,149,105,0,149,105,0,149,105,0,149,105,0,149,
+    0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,
+    0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255
+};
+
+// fade/QuarticOut
+static const uint8_t GOLDEN_FRAMES_9[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    24,0,7,24,0,7,24,0,7,24,0,7,24,0,7,24,0,7,24,0,7,24,0,7,24,0,7,24,0,7,24,0,7,24,0,7,
+    74,0,52,74,0,52,74,0,52,74,0,52,74,0,52,74,0,52,74,0,52,74,0,52,74,0,52,74,0,52,74,0,52,74,0,52,
+    111,0,143,111,0,143,111,0,143,111,0,143,111,0,143,111,0,143,111,0,143,111,0,143,111,0,143,111,0,143,111,0,143,111,0,143,
+    80,0,174,80,0,174,80,0,174,80,0,174,80,0,174,80,0,174,80,0,174,80,0,174,80,0,174,80,0,174,80,0,174,80,0,174,
+    56,0,198,56,0,198,56,0,198,56,0,198,56,0,198,56,0,198,56,0,198,56,0,198,56,0,198,56,0,198,56,0,198,56,0,198,
+    38,0,216,38,0,216,38,0,216,38,0,216,38,0,216,38,0,216,38,0,216,38,0,216,38,0,216,38,0,216,38,0,216,38,0,216,
+    25,0,229,25,0,229,25,0,229,25,0,229,25,0,229,25,0,229,25,0,229,25,0,229,25,0,229,25,0,229,25,0,229,25,0,229,
+    15,0,239,15,0,239,15,0,239,15,0,239,15,0,239,15,0,239,15,0,239,15,0,239,15,0,239,15,0,239,15,0,239,15,0,239,
+    9,0,245,9,0,245,9,0,245,9,0,245,9,0,245,9,0,245,9,0,245,9,0,245,9,0,245,9,0,245,9,0,245,9,0,245,
+    5,0,249,5,0,249,5,0,249,5,0,249,5,0,249,5,0,249,5,0,249,5,0,249,5,0,249,5,0,249,5,0,249,5,0,249,
+    2,0,252,2,0,252,2,0,252,2,0,252,2,0,252,2,0,252,2,0,252,2,0,252,2,0,252,2,0,252,2,0,252,2,0,252,
+    0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,
+    0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,
+    0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,
+    0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,
+    0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255
+};
+
+// fade/QuarticInOut
+static const uint8_t GOLDEN_FRAMES_10[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,
+    127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,
+    252,0,2,252,0,2,252,0,2,252,0,2,252,0,2,252,0,2,252,0,2,252,0,2,252,0,2,252,0,2,252,0,2,252,0,2,
+    247,0,7,247,0,7,247,0,7,247,0,7,247,0,7,247,0,7,247,0,7,247,0,7,247,0,7,247,0,7,247,0,7,247,0,7,
+    235,0,19,235,0,19,235,0,19,235,0,19,235,0,19,235,0,19,235,0,19,235,0,19,235,0,19,235,0,19,235,0,19,235,0,19,
+    214,0,40,214,0,40,214,0,40,214,0,40,214,0,40,214,0,40,214,0,40,214,0,40,214,0,40,214,0,40,214,0,40,214,0,40,
+    180,0,74,180,0,74,180,0,74,180,0,74,180,0,74,180,0,74,180,0,74,180,0,74,180,0,74,180,0,74,180,0,74,180,0,74,
+    127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,
+    74,0,180,74,0,180,74,0,180,74,0,180,74,0,180,74,0,180,74,0,180,74,0,180,74,0,180,74,0,180,74,0,180,74,0,180,
+    40,0,214,40,0,214,40,0,214,40,0,214,40,0,214,40,0,214,40,0,214,40,0,214,40,0,214,40,0,214,40,0,214,40,0,214,
+    19,0,235,19,0,235,19,0,235,19,0,235,19,0,235,19,0,235,19,0,235,19,0,235,19,0,235,19,0,235,19,0,235,19,0,235,
+    7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,
+    2,0,252,2,0,252,2,0,252,2,0,252,2,0,252,2,0,252,2,0,252,2,0,252,2,0,252,2,0,252,2,0,252,2,0,252,
+    0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,
+    0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,
+    0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255
+};
+
+// fade/QuinticIn
+static const uint8_t GOLDEN_FRAMES_11[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,
+    127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,
+    254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,
+    254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,
+    254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,
+    253,0,1,253,0,1,253,0,1,253,0,1,253,0,1,253,0,1,253,0,1,253,0,1,253,0,1,253,0,1,253,0,1,253,0,1,
+    250,0,4,250,0,4,250,0,4,250,0,4,250,0,4,250,0,4,250,0,4,250,0,4,250,0,4,250,0,4,250,0,4,250,0,4,
+    247,0,7,247,0,7,247,0,7,247,0,7,247,0,7,247,0,7,247,0,7,247,0,7,247,0,7,247,0,7,247,0,7,247,0,7,
+    240,0,14,240,0,14,240,0,14,240,0,14,240,0,14,240,0,14,240,0,14,240,0,14,240,0,14,240,0,14,240,0,14,240,0,14,
+    230,0,24,230,0,24,230,0,24,230,0,24,230,0,24,230,0,24,230,0,24,230,0,24,230,0,24,230,0,24,230,0,24,230,0,24,
+    215,0,39,215,0,39,215,0,39,215,0,39,215,0,39,215,0,39,215,0,39,215,0,39,215,0,39,215,0,39,215,0,39,215,0,39,
+    194,0,60,194,0,60,194,0,60,194,0,60,194,0,60,194,0,60,194,0,60,194,0,60,194,0,60,194,0,60,194,0,60,194,0,60,
+    164,0,90,164,0,90,164,0,90,164,0,90,164,0,90,164,0,90,164,0,90,164,0,90,164,0,90,164,0,90,164,0,90,164,0,90,
+    124,0,130,124,0,130,124,0,130,124,0,130,124,0,130,124,0,130,124,0,130,124,0,130,124,0,130,124,0,130,124,0,130,124,0,130,
+    0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,
+    0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255
+};
+
+// fade/QuinticOut
+static const uint8_t GOLDEN_FRAMES_12[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    23,0,8,23,0,8,23,0,8,23,0,8,23,0,8,23,0,8,23,0,8,23,0,8,23,0,8,23,0,8,23,0,8,23,0,8,
+    65,0,62,65,0,62,65,0,62,65,0,62,65,0,62,65,0,62,65,0,62,65,0,62,65,0,62,65,0,62,65,0,62,65,0,62,
+    90,0,164,90,0,164,90,0,164,90,0,164,90,0,164,90,0,164,90,0,164,90,0,164,90,0,164,90,0,164,90,0,164,90,0,164,
+    60,0,194,60,0,194,60,0,194,60,0,194,60,0,194,60,0,194,60,0,194,60,0,194,60,0,194,60,0,194,60,0,194,60,0,194,
+    39,0,215,39,0,215,39,0,215,39,0,215,39,0,215,39,0,215,39,0,215,39,0,215,39,0,215,39,0,215,39,0,215,39,0,215,
+    24,0,230,24,0,230,24,0,230,24,0,230,24,0,230,24,0,230,24,0,230,24,0,230,24,0,230,24,0,230,24,0,230,24,0,230,
+    14,0,240,14,0,240,14,0,240,14,0,240,14,0,240,14,0,240,14,0,240,14,0,240,14,0,240,14,0,240,14,0,240,14,0,240,
+    7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,
+    4,0,250,4,0,250,4,0,250,4,0,250,4,0,250,4,0,250,4,0,250,4,0,250,4,0,250,4,0,250,4,0,250,4,0,250,
+    1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,
+    0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,
+    0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,
+    0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,
+    0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,
+    0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,
+    0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255
+};
+
+// fade/QuinticInOut
+static const uint8_t GOLDEN_FRAMES_13[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,
+    127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,
+    254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,
+    251,0,3,251,0,3,251,0,3,251,0,3,251,0,3,251,0,3,251,0,3,251,0,3,251,0,3,251,0,3,251,0,3,251,0,3,
+    242,0,12,242,0,12,242,0,12,242,0,12,242,0,12,242,0,12,242,0,12,242,0,12,242,0,12,242,0,12,242,0,12,242,0,12,
+    224,0,30,224,0,30,224,0,30,224,0,30,224,0,30,224,0,30,224,0,30,224,0,30,224,0,30,224,0,30,224,0,30,224,0,30,
+    189,0,65,189,0,65,189,0,65,189,0,65,189,0,65,189,0,65,189,0,65,189,0,65,189,0,65,189,0,65,189,0,65,189,0,65,
+    127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,
+    65,0,189,65,0,189,65,0,189,65,0,189,65,0,189,65,0,189,65,0,189,65,0,189,65,0,189,65,0,189,65,0,189,65,0,189,
+    30,0,224,30,0,224,30,0,224,30,0,224,30,0,224,30,0,224,30,0,224,30,0,224,30,0,224,30,0,224,30,0,224,30,0,224,
+    12,0,242,12,0,242,12,0,242,12,0,242,12,0,242,12,0,242,12,0,242,12,0,242,12,0,242,12,0,242,12,0,242,12,0,242,
+    3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,
+    0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,
+    0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,
+    0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,
+    0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255
+};
+
+// fade/SinusoidalIn
+static const uint8_t GOLDEN_FRAMES_14[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,
+    125,0,2,125,0,2,125,0,2,125,0,2,125,0,2,125,0,2,125,0,2,125,0,2,125,0,2,125,0,2,125,0,2,125,0,2,
+    244,0,10,244,0,10,244,0,10,244,0,10,244,0,10,244,0,10,244,0,10,244,0,10,244,0,10,244,0,10,244,0,10,244,0,10,
+    235,0,19,235,0,19,235,0,19,235,0,19,235,0,19,235,0,19,235,0,19,235,0,19,235,0,19,235,0,19,235,0,19,235,0,19,
+    224,0,30,224,0,30,224,0,30,224,0,30,224,0,30,224,0,30,224,0,30,224,0,30,224,0,30,224,0,30,224,0,30,224,0,30,
+    212,0,42,212,0,42,212,0,42,212,0,42,212,0,42,212,0,42,212,0,42,212,0,42,212,0,42,212,0,42,212,0,42,212,0,42,
+    197,0,57,197,0,57,197,0,57,197,0,57,197,0,57,197,0,57,197,0,57,197,0,57,197,0,57,197,0,57,197,0,57,197,0,57,
+    180,0,74,180,0,74,180,0,74,180,0,74,180,0,74,180,0,74,180,0,74,180,0,74,180,0,74,180,0,74,180,0,74,180,0,74,
+    161,0,93,161,0,93,161,0,93,161,0,93,161,0,93,161,0,93,161,0,93,161,0,93,161,0,93,161,0,93,161,0,93,161,0,93,
+    141,0,113,141,0,113,141,0,113,141,0,113,141,0,113,141,0,113,141,0,113,141,0,113,141,0,113,141,0,113,141,0,113,141,0,113,
+    120,0,134,120,0,134,120,0,134,120,0,134,120,0,134,120,0,134,120,0,134,120,0,134,120,0,134,120,0,134,120,0,134,120,0,134,
+    97,0,157,97,0,157,97,0,157,97,0,157,97,0,157,97,0,157,97,0,157,97,0,157,97,0,157,97,0,157,97,0,157,97,0,157,
+    74,0,180,74,0,180,74,0,180,74,0,180,74,0,180,74,0,180,74,0,180,74,0,180,74,0,180,74,0,180,74,0,180,74,0,180,
+    49,0,205,49,0,205,49,0,205,49,0,205,49,0,205,49,0,205,49,0,205,49,0,205,49,0,205,49,0,205,49,0,205,49,0,205,
+    0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,
+    0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255
+};
+
+// fade/SinusoidalOut
+static const uint8_t GOLDEN_FRAMES_15[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    28,0,3,28,0,3,28,0,3,28,0,3,28,0,3,28,0,3,28,0,3,28,0,3,28,0,3,28,0,3,28,0,3,28,0,3,
+    102,0,24,102,0,24,102,0,24,102,0,24,102,0,24,102,0,24,102,0,24,102,0,24,102,0,24,102,0,24,102,0,24,102,0,24,
+    180,0,74,180,0,74,180,0,74,180,0,74,180,0,74,180,0,74,180,0,74,180,0,74,180,0,74,180,0,74,180,0,74,180,0,74,
+    157,0,97,157,0,97,157,0,97,157,0,97,157,0,97,157,0,97,157,0,97,157,0,97,157,0,97,157,0,97,157,0,97,157,0,97,
+    134,0,120,134,0,120,134,0,120,134,0,120,134,0,120,134,0,120,134,0,120,134,0,120,134,0,120,134,0,120,134,0,120,134,0,120,
+    113,0,141,113,0,141,113,0,141,113,0,141,113,0,141,113,0,141,113,0,141,113,0,141,113,0,141,113,0,141,113,0,141,113,0,141,
+    93,0,161,93,0,161,93,0,161,93,0,161,93,0,161,93,0,161,93,0,161,93,0,161,93,0,161,93,0,161,93,0,161,93,0,161,
+    74,0,180,74,0,180,74,0,180,74,0,180,74,0,180,74,0,180,74,0,180,74,0,180,74,0,180,74,0,180,74,0,180,74,0,180,
+    57,0,197,57,0,197,57,0,197,57,0,197,57,0,197,57,0,197,57,0,197,57,0,197,57,0,197,57,0,197,57,0,197,57,0,197,
+    42,0,212,42,0,212,42,0,212,42,0,212,42,0,212,42,0,212,42,0,212,42,0,212,42,0,212,42,0,212,42,0,212,42,0,212,
+    30,0,224,30,0,224,30,0,224,30,0,224,30,0,224,30,0,224,30,0,224,30,0,224,30,0,224,30,0,224,30,0,224,30,0,224,
+    19,0,235,19,0,235,19,0,235,19,0,235,19,0,235,19,0,235,19,0,235,19,0,235,19,0,235,19,0,235,19,0,235,19,0,235,
+    10,0,244,10,0,244,10,0,244,10,0,244,10,0,244,10,0,244,10,0,244,10,0,244,10,0,244,10,0,244,10,0,244,10,0,244,
+    4,0,250,4,0,250,4,0,250,4,0,250,4,0,250,4,0,250,4,0,250,4,0,250,4,0,250,4,0,250,4,0,250,4,0,250,
+    0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,
+    0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255
+};
+
+// fade/SinusoidalInOut
+static const uint8_t GOLDEN_FRAMES_16[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,
+    122,0,4,122,0,4,122,0,4,122,0,4,122,0,4,122,0,4,122,0,4,122,0,4,122,0,4,122,0,4,122,0,4,122,0,4,
+    233,0,21,233,0,21,233,0,21,233,0,21,233,0,21,233,0,21,233,0,21,233,0,21,233,0,21,233,0,21,233,0,21,233,0,21,
+    217,0,37,217,0,37,217,0,37,217,0,37,217,0,37,217,0,37,217,0,37,217,0,37,217,0,37,217,0,37,217,0,37,217,0,37,
+    198,0,56,198,0,56,198,0,56,198,0,56,198,0,56,198,0,56,198,0,56,198,0,56,198,0,56,198,0,56,198,0,56,198,0,56,
+    176,0,78,176,0,78,176,0,78,176,0,78,176,0,78,176,0,78,176,0,78,176,0,78,176,0,78,176,0,78,176,0,78,176,0,78,
+    152,0,102,152,0,102,152,0,102,152,0,102,152,0,102,152,0,102,152,0,102,152,0,102,152,0,102,152,0,102,152,0,102,152,0,102,
+    127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,
+    102,0,152,102,0,152,102,0,152,102,0,152,102,0,152,102,0,152,102,0,152,102,0,152,102,0,152,102,0,152,102,0,152,102,0,152,
+    78,0,176,78,0,176,78,0,176,78,0,176,78,0,176,78,0,176,78,0,176,78,0,176,78,0,176,78,0,176,78,0,176,78,0,176,
+    56,0,198,56,0,198,56,0,198,56,0,198,56,0,198,56,0,198,56,0,198,56,0,198,56,0,198,56,0,198,56,0,198,56,0,198,
+    37,0,217,37,0,217,37,0,217,37,0,217,37,0,217,37,0,217,37,0,217,37,0,217,37,0,217,37,0,217,37,0,217,37,0,217,
+    21,0,233,21,0,233,21,0,233,21,0,233,21,0,233,21,0,233,21,0,233,21,0,233,21,0,233,21,0,233,21,0,233,21,0,233,
+    9,0,245,9,0,245,9,0,245,9,0,245,9,0,245,9,0,245,9,0,245,9,0,245,9,0,245,9,0,245,9,0,245,9,0,245,
+    0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,
+    0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255
+};
+
+// fade/ExponentialIn
+static const uint8_t GOLDEN_FRAMES_17[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,
+    127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,
+    254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,
+    253,0,1,253,0,1,253,0,1,253,0,1,253,0,1,253,0,1,253,0,1,253,0,1,253,0,1,253,0,1,253,0,1,253,0,1,
+    252,0,2,252,0,2,252,0,2,252,0,2,252,0,2,252,0,2,252,0,2,252,0,2,252,0,2,252,0,2,252,0,2,252,0,2,
+    251,0,3,251,0,3,251,0,3,251,0,3,251,0,3,251,0,3,251,0,3,251,0,3,251,0,3,251,0,3,251,0,3,251,0,3,
+    249,0,5,249,0,5,249,0,5,249,0,5,249,0,5,249,0,5,249,0,5,249,0,5,249,0,5,249,0,5,249,0,5,249,0,5,
+    247,0,7,247,0,7,247,0,7,247,0,7,247,0,7,247,0,7,247,0,7,247,0,7,247,0,7,247,0,7,247,0,7,247,0,7,
+    242,0,12,242,0,12,242,0,12,242,0,12,242,0,12,242,0,12,242,0,12,242,0,12,242,0,12,242,0,12,242,0,12,242,0,12,
+    236,0,18,236,0,18,236,0,18,236,0,18,236,0,18,236,0,18,236,0,18,236,0,18,236,0,18,236,0,18,236,0,18,236,0,18,
+    225,0,29,225,0,29,225,0,29,225,0,29,225,0,29,225,0,29,225,0,29,225,0,29,225,0,29,225,0,29,225,0,29,225,0,29,
+    209,0,45,209,0,45,209,0,45,209,0,45,209,0,45,209,0,45,209,0,45,209,0,45,209,0,45,209,0,45,209,0,45,209,0,45,
+    185,0,69,185,0,69,185,0,69,185,0,69,185,0,69,185,0,69,185,0,69,185,0,69,185,0,69,185,0,69,185,0,69,185,0,69,
+    147,0,107,147,0,107,147,0,107,147,0,107,147,0,107,147,0,107,147,0,107,147,0,107,147,0,107,147,0,107,147,0,107,147,0,107,
+    0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,
+    0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255
+};
+
+// fade/ExponentialOut
+static const uint8_t GOLDEN_FRAMES_18[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    20,0,11,20,0,11,20,0,11,20,0,11,20,0,11,20,0,11,20,0,11,20,0,11,20,0,11,20,0,11,20,0,11,20,0,11,
+    53,0,73,53,0,73,53,0,73,53,0,73,53,0,73,53,0,73,53,0,73,53,0,73,53,0,73,53,0,73,53,0,73,53,0,73,
+    69,0,185,69,0,185,69,0,185,69,0,185,69,0,185,69,0,185,69,0,185,69,0,185,69,0,185,69,0,185,69,0,185,69,0,185,
+    45,0,209,45,0,209,45,0,209,45,0,209,45,0,209,45,0,209,45,0,209,45,0,209,45,0,209,45,0,209,45,0,209,45,0,209,
+    29,0,225,29,0,225,29,0,225,29,0,225,29,0,225,29,0,225,29,0,225,29,0,225,29,0,225,29,0,225,29,0,225,29,0,225,
+    18,0,236,18,0,236,18,0,236,18,0,236,18,0,236,18,0,236,18,0,236,18,0,236,18,0,236,18,0,236,18,0,236,18,0,236,
+    12,0,242,12,0,242,12,0,242,12,0,242,12,0,242,12,0,242,12,0,242,12,0,242,12,0,242,12,0,242,12,0,242,12,0,242,
+    7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,
+    5,0,249,5,0,249,5,0,249,5,0,249,5,0,249,5,0,249,5,0,249,5,0,249,5,0,249,5,0,249,5,0,249,5,0,249,
+    3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,
+    2,0,252,2,0,252,2,0,252,2,0,252,2,0,252,2,0,252,2,0,252,2,0,252,2,0,252,2,0,252,2,0,252,2,0,252,
+    1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,
+    0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,
+    0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,
+    0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,
+    0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254
+};
+
+// fade/ExponentialInOut
+static const uint8_t GOLDEN_FRAMES_19[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,
+    127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,
+    253,0,1,253,0,1,253,0,1,253,0,1,253,0,1,253,0,1,253,0,1,253,0,1,253,0,1,253,0,1,253,0,1,253,0,1,
+    251,0,3,251,0,3,251,0,3,251,0,3,251,0,3,251,0,3,251,0,3,251,0,3,251,0,3,251,0,3,251,0,3,251,0,3,
+    245,0,9,245,0,9,245,0,9,245,0,9,245,0,9,245,0,9,245,0,9,245,0,9,245,0,9,245,0,9,245,0,9,245,0,9,
+    232,0,22,232,0,22,232,0,22,232,0,22,232,0,22,232,0,22,232,0,22,232,0,22,232,0,22,232,0,22,232,0,22,232,0,22,
+    201,0,53,201,0,53,201,0,53,201,0,53,201,0,53,201,0,53,201,0,53,201,0,53,201,0,53,201,0,53,201,0,53,201,0,53,
+    127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,127,0,127,
+    53,0,201,53,0,201,53,0,201,53,0,201,53,0,201,53,0,201,53,0,201,53,0,201,53,0,201,53,0,201,53,0,201,53,0,201,
+    22,0,232,22,0,232,22,0,232,22,0,232,22,0,232,22,0,232,22,0,232,22,0,232,22,0,232,22,0,232,22,0,232,22,0,232,
+    9,0,245,9,0,245,9,0,245,9,0,245,9,0,245,9,0,245,9,0,245,9,0,245,9,0,245,9,0,245,9,0,245,9,0,245,
+    3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,
+    1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,
+    0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,
+    0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,
+    0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254
+};
+
+// fade/Mirror(QuadraticIn)
+static const uint8_t GOLDEN_FRAMES_20[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,
+    119,0,7,119,0,7,119,0,7,119,0,7,119,0,7,119,0,7,119,0,7,119,0,7,119,0,7,119,0,7,119,0,7,119,0,7,
+    219,0,35,219,0,35,219,0,35,219,0,35,219,0,35,219,0,35,219,0,35,219,0,35,219,0,35,219,0,35,219,0,35,219,0,35,
+    191,0,63,191,0,63,191,0,63,191,0,63,191,0,63,191,0,63,191,0,63,191,0,63,191,0,63,191,0,63,191,0,63,191,0,63,
+    155,0,99,155,0,99,155,0,99,155,0,99,155,0,99,155,0,99,155,0,99,155,0,99,155,0,99,155,0,99,155,0,99,155,0,99,
+    111,0,143,111,0,143,111,0,143,111,0,143,111,0,143,111,0,143,111,0,143,111,0,143,111,0,143,111,0,143,111,0,143,111,0,143,
+    59,0,195,59,0,195,59,0,195,59,0,195,59,0,195,59,0,195,59,0,195,59,0,195,59,0,195,59,0,195,59,0,195,59,0,195,
+    0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,
+    59,0,195,59,0,195,59,0,195,59,0,195,59,0,195,59,0,195,59,0,195,59,0,195,59,0,195,59,0,195,59,0,195,59,0,195,
+    111,0,143,111,0,143,111,0,143,111,0,143,111,0,143,111,0,143,111,0,143,111,0,143,111,0,143,111,0,143,111,0,143,111,0,143,
+    155,0,99,155,0,99,155,0,99,155,0,99,155,0,99,155,0,99,155,0,99,155,0,99,155,0,99,155,0,99,155,0,99,155,0,99,
+    191,0,63,191,0,63,191,0,63,191,0,63,191,0,63,191,0,63,191,0,63,191,0,63,191,0,63,191,0,63,191,0,63,191,0,63,
+    219,0,35,219,0,35,219,0,35,219,0,35,219,0,35,219,0,35,219,0,35,219,0,35,219,0,35,219,0,35,219,0,35,219,0,35,
+    239,0,15,239,0,15,239,0,15,239,0,15,239,0,15,239,0,15,239,0,15,239,0,15,239,0,15,239,0,15,239,0,15,239,0,15,
+    255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,
+    255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0
+};
+
+// fade/Reverse(CubicOut)
+static const uint8_t GOLDEN_FRAMES_21[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,
+    0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,0,0,127,
+    1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,1,0,253,
+    3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,3,0,251,
+    7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,7,0,247,
+    13,0,241,13,0,241,13,0,241,13,0,241,13,0,241,13,0,241,13,0,241,13,0,241,13,0,241,13,0,241,13,0,241,13,0,241,
+    21,0,233,21,0,233,21,0,233,21,0,233,21,0,233,21,0,233,21,0,233,21,0,233,21,0,233,21,0,233,21,0,233,21,0,233,
+    31,0,223,31,0,223,31,0,223,31,0,223,31,0,223,31,0,223,31,0,223,31,0,223,31,0,223,31,0,223,31,0,223,31,0,223,
+    45,0,209,45,0,209,45,0,209,45,0,209,45,0,209,45,0,209,45,0,209,45,0,209,45,0,209,45,0,209,45,0,209,45,0,209,
+    62,0,192,62,0,192,62,0,192,62,0,192,62,0,192,62,0,192,62,0,192,62,0,192,62,0,192,62,0,192,62,0,192,62,0,192,
+    82,0,172,82,0,172,82,0,172,82,0,172,82,0,172,82,0,172,82,0,172,82,0,172,82,0,172,82,0,172,82,0,172,82,0,172,
+    107,0,147,107,0,147,107,0,147,107,0,147,107,0,147,107,0,147,107,0,147,107,0,147,107,0,147,107,0,147,107,0,147,107,0,147,
+    136,0,118,136,0,118,136,0,118,136,0,118,136,0,118,136,0,118,136,0,118,136,0,118,136,0,118,136,0,118,136,0,118,136,0,118,
+    170,0,84,170,0,84,170,0,84,170,0,84,170,0,84,170,0,84,170,0,84,170,0,84,170,0,84,170,0,84,170,0,84,170,0,84,
+    255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,
+    255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0
+};
+
+// fade/Reverse(Mirror(SinusoidalIn))
+static const uint8_t GOLDEN_FRAMES_22[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,31,0,0,
+    117,0,9,117,0,9,117,0,9,117,0,9,117,0,9,117,0,9,117,0,9,117,0,9,117,0,9,117,0,9,117,0,9,117,0,9,
+    212,0,42,212,0,42,212,0,42,212,0,42,212,0,42,212,0,42,212,0,42,212,0,42,212,0,42,212,0,42,212,0,42,212,0,42,
+    180,0,74,180,0,74,180,0,74,180,0,74,180,0,74,180,0,74,180,0,74,180,0,74,180,0,74,180,0,74,180,0,74,180,0,74,
+    141,0,113,141,0,113,141,0,113,141,0,113,141,0,113,141,0,113,141,0,113,141,0,113,141,0,113,141,0,113,141,0,113,141,0,113,
+    97,0,157,97,0,157,97,0,157,97,0,157,97,0,157,97,0,157,97,0,157,97,0,157,97,0,157,97,0,157,97,0,157,97,0,157,
+    49,0,205,49,0,205,49,0,205,49,0,205,49,0,205,49,0,205,49,0,205,49,0,205,49,0,205,49,0,205,49,0,205,49,0,205,
+    0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,
+    49,0,205,49,0,205,49,0,205,49,0,205,49,0,205,49,0,205,49,0,205,49,0,205,49,0,205,49,0,205,49,0,205,49,0,205,
+    97,0,157,97,0,157,97,0,157,97,0,157,97,0,157,97,0,157,97,0,157,97,0,157,97,0,157,97,0,157,97,0,157,97,0,157,
+    141,0,113,141,0,113,141,0,113,141,0,113,141,0,113,141,0,113,141,0,113,141,0,113,141,0,113,141,0,113,141,0,113,141,0,113,
+    180,0,74,180,0,74,180,0,74,180,0,74,180,0,74,180,0,74,180,0,74,180,0,74,180,0,74,180,0,74,180,0,74,180,0,74,
+    212,0,42,212,0,42,212,0,42,212,0,42,212,0,42,212,0,42,212,0,42,212,0,42,212,0,42,212,0,42,212,0,42,212,0,42,
+    235,0,19,235,0,19,235,0,19,235,0,19,235,0,19,235,0,19,235,0,19,235,0,19,235,0,19,235,0,19,235,0,19,235,0,19,
+    255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,
+    255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0
+};
+
+// fade_loop
+static const uint8_t GOLDEN_FRAMES_23[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    37,37,45,37,37,45,37,37,45,37,37,45,37,37,45,37,37,45,37,37,45,37,37,45,37,37,45,37,37,45,37,37,45,37,37,45,
+    55,55,173,55,55,173,55,55,173,55,55,173,55,55,173,55,55,173,55,55,173,55,55,173,55,55,173,55,55,173,55,55,173,55,55,173,
+    5,5,255,5,5,255,5,5,255,5,5,255,5,5,255,5,5,255,5,5,255,5,5,255,5,5,255,5,5,255,5,5,255,5,5,255,
+    20,20,255,20,20,255,20,20,255,20,20,255,20,20,255,20,20,255,20,20,255,20,20,255,20,20,255,20,20,255,20,20,255,20,20,255,
+    127,127,255,127,127,255,127,127,255,127,127,255,127,127,255,127,127,255,127,127,255,127,127,255,127,127,255,127,127,255,127,127,255,127,127,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    209,209,255,209,209,255,209,209,255,209,209,255,209,209,255,209,209,255,209,209,255,209,209,255,209,209,255,209,209,255,209,209,255,209,209,255,
+    81,81,255,81,81,255,81,81,255,81,81,255,81,81,255,81,81,255,81,81,255,81,81,255,81,81,255,81,81,255,81,81,255,81,81,255,
+    5,5,255,5,5,255,5,5,255,5,5,255,5,5,255,5,5,255,5,5,255,5,5,255,5,5,255,5,5,255,5,5,255,5,5,255,
+    20,20,255,20,20,255,20,20,255,20,20,255,20,20,255,20,20,255,20,20,255,20,20,255,20,20,255,20,20,255,20,20,255,20,20,255,
+    127,127,255,127,127,255,127,127,255,127,127,255,127,127,255,127,127,255,127,127,255,127,127,255,127,127,255,127,127,255,127,127,255,127,127,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    209,209,255,209,209,255,209,209,255,209,209,255,209,209,255,209,209,255,209,209,255,209,209,255,209,209,255,209,209,255,209,209,255,209,209,255,
+    81,81,255,81,81,255,81,81,255,81,81,255,81,81,255,81,81,255,81,81,255,81,81,255,81,81,255,81,81,255,81,81,255,81,81,255,
+    5,5,255,5,5,255,5,5,255,5,5,255,5,5,255,5,5,255,5,5,255,5,5,255,5,5,255,5,5,255,5,5,255,5,5,255,
+    20,20,255,20,20,255,20,20,255,20,20,255,20,20,255,20,20,255,20,20,255,20,20,255,20,20,255,20,20,255,20,20,255,20,20,255
+};
+
+// gradient_scale
+static const uint8_t GOLDEN_FRAMES_24[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    70,10,0,63,18,0,55,25,0,48,33,0,40,40,0,33,48,0,25,55,0,18,63,0,10,70,0,7,70,3,3,70,7,0,70,10,
+    186,68,0,163,91,0,140,114,0,117,138,0,93,161,0,70,184,0,47,207,0,24,231,0,0,254,0,0,231,23,0,209,45,0,186,68,
+    152,102,0,129,125,0,106,148,0,83,172,0,59,195,0,36,219,0,12,242,0,6,232,17,0,221,33,0,198,56,0,175,79,0,152,102,
+    118,136,0,95,160,0,71,183,0,48,206,0,25,229,0,13,231,11,0,233,21,0,210,44,0,187,67,0,164,90,0,141,113,0,118,136,
+    84,170,0,61,194,0,37,217,0,19,232,4,0,246,8,0,223,31,0,200,54,0,177,78,0,153,101,0,130,124,0,107,147,0,84,170,
+    50,204,0,27,228,0,3,251,0,2,232,21,0,212,42,0,189,65,0,166,88,0,143,111,0,120,134,0,97,157,0,73,181,0,50,204,
+    16,238,0,8,231,15,0,224,30,0,201,53,0,178,76,0,155,99,0,132,122,0,109,145,0,86,168,0,63,191,0,39,215,0,16,238,
+    0,237,17,0,213,41,0,190,64,0,167,87,0,144,110,0,121,133,0,98,156,0,75,179,0,52,202,0,29,225,0,6,248,237,17,0,
+    0,203,51,0,180,74,0,157,97,0,133,121,0,110,144,0,87,167,0,64,190,0,41,213,0,18,236,250,4,0,227,27,0,203,51,0,
+    0,169,85,0,146,108,0,123,131,0,100,154,0,76,178,0,53,201,0,30,224,0,7,247,239,15,0,216,38,0,192,62,0,169,85,0,
+    0,135,119,0,112,142,0,89,165,0,66,188,0,43,211,0,20,234,251,3,0,228,26,0,205,49,0,182,72,0,158,96,0,135,119,0,
+    0,101,153,0,78,176,0,55,199,0,32,222,0,9,245,241,13,0,217,37,0,194,60,0,171,83,0,147,107,0,124,130,0,101,153,0,
+    0,67,187,0,44,210,0,21,233,255,0,0,230,24,0,206,48,0,183,71,0,160,94,0,137,117,0,113,141,0,90,164,0,67,187,0,
+    255,0,0,232,23,0,208,46,0,185,70,0,161,93,0,138,116,0,115,139,0,92,163,0,68,186,0,45,209,0,23,231,0,0,254,0
+};
+
+// gradient_positions
+static const uint8_t GOLDEN_FRAMES_25[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    45,0,0,0,0,45,0,0,45,0,0,45,0,16,29,0,45,0,5,45,5,41,45,41,45,45,45,45,14,14,45,0,0,45,0,0,
+    173,0,0,0,0,173,0,0,173,0,0,172,0,4,168,0,97,74,0,173,0,40,173,40,164,173,164,173,172,172,173,31,31,173,0,0,
+    255,24,24,255,255,255,0,0,255,0,0,254,0,0,254,0,11,243,0,194,60,1,255,1,101,255,101,249,255,249,255,247,247,255,24,24,
+    255,224,224,255,255,255,255,0,0,0,0,255,0,0,254,0,0,254,0,21,233,0,229,25,3,255,3,153,255,153,252,255,252,255,224,224,
+    254,255,254,255,255,255,255,255,255,255,0,0,0,0,255,0,0,254,0,0,254,0,37,217,0,248,6,9,255,9,192,255,192,254,255,254,
+    218,255,218,0,255,0,255,255,255,255,255,255,0,0,255,0,0,255,0,0,254,0,1,253,0,63,191,0,254,0,20,255,20,218,255,218,
+    39,255,39,0,255,0,0,255,0,255,255,255,255,255,255,0,0,255,0,0,255,0,0,254,0,3,251,0,104,150,0,255,0,39,255,39,
+    0,255,0,0,255,0,0,255,0,255,255,255,255,255,255,255,255,255,0,0,255,0,0,255,0,0,254,0,7,247,0,160,94,0,255,0,
+    0,206,48,0,0,255,0,255,0,0,255,0,255,255,255,255,255,255,255,255,255,0,0,255,0,0,254,0,0,254,0,13,241,0,206,48,
+    0,24,230,255,255,255,0,255,0,0,255,0,0,255,0,255,255,255,255,255,255,255,0,0,0,0,255,0,0,254,0,0,254,0,24,230,
+    0,1,253,0,255,0,255,255,255,0,255,0,0,255,0,0,255,0,255,255,255,255,255,255,0,0,255,0,0,255,0,0,254,0,1,253,
+    0,0,254,255,255,255,0,255,0,0,0,255,0,255,0,0,255,0,0,255,0,255,255,255,255,255,255,0,0,255,0,0,255,0,0,254,
+    255,0,0,0,0,255,0,255,0,0,255,0,255,255,255,0,255,0,0,255,0,0,255,0,255,255,255,255,255,255,0,0,255,0,0,255,
+    255,0,0,0,0,254,0,1,253,0,54,200,0,253,1,16,255,16,211,255,211,254,255,254,255,140,140,255,3,3,255,0,0,0,0,255
+};
+
+// gradient_random
+static const uint8_t GOLDEN_FRAMES_26[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    25,55,0,0,0,80,0,55,26,0,30,51,8,73,0,64,16,0,37,43,0,0,12,69,71,9,0,0,46,34,19,61,0,0,76,5,
+    30,224,0,206,48,0,0,121,133,0,43,211,0,229,25,152,102,0,66,188,0,242,12,0,172,82,0,0,95,159,10,244,0,0,187,67,
+    0,234,20,155,99,0,0,70,184,247,7,0,0,178,76,101,153,0,15,239,0,191,63,0,121,133,0,0,44,210,0,214,40,0,136,118,
+    0,183,71,104,150,0,0,19,235,196,58,0,0,127,127,50,204,0,0,219,35,140,114,0,70,184,0,248,6,0,0,163,91,0,85,169,
+    0,132,122,53,201,0,223,31,0,145,109,0,0,76,178,0,254,0,0,168,86,89,165,0,19,235,0,197,57,0,0,112,142,0,34,220,
+    0,81,173,2,252,0,172,82,0,94,160,0,0,25,229,0,203,51,0,117,137,38,216,0,0,223,31,146,108,0,0,61,193,238,16,0,
+    0,30,224,0,206,48,121,133,0,43,211,0,229,25,0,0,152,102,0,66,188,0,242,12,0,172,82,95,159,0,0,10,244,187,67,0,
+    234,20,0,0,155,99,70,184,0,0,247,7,178,76,0,0,101,153,0,15,239,0,191,63,0,121,133,44,210,0,214,40,0,136,118,0,
+    132,122,0,0,53,201,0,223,31,0,145,109,76,178,0,255,0,0,168,86,0,0,89,165,0,19,235,0,197,57,112,142,0,34,220,0,
+    132,122,0,0,53,201,0,223,31,0,145,109,76,178,0,255,0,0,168,86,0,0,89,165,0,19,235,0,197,57,112,142,0,34,220,0
+};
+
+// gradient_wrap
+static const uint8_t GOLDEN_FRAMES_27[] = {
+    242,242,242,253,253,253,10,10,10,22,22,22,33,33,33,45,45,45,56,56,56,68,68,68,79,79,79,91,91,91,103,103,103,114,114,114,
+    0,0,0,11,11,11,23,23,23,34,34,34,46,46,46,57,57,57,69,69,69,80,80,80,92,92,92,104,104,104,115,115,115,127,127,127,
+    0,0,0,11,11,11,23,23,23,34,34,34,46,46,46,57,57,57,69,69,69,80,80,80,92,92,92,104,104,104,115,115,115,127,127,127,
+    8,8,8,20,20,20,31,31,31,43,43,43,54,54,54,66,66,66,78,78,78,89,89,89,101,101,101,113,113,113,124,124,124,136,136,136,
+    17,17,17,29,29,29,40,40,40,52,52,52,63,63,63,75,75,75,87,87,87,98,98,98,110,110,110,122,122,122,133,133,133,145,145,145,
+    26,26,26,38,38,38,49,49,49,61,61,61,72,72,72,84,84,84,96,96,96,107,107,107,119,119,119,131,131,131,142,142,142,154,154,154,
+    35,35,35,47,47,47,58,58,58,70,70,70,81,81,81,93,93,93,105,105,105,116,116,116,128,128,128,140,140,140,151,151,151,163,163,163,
+    44,44,44,56,56,56,67,67,67,79,79,79,90,90,90,102,102,102,114,114,114,125,125,125,137,137,137,149,149,149,160,160,160,172,172,172,
+    53,53,53,65,65,65,76,76,76,88,88,88,99,99,99,111,111,111,123,123,123,134,134,134,146,146,146,158,158,158,169,169,169,181,181,181,
+    62,62,62,74,74,74,85,85,85,97,97,97,108,108,108,120,120,120,132,132,132,143,143,143,155,155,155,166,166,166,178,178,178,189,189,189,
+    71,71,71,83,83,83,94,94,94,106,106,106,117,117,117,129,129,129,141,141,141,152,152,152,164,164,164,175,175,175,187,187,187,198,198,198,
+    80,80,80,92,92,92,103,103,103,115,115,115,126,126,126,138,138,138,150,150,150,161,161,161,173,173,173,184,184,184,196,196,196,207,207,207,
+    89,89,89,101,101,101,112,112,112,124,124,124,135,135,135,147,147,147,159,159,159,170,170,170,182,182,182,193,193,193,205,205,205,216,216,216,
+    98,98,98,110,110,110,121,121,121,133,133,133,144,144,144,156,156,156,168,168,168,179,179,179,191,191,191,202,202,202,214,214,214,225,225,225,
+    107,107,107,119,119,119,130,130,130,142,142,142,153,153,153,165,165,165,177,177,177,188,188,188,200,200,200,211,211,211,223,223,223,234,234,234,
+    116,116,116,127,127,127,139,139,139,150,150,150,162,162,162,173,173,173,185,185,185,196,196,196,208,208,208,220,220,220,231,231,231,243,243,243,
+    124,124,124,136,136,136,147,147,147,159,159,159,170,170,170,182,182,182,194,194,194,205,205,205,217,217,217,229,229,229,240,240,240,252,252,252,
+    133,133,133,145,145,145,157,157,157,168,168,168,180,180,180,191,191,191,203,203,203,215,215,215,226,226,226,238,238,238,249,249,249,6,6,6,
+    142,142,142,154,154,154,165,165,165,177,177,177,189,189,189,200,200,200,212,212,212,223,223,223,235,235,235,247,247,247,3,3,3,15,15,15,
+    151,151,151,163,163,163,174,174,174,186,186,186,198,198,198,209,209,209,221,221,221,232,232,232,244,244,244,1,1,1,12,12,12,24,24,24,
+    160,160,160,172,172,172,183,183,183,195,195,195,207,207,207,218,218,218,230,230,230,241,241,241,253,253,253,9,9,9,21,21,21,33,33,33,
+    169,169,169,181,181,181,192,192,192,204,204,204,215,215,215,227,227,227,239,239,239,250,250,250,7,7,7,18,18,18,30,30,30,42,42,42,
+    178,178,178,190,190,190,201,201,201,213,213,213,224,224,224,236,236,236,248,248,248,4,4,4,16,16,16,27,27,27,39,39,39,51,51,51,
+    187,187,187,199,199,199,210,210,210,222,222,222,233,233,233,245,245,245,1,1,1,13,13,13,25,25,25,36,36,36,48,48,48,59,59,59,
+    196,196,196,207,207,207,219,219,219,231,231,231,242,242,242,254,254,254,10,10,10,22,22,22,34,34,34,45,45,45,57,57,57,68,68,68,
+    205,205,205,216,216,216,228,228,228,240,240,240,251,251,251,8,8,8,19,19,19,31,31,31,43,43,43,54,54,54,66,66,66,77,77,77,
+    214,214,214,225,225,225,237,237,237,248,248,248,5,5,5,17,17,17,28,28,28,40,40,40,51,51,51,63,63,63,75,75,75,86,86,86,
+    223,223,223,234,234,234,246,246,246,2,2,2,14,14,14,26,26,26,37,37,37,49,49,49,60,60,60,72,72,72,84,84,84,95,95,95,
+    232,232,232,243,243,243,0,0,0,11,11,11,23,23,23,35,35,35,46,46,46,58,58,58,69,69,69,81,81,81,92,92,92,104,104,104,
+    240,240,240,252,252,252,9,9,9,20,20,20,32,32,32,43,43,43,55,55,55,67,67,67,78,78,78,90,90,90,101,101,101,113,113,113
+};
+
+// gradient_list
+static const uint8_t GOLDEN_FRAMES_28[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    64,16,0,0,64,16,24,57,0,0,24,56,48,32,0,81,0,0,64,16,0,64,16,0,64,16,0,64,16,0,64,16,0,64,16,0,
+    152,102,0,0,152,102,24,230,0,0,25,229,101,153,0,203,51,0,152,102,0,152,102,0,152,102,0,152,102,0,152,102,0,152,102,0,
+    101,153,0,0,101,153,0,228,26,229,25,0,50,204,0,152,102,0,101,153,0,101,153,0,101,153,0,101,153,0,101,153,0,101,153,0,
+    50,204,0,0,50,204,0,177,77,178,76,0,0,254,0,101,153,0,50,204,0,50,204,0,50,204,0,50,204,0,50,204,0,50,204,0,
+    0,254,0,255,0,0,0,127,127,126,128,0,0,203,51,50,204,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,
+    0,203,51,203,51,0,0,76,178,75,179,0,0,152,102,0,254,0,0,203,51,0,203,51,0,203,51,0,203,51,0,203,51,0,203,51,
+    0,152,102,152,102,0,0,25,229,24,230,0,0,101,153,0,203,51,0,152,102,0,152,102,0,152,102,0,152,102,0,152,102,0,152,102,
+    0,101,153,101,153,0,229,25,0,0,228,26,0,50,204,0,152,102,0,101,153,0,101,153,0,101,153,0,101,153,0,101,153,0,101,153,
+    255,0,0,0,254,0,126,128,0,0,127,127,203,51,0,0,50,204,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,
+    255,0,0,0,254,0,126,128,0,0,127,127,203,51,0,0,50,204,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0
+};
+
+// hsv_meander
+static const uint8_t GOLDEN_FRAMES_29[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    35,131,179,32,50,201,33,96,204,23,97,160,23,29,146,46,36,181,36,109,181,27,110,145,41,91,162,63,145,209,48,198,199,34,158,168,
+    34,56,208,30,112,190,21,71,147,41,28,157,39,56,188,32,122,167,29,97,143,51,102,182,62,174,214,40,184,179,37,144,169,57,152,204,
+    26,109,172,22,44,143,51,33,172,38,90,187,28,118,152,35,90,151,60,125,200,55,194,208,35,171,172,45,139,180,58,166,212,32,172,190,
+    26,25,149,41,38,184,35,115,176,27,106,143,44,93,168,64,155,212,45,194,192,35,153,167,53,145,194,52,176,211,22,155,171,19,116,146,
+    39,68,189,30,122,161,31,94,144,55,109,188,60,182,213,37,180,175,39,141,172,58,157,207,40,178,201,16,136,155,26,118,152,40,144,176,
+    28,114,148,38,90,156,62,135,205,52,197,204,34,165,169,47,140,184,57,170,213,28,167,184,17,121,147,33,126,162,36,149,176,17,129,149,
+    48,97,175,63,165,213,42,189,185,36,148,168,55,148,199,48,178,209,19,149,165,21,116,148,39,138,172,28,145,169,15,122,141,31,137,149,
+    58,189,211,36,175,173,42,140,175,59,161,210,36,175,196,16,130,152,28,120,155,39,147,177,20,136,157,17,121,138,41,152,161,50,163,182,
+    34,158,168,50,142,189,55,174,213,24,162,177,18,118,146,35,130,166,34,148,174,15,126,146,24,129,143,49,163,172,44,150,182,29,118,174,
+    57,152,204,44,178,205,18,142,160,23,116,150,39,141,174,25,143,165,15,121,139,34,142,153,52,166,180,36,134,179,32,122,175,52,153,190,
+    32,172,190,16,125,149,31,123,159,38,148,177,18,133,153,19,123,139,44,156,165,49,159,183,31,122,175,38,134,180,57,153,195,42,94,196,
+    19,116,146,37,134,169,31,147,172,15,124,143,27,133,146,51,165,175,41,145,181,30,118,174,47,147,186,55,140,198,32,66,194,23,65,192,
+    40,144,176,23,140,161,16,120,138,38,147,157,52,165,181,34,129,177,34,125,176,54,154,192,48,115,198,25,49,193,27,92,192,35,127,178,
+    17,129,149,22,125,141,47,160,169,46,155,182,30,119,174,41,138,182,57,150,196,39,84,196,22,53,192,32,118,191,38,133,200,25,77,219,
+    31,137,149,52,166,178,39,139,180,30,120,174,50,150,188,53,133,198,29,58,194,24,73,192,35,133,189,36,119,216,20,70,209,25,144,186,
+    50,163,182,32,125,176,36,129,178,56,154,194,45,105,197,23,48,192,28,101,192,36,131,186,30,93,222,19,85,197,31,186,191,48,230,221,
+    29,118,174,44,143,184,56,146,197,35,74,195,22,58,192,33,125,190,37,130,206,23,72,217,21,118,187,39,204,187,49,216,239,40,132,214,
+    52,153,190,51,124,198,27,53,193,25,82,192,36,134,188,34,111,219,19,72,205,27,158,186,46,220,201,47,177,237,38,131,196,41,174,166
+};
+
+// hsv_meander_random
+static const uint8_t GOLDEN_FRAMES_30[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    19,9,1,19,9,0,19,6,0,19,10,0,18,7,0,19,10,0,19,10,1,19,7,1,19,12,0,19,9,0,18,9,0,19,10,1,
+    76,32,1,77,42,0,80,38,3,76,56,4,77,34,5,79,61,3,77,27,3,76,24,2,78,46,1,77,25,4,77,36,4,78,57,3,
+    162,80,8,165,106,6,165,86,8,162,62,8,163,89,6,163,92,6,165,89,10,162,89,8,165,119,6,165,116,9,160,68,4,165,108,5,
+    240,105,10,248,150,7,243,78,15,241,104,12,244,123,16,237,201,9,246,110,13,242,119,6,246,165,9,237,140,13,238,98,14,245,137,11,
+    235,99,7,242,143,9,244,168,14,240,114,16,245,164,13,244,183,12,237,104,6,241,139,3,237,152,8,241,124,12,243,112,15,247,176,6,
+    241,100,17,246,195,10,237,144,13,239,65,10,244,177,7,237,118,11,240,119,13,245,157,11,241,217,11,241,179,14,241,131,10,244,93,10,
+    242,125,12,243,143,9,241,121,12,238,116,10,243,129,11,241,160,16,239,103,8,247,148,5,242,140,12,239,98,13,244,125,17,252,105,13,
+    242,126,13,236,181,9,241,179,14,241,127,10,249,175,7,247,110,17,236,99,9,242,141,11,236,135,12,241,99,12,245,175,11,245,138,11,
+    245,141,17,243,204,12,239,101,13,242,125,2,243,120,7,240,96,12,242,103,17,247,194,10,246,152,18,240,118,16,244,167,7,242,75,15,
+    244,187,7,239,120,11,241,96,12,243,156,8,250,84,13,246,133,17,241,129,11,241,137,9,244,87,13,239,65,10,244,132,11,245,153,14
+};
+
+// overlay
+static const uint8_t GOLDEN_FRAMES_31[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    45,13,6,37,21,6,28,30,6,20,38,6,12,45,6,6,45,9,6,41,18,6,33,26,6,24,34,6,16,42,6,8,45,45,13,6,
+    172,103,51,140,135,51,109,166,51,77,173,51,51,173,56,51,173,88,51,156,119,51,125,150,51,93,173,51,62,173,173,72,51,172,103,51,
+    254,230,115,208,255,115,161,255,115,115,255,115,115,255,161,115,255,207,115,231,253,115,185,255,115,139,255,255,137,115,255,183,115,254,230,115,
+    203,255,102,156,255,102,110,255,102,102,255,139,102,255,186,102,226,232,102,180,255,102,134,255,255,115,102,255,162,102,249,209,102,203,255,102,
+    126,255,64,80,255,64,64,255,93,64,242,140,64,196,186,64,150,232,64,104,255,255,69,64,255,116,64,220,162,64,173,209,64,126,255,64,
+    24,230,0,0,233,21,0,187,67,0,140,114,0,94,160,0,48,206,0,2,252,210,44,0,164,90,0,117,137,0,71,183,0,24,230,0,
+    0,241,13,0,195,59,0,148,106,0,102,152,0,56,198,0,10,244,218,36,0,172,82,0,125,129,0,79,175,0,32,222,0,0,241,13,
+    38,241,89,38,195,135,38,148,182,38,102,228,38,56,255,255,65,38,218,112,38,171,159,38,125,205,38,78,252,38,38,255,43,38,241,89,
+    76,241,165,76,194,212,76,148,255,76,102,255,255,95,76,255,142,76,218,188,76,171,235,76,125,255,76,78,255,76,76,255,119,76,241,165,
+    115,242,242,115,195,255,115,149,255,255,126,115,255,173,115,255,219,115,218,255,115,172,255,115,125,255,115,115,255,150,115,255,196,115,242,242,
+    102,190,255,102,144,255,255,105,102,255,152,102,255,198,102,213,245,102,167,255,102,120,255,102,102,255,129,102,255,175,102,237,221,102,190,255,
+    64,114,255,64,68,255,255,105,64,230,152,64,184,198,64,137,245,64,90,255,64,64,255,83,64,253,129,64,207,175,64,160,222,64,114,255,
+    255,0,0,208,46,0,161,93,0,115,139,0,68,186,0,22,232,0,0,230,24,0,184,70,0,138,116,0,92,162,0,46,208,255,0,0,
+    255,0,0,208,46,0,161,93,0,115,139,0,68,186,0,22,232,0,0,230,24,0,184,70,0,138,116,0,92,162,0,46,208,255,0,0
+};
+
+// color_transition
+static const uint8_t GOLDEN_FRAMES_32[] = {
+    255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,
+    255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,
+    254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,253,1,0,253,1,0,253,0,0,253,0,0,253,0,0,253,0,1,254,0,0,
+    254,0,0,253,1,0,252,2,0,251,3,0,250,4,0,249,5,0,249,4,0,249,3,1,249,2,2,249,1,3,249,0,4,254,0,0,
+    253,1,0,251,3,0,249,5,0,246,8,0,244,10,0,243,10,0,243,8,2,243,6,4,243,4,6,243,2,9,243,0,11,253,1,0,
+    250,4,0,247,7,0,243,11,0,239,15,0,235,18,0,234,18,2,234,14,5,234,10,9,234,6,13,234,3,17,254,0,0,250,4,0,
+    246,8,0,241,13,0,235,19,0,229,25,0,223,31,0,223,26,5,223,20,10,223,15,16,223,9,22,223,3,28,252,2,0,246,8,0,
+    241,13,0,232,22,0,224,30,0,215,38,0,209,44,1,209,36,9,209,27,18,209,19,26,209,11,34,209,2,42,249,5,0,241,13,0,
+    232,21,0,221,33,0,210,44,0,198,56,0,192,57,4,192,46,16,192,34,27,192,23,38,192,12,50,192,0,61,244,10,0,232,21,0,
+    222,32,0,207,47,0,192,62,0,177,77,0,173,70,10,173,56,25,173,41,40,173,26,54,173,11,69,251,2,0,237,17,0,222,32,0,
+    208,46,0,189,65,0,170,84,0,151,102,0,151,84,18,151,65,37,151,46,55,151,28,74,151,9,93,245,8,0,227,27,0,208,46,0,
+    190,64,0,167,87,0,144,110,0,127,121,6,127,98,29,127,75,52,127,51,75,127,28,98,127,5,121,237,17,0,214,40,0,190,64,0,
+    171,83,0,143,111,0,115,138,0,103,136,14,103,108,42,103,81,69,103,54,96,103,26,124,255,0,0,226,27,0,198,55,0,171,83,0,
+    150,104,0,118,136,0,87,167,0,81,147,25,81,115,57,81,84,88,81,53,119,81,21,150,245,8,0,213,40,0,181,72,0,150,104,0,
+    128,125,0,94,160,0,62,188,3,62,154,37,62,119,72,62,83,107,62,49,142,62,14,177,234,19,0,199,55,0,164,89,0,128,125,0,
+    107,146,0,69,184,0,45,194,13,45,156,51,45,118,89,45,81,127,45,43,164,45,4,203,222,31,0,183,70,0,145,108,0,107,146,0,
+    86,168,0,45,208,0,31,196,25,31,155,66,31,115,106,31,75,147,31,35,187,249,4,0,208,45,0,168,85,0,127,126,0,86,168,0,
+    66,187,0,23,230,0,20,195,38,20,152,80,20,110,123,20,67,166,20,24,208,237,16,0,194,59,0,151,102,0,108,145,0,66,187,0,
+    46,207,0,11,233,8,11,190,52,11,146,96,11,102,140,11,58,184,11,14,228,224,29,0,180,73,0,135,118,0,90,163,0,46,207,0,
+    28,225,0,5,228,20,5,183,65,5,137,111,5,92,156,5,47,201,5,1,246,210,43,0,165,88,0,119,134,0,74,179,0,28,225,0,
+    11,243,0,0,220,34,0,174,80,0,128,126,0,81,173,0,35,219,244,10,0,197,57,0,151,103,0,104,150,0,58,196,0,11,243,0,
+    0,254,0,0,207,47,0,161,93,0,115,139,0,69,185,0,23,231,231,23,0,185,69,0,138,116,0,92,162,0,45,209,0,0,254,0,
+    0,241,13,0,195,59,0,148,106,0,102,152,0,56,198,0,10,244,218,36,0,172,82,0,125,129,0,79,175,0,32,222,0,0,241,13,
+    0,228,26,0,182,72,0,136,118,0,90,164,0,43,211,252,2,0,206,48,0,159,95,0,113,141,0,66,188,0,19,235,0,0,228,26
+};
+
+// brightness_transition
+static const uint8_t GOLDEN_FRAMES_33[] = {
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,
+    250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,
+    244,244,244,244,244,244,244,244,244,244,244,244,244,244,244,244,244,244,244,244,244,244,244,244,244,244,244,244,244,244,244,244,244,244,244,244,
+    237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,
+    227,227,227,227,227,227,227,227,227,227,227,227,227,227,227,227,227,227,227,227,227,227,227,227,227,227,227,227,227,227,227,227,227,227,227,227,
+    214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,
+    200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,
+    183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+    164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,
+    143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,
+    122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
+    103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,
+    86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+    42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32
+};
+
+// transaction
+static const uint8_t GOLDEN_FRAMES_34[] = {
+    0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,
+    0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,0,0,255,
+    0,1,252,0,1,252,0,1,252,0,1,252,0,1,252,0,1,252,0,1,252,0,1,252,0,1,252,0,1,252,0,1,252,0,1,252,
+    0,5,245,0,5,245,0,5,245,0,5,245,0,5,245,0,5,245,0,5,245,0,5,245,0,5,245,0,5,245,0,5,245,0,5,245,
+    0,11,236,0,11,236,0,11,236,0,11,236,0,11,236,0,11,236,0,11,236,0,11,236,0,11,236,0,11,236,0,11,236,0,11,236,
+    0,19,222,0,19,222,0,19,222,0,19,222,0,19,222,0,19,222,0,19,222,0,19,222,0,19,222,0,19,222,0,19,222,0,19,222,
+    0,29,206,0,29,206,0,29,206,0,29,206,0,29,206,0,29,206,0,29,206,0,29,206,0,29,206,0,29,206,0,29,206,0,29,206,
+    0,40,186,0,40,186,0,40,186,0,40,186,0,40,186,0,40,186,0,40,186,0,40,186,0,40,186,0,40,186,0,40,186,0,40,186,
+    0,53,163,0,53,163,0,53,163,0,53,163,0,53,163,0,53,163,0,53,163,0,53,163,0,53,163,0,53,163,0,53,163,0,53,163,
+    0,65,139,0,65,139,0,65,139,0,65,139,0,65,139,0,65,139,0,65,139,0,65,139,0,65,139,0,65,139,0,65,139,0,65,139,
+    0,78,114,0,78,114,0,78,114,0,78,114,0,78,114,0,78,114,0,78,114,0,78,114,0,78,114,0,78,114,0,78,114,0,78,114,
+    0,88,88,0,88,88,0,88,88,0,88,88,0,88,88,0,88,88,0,88,88,0,88,88,0,88,88,0,88,88,0,88,88,0,88,88,
+    0,96,65,0,96,65,0,96,65,0,96,65,0,96,65,0,96,65,0,96,65,0,96,65,0,96,65,0,96,65,0,96,65,0,96,65,
+    0,101,47,0,101,47,0,101,47,0,101,47,0,101,47,0,101,47,0,101,47,0,101,47,0,101,47,0,101,47,0,101,47,0,101,47,
+    0,103,33,0,103,33,0,103,33,0,103,33,0,103,33,0,103,33,0,103,33,0,103,33,0,103,33,0,103,33,0,103,33,0,103,33,
+    0,104,22,0,104,22,0,104,22,0,104,22,0,104,22,0,104,22,0,104,22,0,104,22,0,104,22,0,104,22,0,104,22,0,104,22,
+    0,104,14,0,104,14,0,104,14,0,104,14,0,104,14,0,104,14,0,104,14,0,104,14,0,104,14,0,104,14,0,104,14,0,104,14,
+    0,103,9,0,103,9,0,103,9,0,103,9,0,103,9,0,103,9,0,103,9,0,103,9,0,103,9,0,103,9,0,103,9,0,103,9,
+    0,101,5,0,101,5,0,101,5,0,101,5,0,101,5,0,101,5,0,101,5,0,101,5,0,101,5,0,101,5,0,101,5,0,101,5,
+    0,101,2,0,101,2,0,101,2,0,101,2,0,101,2,0,101,2,0,101,2,0,101,2,0,101,2,0,101,2,0,101,2,0,101,2,
+    0,100,0,0,100,0,0,100,0,0,100,0,0,100,0,0,100,0,0,100,0,0,100,0,0,100,0,0,100,0,0,100,0,0,100,0,
+    0,100,0,0,100,0,0,100,0,0,100,0,0,100,0,0,100,0,0,100,0,0,100,0,0,100,0,0,100,0,0,100,0,0,100,0,
+    0,100,0,0,100,0,0,100,0,0,100,0,0,100,0,0,100,0,0,100,0,0,100,0,0,100,0,0,100,0,0,100,0,0,100,0,
+    0,100,0,0,100,0,0,100,0,0,100,0,0,100,0,0,100,0,0,100,0,0,100,0,0,100,0,0,100,0,0,100,0,0,100,0
+};
+
+// patch
+static const uint8_t GOLDEN_FRAMES_35[] = {
+    89,89,255,101,101,255,112,112,255,124,124,255,135,135,255,147,147,255,159,159,255,170,170,255,182,182,255,193,193,255,205,205,255,216,216,255,
+    95,95,255,107,107,255,118,118,255,130,130,255,141,141,255,153,153,255,165,165,255,176,176,255,188,188,255,200,200,255,211,211,255,223,223,255,
+    102,102,255,113,113,255,125,125,255,136,136,255,148,148,255,159,159,255,171,171,255,182,182,255,194,194,255,206,206,255,217,217,255,229,229,255,
+    108,108,255,120,120,255,131,131,255,143,143,255,154,154,255,166,166,255,178,178,255,189,189,255,201,201,255,212,212,255,224,224,255,235,235,255,
+    114,114,255,126,126,255,137,137,255,149,149,255,160,160,255,172,172,255,184,184,255,195,195,255,207,207,255,219,219,255,230,230,255,242,242,255,
+    121,121,255,133,133,255,144,144,255,156,156,255,167,167,255,179,179,255,191,191,255,202,202,255,214,214,255,225,225,255,237,237,255,248,248,255,
+    127,127,255,139,139,255,150,150,255,162,162,255,173,173,255,185,185,255,197,197,255,208,208,255,220,220,255,231,231,255,243,243,255,0,0,255,
+    133,133,255,145,145,255,157,157,255,168,168,255,180,180,255,191,191,255,203,203,255,215,215,255,226,226,255,238,238,255,249,249,255,6,6,255,
+    140,140,255,151,151,255,163,163,255,175,175,255,186,186,255,198,198,255,209,209,255,221,221,255,232,232,255,244,244,255,1,1,255,12,12,255,
+    146,146,255,158,158,255,169,169,255,181,181,255,192,192,255,204,204,255,216,216,255,227,227,255,239,239,255,250,250,255,7,7,255,19,19,255,
+    153,153,255,164,164,255,176,176,255,187,187,255,199,199,255,210,210,255,222,222,255,234,234,255,245,245,255,2,2,255,13,13,255,25,25,255,
+    159,159,255,170,170,255,182,182,255,194,194,255,205,205,255,217,217,255,228,228,255,240,240,255,252,252,255,8,8,255,20,20,255,31,31,255
+};
+
+static const GoldenFrames GOLDEN_FRAMES[] = {
+    {"solid", GOLDEN_FRAMES_0, sizeof(GOLDEN_FRAMES_0)},
+    {"fade/Linear", GOLDEN_FRAMES_1, sizeof(GOLDEN_FRAMES_1)},
+    {"fade/QuadraticIn", GOLDEN_FRAMES_2, sizeof(GOLDEN_FRAMES_2)},
+    {"fade/QuadraticOut", GOLDEN_FRAMES_3, sizeof(GOLDEN_FRAMES_3)},
+    {"fade/QuadraticInOut", GOLDEN_FRAMES_4, sizeof(GOLDEN_FRAMES_4)},
+    {"fade/CubicIn", GOLDEN_FRAMES_5, sizeof(GOLDEN_FRAMES_5)},
+    {"fade/CubicOut", GOLDEN_FRAMES_6, sizeof(GOLDEN_FRAMES_6)},
+    {"fade/CubicInOut", GOLDEN_FRAMES_7, sizeof(GOLDEN_FRAMES_7)},
+    {"fade/QuarticIn", GOLDEN_FRAMES_8, sizeof(GOLDEN_FRAMES_8)},
+    {"fade/QuarticOut", GOLDEN_FRAMES_9, sizeof(GOLDEN_FRAMES_9)},
+    {"fade/QuarticInOut", GOLDEN_FRAMES_10, sizeof(GOLDEN_FRAMES_10)},
+    {"fade/QuinticIn", GOLDEN_FRAMES_11, sizeof(GOLDEN_FRAMES_11)},
+    {"fade/QuinticOut", GOLDEN_FRAMES_12, sizeof(GOLDEN_FRAMES_12)},
+    {"fade/QuinticInOut", GOLDEN_FRAMES_13, sizeof(GOLDEN_FRAMES_13)},
+    {"fade/SinusoidalIn", GOLDEN_FRAMES_14, sizeof(GOLDEN_FRAMES_14)},
+    {"fade/SinusoidalOut", GOLDEN_FRAMES_15, sizeof(GOLDEN_FRAMES_15)},
+    {"fade/SinusoidalInOut", GOLDEN_FRAMES_16, sizeof(GOLDEN_FRAMES_16)},
+    {"fade/ExponentialIn", GOLDEN_FRAMES_17, sizeof(GOLDEN_FRAMES_17)},
+    {"fade/ExponentialOut", GOLDEN_FRAMES_18, sizeof(GOLDEN_FRAMES_18)},
+    {"fade/ExponentialInOut", GOLDEN_FRAMES_19, sizeof(GOLDEN_FRAMES_19)},
+    {"fade/Mirror(QuadraticIn)", GOLDEN_FRAMES_20, sizeof(GOLDEN_FRAMES_20)},
+    {"fade/Reverse(CubicOut)", GOLDEN_FRAMES_21, sizeof(GOLDEN_FRAMES_21)},
+    {"fade/Reverse(Mirror(SinusoidalIn))", GOLDEN_FRAMES_22, sizeof(GOLDEN_FRAMES_22)},
+    {"fade_loop", GOLDEN_FRAMES_23, sizeof(GOLDEN_FRAMES_23)},
+    {"gradient_scale", GOLDEN_FRAMES_24, sizeof(GOLDEN_FRAMES_24)},
+    {"gradient_positions", GOLDEN_FRAMES_25, sizeof(GOLDEN_FRAMES_25)},
+    {"gradient_random", GOLDEN_FRAMES_26, sizeof(GOLDEN_FRAMES_26)},
+    {"gradient_wrap", GOLDEN_FRAMES_27, sizeof(GOLDEN_FRAMES_27)},
+    {"gradient_list", GOLDEN_FRAMES_28, sizeof(GOLDEN_FRAMES_28)},
+    {"hsv_meander", GOLDEN_FRAMES_29, sizeof(GOLDEN_FRAMES_29)},
+    {"hsv_meander_random", GOLDEN_FRAMES_30, sizeof(GOLDEN_FRAMES_30)},
+    {"overlay", GOLDEN_FRAMES_31, sizeof(GOLDEN_FRAMES_31)},
+    {"color_transition", GOLDEN_FRAMES_32, sizeof(GOLDEN_FRAMES_32)},
+    {"brightness_transition", GOLDEN_FRAMES_33, sizeof(GOLDEN_FRAMES_33)},
+    {"transaction", GOLDEN_FRAMES_34, sizeof(GOLDEN_FRAMES_34)},
+    {"patch", GOLDEN_FRAMES_35, sizeof(GOLDEN_FRAMES_35)},
+};
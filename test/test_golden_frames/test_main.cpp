@@ -0,0 +1,366 @@
+/**
+ * Golden frame regression tests
+ *
+ * Renders fixed frame sequences through LightWeaverCoreImpl with a capturing driver and a fake clock,
+ * and compares every pixel against the frames checked in to golden_frames.h
+ *
+ * After an intended change to the rendered output, regenerate the golden frames by building with
+ * GOLDEN_FRAMES_UPDATE set to the output path, e.g.
+ *   PLATFORMIO_BUILD_FLAGS='-DGOLDEN_FRAMES_UPDATE=\"test/test_golden_frames/golden_frames.h\"' pio test -e native -f test_golden_frames
+ */
+#include <unity.h>
+#include <vector>
+#include <LightWeaver.h>
+#include <LightWeaver/colorSources/SolidColorSource.h>
+#include <LightWeaver/colorSources/FadeColorSource.h>
+#include <LightWeaver/colorSources/GradientColorSource.h>
+#include <LightWeaver/colorSources/HsvMeanderColorSource.h>
+#include <LightWeaver/colorSources/OverlayColorSource.h>
+#include <NativeTest.h>
+
+#ifndef GOLDEN_FRAMES_UPDATE
+#include "golden_frames.h"
+#endif
+
+using namespace LightWeaver;
+
+#define PIXEL_COUNT 12
+// Each frame is the RGB value of every pixel as sent to the driver, with the brightness applied
+#define FRAME_SIZE (PIXEL_COUNT * 3)
+// Maximum difference per channel, so that optimizations with slightly different rounding still pass
+#define GOLDEN_FRAME_TOLERANCE 2
+
+namespace {
+    typedef NativeTest::CapturingDriver<> CapturingDriver;
+    typedef LightWeaverCoreImpl<CapturingDriver> Core;
+    std::vector<uint8_t>& capturedFrames = CapturingDriver::frames;
+
+    struct EasingCase {
+        const char* name;
+        EasingFunction easing;
+    };
+
+    const EasingCase EASINGS[] = {
+        {"Linear", Easing::Linear},
+        {"QuadraticIn", Easing::QuadraticIn},
+        {"QuadraticOut", Easing::QuadraticOut},
+        {"QuadraticInOut", Easing::QuadraticInOut},
+        {"CubicIn", Easing::CubicIn},
+        {"CubicOut", Easing::CubicOut},
+        {"CubicInOut", Easing::CubicInOut},
+        {"QuarticIn", Easing::QuarticIn},
+        {"QuarticOut", Easing::QuarticOut},
+        {"QuarticInOut", Easing::QuarticInOut},
+        {"QuinticIn", Easing::QuinticIn},
+        {"QuinticOut", Easing::QuinticOut},
+        {"QuinticInOut", Easing::QuinticInOut},
+        {"SinusoidalIn", Easing::SinusoidalIn},
+        {"SinusoidalOut", Easing::SinusoidalOut},
+        {"SinusoidalInOut", Easing::SinusoidalInOut},
+        {"ExponentialIn", Easing::ExponentialIn},
+        {"ExponentialOut", Easing::ExponentialOut},
+        {"ExponentialInOut", Easing::ExponentialInOut},
+        {"Mirror(QuadraticIn)", Easing::Mirror(Easing::QuadraticIn)},
+        {"Reverse(CubicOut)", Easing::Reverse(Easing::CubicOut)},
+        {"Reverse(Mirror(SinusoidalIn))", Easing::Reverse(Easing::Mirror(Easing::SinusoidalIn))}
+    };
+
+    const RgbaColor RED{255, 0, 0, 255};
+    const RgbaColor GREEN{0, 255, 0, 255};
+    const RgbaColor BLUE{0, 0, 255, 255};
+    const RgbaColor WHITE{255, 255, 255, 255};
+
+    void renderFrames(Core& core, uint16_t frameCount, uint32_t frameInterval) {
+        for (uint16_t i = 0; i < frameCount; i++) {
+            NativeClock::advanceMillis(frameInterval);
+            core.loop();
+        }
+    }
+
+    // Starts a core showing nothing, so that the captured frames start from a known state
+    void startCore(Core& core) {
+        core.setRenderBudget(0);
+        core.setup();
+        capturedFrames.clear();
+    }
+
+    Gradient createGradient() {
+        const RgbaColor colors[] = {RED, GREEN, BLUE};
+        return Gradient(ColorSet(3, colors));
+    }
+
+#ifdef GOLDEN_FRAMES_UPDATE
+    struct GoldenFramesUpdate {
+        String name;
+        std::vector<uint8_t> frames;
+    };
+    std::vector<GoldenFramesUpdate> goldenFramesUpdates;
+
+    void assertGoldenFrames(const char* name) {
+        goldenFramesUpdates.push_back(GoldenFramesUpdate{name, capturedFrames});
+    }
+
+    void writeGoldenFrames() {
+        FILE* file = fopen(GOLDEN_FRAMES_UPDATE, "w");
+        TEST_ASSERT_NOT_NULL_MESSAGE(file, "Could not open " GOLDEN_FRAMES_UPDATE);
+        fprintf(file, "#pragma once\n// Generated by test_golden_frames with GOLDEN_FRAMES_UPDATE defined, do not edit by hand\n#include <stdint.h>\n\n");
+        fprintf(file, "struct GoldenFrames {\n    const char* name;\n    const uint8_t* frames;\n    uint32_t size;\n};\n\n");
+        for (size_t i = 0; i < goldenFramesUpdates.size(); i++) {
+            const std::vector<uint8_t>& frames = goldenFramesUpdates[i].frames;
+            fprintf(file, "// %s\nstatic const uint8_t GOLDEN_FRAMES_%u[] = {", goldenFramesUpdates[i].name.c_str(), (unsigned int)i);
+            for (size_t j = 0; j < frames.size(); j++) {
+                fprintf(file, "%s%u", j % FRAME_SIZE == 0 ? "\n    " : "", frames[j]);
+                if (j != frames.size() - 1) fprintf(file, ",");
+            }
+            fprintf(file, "\n};\n\n");
+        }
+        fprintf(file, "static const GoldenFrames GOLDEN_FRAMES[] = {\n");
+        for (size_t i = 0; i < goldenFramesUpdates.size(); i++) {
+            fprintf(file, "    {\"%s\", GOLDEN_FRAMES_%u, sizeof(GOLDEN_FRAMES_%u)},\n", goldenFramesUpdates[i].name.c_str(), (unsigned int)i, (unsigned int)i);
+        }
+        fprintf(file, "};\n");
+        fclose(file);
+    }
+#else
+    void assertGoldenFrames(const char* name) {
+        char message[160];
+        const GoldenFrames* golden = nullptr;
+        for (size_t i = 0; i < sizeof(GOLDEN_FRAMES) / sizeof(GOLDEN_FRAMES[0]); i++) {
+            if (strcmp(GOLDEN_FRAMES[i].name, name) == 0) {
+                golden = &GOLDEN_FRAMES[i];
+            }
+        }
+        snprintf(message, sizeof(message), "No golden frames for %s", name);
+        TEST_ASSERT_NOT_NULL_MESSAGE(golden, message);
+
+        snprintf(message, sizeof(message), "%s: rendered %u frames, expected %u", name,
+            (unsigned int)(capturedFrames.size() / FRAME_SIZE), (unsigned int)(golden->size / FRAME_SIZE));
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE(golden->size, capturedFrames.size(), message);
+
+        for (uint32_t i = 0; i < golden->size; i++) {
+            int difference = abs((int)capturedFrames[i] - (int)golden->frames[i]);
+            if (difference > GOLDEN_FRAME_TOLERANCE) {
+                uint32_t offset = i % FRAME_SIZE;
+                snprintf(message, sizeof(message), "%s: frame %u pixel %u channel %c is %u, expected %u", name,
+                    i / FRAME_SIZE, offset / 3, "RGB"[offset % 3], capturedFrames[i], golden->frames[i]);
+                TEST_FAIL_MESSAGE(message);
+            }
+        }
+    }
+#endif
+}
+
+void setUp() {
+    NativeTest::reset();
+    CapturingDriver::isRecordingFrames = true;
+    capturedFrames.clear();
+}
+
+void tearDown() {}
+
+void test_solid() {
+    Core core(PIXEL_COUNT, 1);
+    startCore(core);
+    core.setColorSource(SolidColorSource(1, RgbaColor(255, 128, 0, 255)));
+    renderFrames(core, 12, 50);
+    assertGoldenFrames("solid");
+}
+
+void test_fade_easings() {
+    for (const EasingCase& easingCase : EASINGS) {
+        setUp();
+        Core core(PIXEL_COUNT, 1);
+        startCore(core);
+        core.setColorSource(FadeColorSource(1, RED, BLUE, 2000, false, easingCase.easing));
+        renderFrames(core, 18, 125);
+        assertGoldenFrames((String("fade/") + easingCase.name).c_str());
+    }
+}
+
+void test_fade_loop() {
+    Core core(PIXEL_COUNT, 1);
+    startCore(core);
+    core.setColorSource(FadeColorSource(1, WHITE, BLUE, 1000, true, Easing::Mirror(Easing::QuadraticInOut)));
+    renderFrames(core, 20, 150);
+    assertGoldenFrames("fade_loop");
+}
+
+void test_gradient_scale() {
+    Core core(PIXEL_COUNT, 1);
+    startCore(core);
+    core.setColorSource(GradientColorSource(1, createGradient(), 3000, true, Easing::Linear, PixelOffsetConfig::withScale(0.5)));
+    renderFrames(core, 16, 200);
+    assertGoldenFrames("gradient_scale");
+}
+
+void test_gradient_positions() {
+    const RgbaColor colors[] = {RED, WHITE, GREEN, BLUE};
+    const uint8_t positions[] = {0, 40, 200, 255};
+    Core core(PIXEL_COUNT, 1);
+    startCore(core);
+    core.setColorSource(GradientColorSource(1, Gradient(ColorSet(4, colors), positions, Easing::CubicInOut), 2000, true, Easing::QuadraticIn, PixelOffsetConfig::withScale(-1.0)));
+    renderFrames(core, 16, 150);
+    assertGoldenFrames("gradient_positions");
+}
+
+void test_gradient_random() {
+    Core core(PIXEL_COUNT, 1);
+    startCore(core);
+    core.setColorSource(GradientColorSource(1, createGradient(), 2000, true, Easing::Linear, PixelOffsetConfig::withRandom()));
+    renderFrames(core, 12, 200);
+    assertGoldenFrames("gradient_random");
+}
+
+void test_gradient_wrap() {
+    const RgbaColor colors[] = {RgbaColor(0, 0, 0, 255), WHITE};
+    Core core(PIXEL_COUNT, 1);
+    startCore(core);
+    core.setColorSource(GradientColorSource(1, Gradient(ColorSet(2, colors)), 2000, true, Easing::Linear, PixelOffsetConfig::withScale(0.5)));
+    // Waits for the transition from black to end
+    renderFrames(core, 20, 100);
+    capturedFrames.clear();
+    renderFrames(core, 30, 70);
+
+    // Each pixel is brighter than the one before it, except at the wrap from white back to black,
+    // which stays a hard edge rather than a ramp across several pixels
+    for (size_t frame = 0; frame < capturedFrames.size(); frame += FRAME_SIZE) {
+        for (uint16_t pixel = 1; pixel < PIXEL_COUNT; pixel++) {
+            int difference = (int)capturedFrames[frame + pixel * 3] - (int)capturedFrames[frame + (pixel - 1) * 3];
+            TEST_ASSERT_TRUE(difference >= -GOLDEN_FRAME_TOLERANCE || difference <= -200);
+        }
+    }
+    assertGoldenFrames("gradient_wrap");
+}
+
+void test_gradient_list() {
+    const float offsets[] = {0.0f, 0.5f, 0.25f, 0.75f, 0.1f, 0.9f};
+    Core core(PIXEL_COUNT, 1);
+    startCore(core);
+    core.setColorSource(GradientColorSource(1, createGradient(), 2000, false, Easing::Linear, PixelOffsetConfig::withList(6, offsets)));
+    renderFrames(core, 12, 200);
+    assertGoldenFrames("gradient_list");
+}
+
+void test_hsv_meander() {
+    Core core(PIXEL_COUNT, 1);
+    startCore(core);
+    core.setColorSource(HsvMeanderColorSource(1, HsvaColor(200, 0.8, 0.7), 10000, 60, 0.2, 0.3, PixelOffsetConfig::withScale(0.2)));
+    renderFrames(core, 20, 250);
+    assertGoldenFrames("hsv_meander");
+}
+
+void test_hsv_meander_random() {
+    Core core(PIXEL_COUNT, 1);
+    startCore(core);
+    core.setColorSource(HsvMeanderColorSource(1, HsvaColor(30, 1, 1), 4000, 30, 0.1, 0.1, PixelOffsetConfig::withRandom()));
+    renderFrames(core, 12, 100);
+    assertGoldenFrames("hsv_meander_random");
+}
+
+void test_overlay() {
+    GradientColorSource background(2, createGradient(), 2000, true, Easing::Linear, PixelOffsetConfig::withScale(1.0));
+    FadeColorSource overlay(3, RgbaColor(255, 255, 255, 0), RgbaColor(255, 255, 255, 128), 1000, true, Easing::Mirror(Easing::Linear));
+    Core core(PIXEL_COUNT, 1);
+    startCore(core);
+    core.setColorSource(OverlayColorSource(1, background, overlay));
+    renderFrames(core, 16, 150);
+    assertGoldenFrames("overlay");
+}
+
+void test_color_transition() {
+    Core core(PIXEL_COUNT, 1);
+    startCore(core);
+    core.setColorSource(SolidColorSource(1, RED));
+    renderFrames(core, 2, 500);
+    capturedFrames.clear();
+
+    core.setColorSource(GradientColorSource(2, createGradient(), 1000, false, Easing::Linear, PixelOffsetConfig::withScale(1.0)));
+    renderFrames(core, 24, 25);
+    assertGoldenFrames("color_transition");
+}
+
+void test_brightness_transition() {
+    Core core(PIXEL_COUNT, 1);
+    startCore(core);
+    core.setColorSource(SolidColorSource(1, WHITE));
+    renderFrames(core, 2, 500);
+    capturedFrames.clear();
+
+    core.setBrightness(32);
+    renderFrames(core, 24, 25);
+    assertGoldenFrames("brightness_transition");
+}
+
+void test_transaction() {
+    Core core(PIXEL_COUNT, 1);
+    startCore(core);
+    core.setColorSource(SolidColorSource(1, BLUE));
+    renderFrames(core, 2, 500);
+    capturedFrames.clear();
+
+    core.beginTransaction();
+    core.setColorSource(SolidColorSource(2, GREEN));
+    core.setBrightness(100);
+    core.commitTransaction();
+    renderFrames(core, 24, 25);
+    assertGoldenFrames("transaction");
+}
+
+void test_patch() {
+    Core core(PIXEL_COUNT, 1);
+    startCore(core);
+    core.setColorSource(GradientColorSource(1, createGradient(), 2000, true, Easing::Linear, PixelOffsetConfig::withScale(0.5)));
+    renderFrames(core, 8, 100);
+    capturedFrames.clear();
+
+    const RgbaColor colors[] = {BLUE, WHITE};
+    TEST_ASSERT_TRUE(core.patchColorSource(GradientColorSource(1, Gradient(ColorSet(2, colors)), 4000, true, Easing::Linear, PixelOffsetConfig::withScale(0.5))));
+    renderFrames(core, 12, 100);
+    assertGoldenFrames("patch");
+}
+
+void test_brightness_keeps_key_frames() {
+    // Setting the same brightness every frame must not change the frames interpolated between key frames
+    std::vector<uint8_t> frames[2];
+    for (uint8_t i = 0; i < 2; i++) {
+        NativeClock::setMicros(1000000);
+        Core core(PIXEL_COUNT, 1);
+        startCore(core);
+        core.setColorSource(HsvMeanderColorSource(1, HsvaColor(200, 0.8, 0.7), 10000, 60, 0.2, 0.3, PixelOffsetConfig::withScale(0.2)));
+        renderFrames(core, 4, 25);
+        capturedFrames.clear();
+        for (uint16_t frame = 0; frame < 40; frame++) {
+            if (i == 1) {
+                core.setBrightness(255);
+            }
+            renderFrames(core, 1, 25);
+        }
+        frames[i] = capturedFrames;
+    }
+    TEST_ASSERT_EQUAL_UINT32(frames[0].size(), frames[1].size());
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(frames[0].data(), frames[1].data(), frames[0].size());
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_solid);
+    RUN_TEST(test_fade_easings);
+    RUN_TEST(test_fade_loop);
+    RUN_TEST(test_gradient_scale);
+    RUN_TEST(test_gradient_positions);
+    RUN_TEST(test_gradient_random);
+    RUN_TEST(test_gradient_wrap);
+    RUN_TEST(test_gradient_list);
+    RUN_TEST(test_hsv_meander);
+    RUN_TEST(test_hsv_meander_random);
+    RUN_TEST(test_overlay);
+    RUN_TEST(test_color_transition);
+    RUN_TEST(test_brightness_transition);
+    RUN_TEST(test_transaction);
+    RUN_TEST(test_patch);
+    RUN_TEST(test_brightness_keeps_key_frames);
+#ifdef GOLDEN_FRAMES_UPDATE
+    writeGoldenFrames();
+#endif
+    return UNITY_END();
+}
@@ -0,0 +1,326 @@
+/**
+ * Streaming JSON tests
+ *
+ * Checks that JsonStreamParser and the deserializers built on it give the same result however the
+ * document is split into chunks, including splits inside of keys, strings, numbers and literals
+ */
+#include <unity.h>
+#include <vector>
+#include <LightWeaver.h>
+#include <LightWeaver/colorSources/GradientColorSource.h>
+#include <LightWeaver/colorSources/SolidColorSource.h>
+#include <internal/BatchDeserializer.h>
+#include <internal/JsonStreamParser.h>
+#include <internal/PresetDeserializer.h>
+#include <internal/SegmentColorSourceDeserializer.h>
+#include <internal/StreamingColorSourceDeserializer.h>
+
+using namespace LightWeaver;
+
+namespace {
+    // Records every token as a line of text, so that two parses can be compared
+    class RecordingListener : public JsonStreamListener {
+        public:
+            String tokens;
+
+            virtual void onObjectStart() { tokens += "{\n"; }
+            virtual void onObjectEnd() { tokens += "}\n"; }
+            virtual void onArrayStart() { tokens += "[\n"; }
+            virtual void onArrayEnd() { tokens += "]\n"; }
+            virtual void onKey(const char* key) {
+                tokens += "key ";
+                tokens += key;
+                tokens += "\n";
+            }
+            virtual void onValue(ValueType type, const char* value) {
+                tokens += String((int)type) + " ";
+                tokens += value;
+                tokens += "\n";
+            }
+    };
+
+    JsonStreamParser::Status parse(const char* json, size_t chunkSize, RecordingListener& listener) {
+        JsonStreamParser parser(listener);
+        size_t length = strlen(json);
+        for (size_t i = 0; i < length; i += chunkSize) {
+            parser.write((const uint8_t*)json + i, std::min(chunkSize, length - i));
+        }
+        return parser.finish();
+    }
+
+    // Splits the document once at split, then writes the rest
+    StreamingColorSourceDeserializer::Result deserialize(const char* json, size_t split) {
+        StreamingColorSourceDeserializer deserializer;
+        size_t length = strlen(json);
+        deserializer.write((const uint8_t*)json, split);
+        deserializer.write((const uint8_t*)json + split, length - split);
+        return deserializer.finish();
+    }
+
+    StreamingColorSourceDeserializer::Result deserializeInChunks(const String& json, size_t chunkSize) {
+        StreamingColorSourceDeserializer deserializer;
+        for (size_t i = 0; i < json.length(); i += chunkSize) {
+            deserializer.write((const uint8_t*)json.c_str() + i, std::min(chunkSize, json.length() - i));
+        }
+        return deserializer.finish();
+    }
+
+    BatchDeserializer::Result deserializeBatch(const char* json, size_t split) {
+        BatchDeserializer deserializer;
+        size_t length = strlen(json);
+        deserializer.write((const uint8_t*)json, split);
+        deserializer.write((const uint8_t*)json + split, length - split);
+        return deserializer.finish();
+    }
+
+    SegmentColorSourceDeserializer::Result deserializeSegment(const char* json, size_t split) {
+        SegmentColorSourceDeserializer deserializer;
+        size_t length = strlen(json);
+        deserializer.write((const uint8_t*)json, split);
+        deserializer.write((const uint8_t*)json + split, length - split);
+        return deserializer.finish();
+    }
+
+    PresetDeserializer::Result deserializePreset(const char* json, size_t split) {
+        PresetDeserializer deserializer;
+        size_t length = strlen(json);
+        deserializer.write((const uint8_t*)json, split);
+        deserializer.write((const uint8_t*)json + split, length - split);
+        return deserializer.finish();
+    }
+
+    const char* DOCUMENT = "{\"name\":\"a\\\"b\\u00e9\",\"values\":[12, -3.5e2, true, false, null],\"nested\":{\"empty\":[]}}";
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_parser_tokens() {
+    RecordingListener listener;
+    TEST_ASSERT_EQUAL(JsonStreamParser::Status::Complete, parse(DOCUMENT, strlen(DOCUMENT), listener));
+    TEST_ASSERT_EQUAL_STRING(
+        "{\nkey name\n0 a\"b\xc3\xa9\nkey values\n[\n1 12\n2 -3.5e2\n3 true\n3 false\n4 null\n]\n"
+        "key nested\n{\nkey empty\n[\n]\n}\n}\n",
+        listener.tokens.c_str());
+}
+
+void test_parser_chunk_boundaries() {
+    RecordingListener whole;
+    parse(DOCUMENT, strlen(DOCUMENT), whole);
+    // Every chunk size from a single character up splits some token, escape sequence and literal
+    for (size_t chunkSize = 1; chunkSize < strlen(DOCUMENT); chunkSize++) {
+        RecordingListener chunked;
+        TEST_ASSERT_EQUAL(JsonStreamParser::Status::Complete, parse(DOCUMENT, chunkSize, chunked));
+        TEST_ASSERT_EQUAL_STRING(whole.tokens.c_str(), chunked.tokens.c_str());
+    }
+}
+
+void test_parser_top_level_number() {
+    // The number is only complete once the input ends
+    RecordingListener listener;
+    TEST_ASSERT_EQUAL(JsonStreamParser::Status::Complete, parse("12", 1, listener));
+    TEST_ASSERT_EQUAL_STRING("1 12\n", listener.tokens.c_str());
+}
+
+void test_parser_errors() {
+    const char* documents[] = {
+        "{\"a\":}",
+        "{\"a\" 1}",
+        "[1,]",
+        "[1] 2",
+        "tru",
+        "{\"a\":1",
+        "\"\\x\"",
+        "[[[[[[[[[[[[[[[[[1]]]]]]]]]]]]]]]]]",
+        "\"0123456789012345678901234567890123456789012345678901234567890123456789\""
+    };
+    for (const char* document : documents) {
+        RecordingListener listener;
+        TEST_ASSERT_EQUAL_MESSAGE(JsonStreamParser::Status::Error, parse(document, 1, listener), document);
+    }
+}
+
+void test_deserializer_split_anywhere() {
+    const char* json = "{\"type\":\"Solid\",\"uid\":1234,\"color\":\"#102030\"}";
+    for (size_t split = 0; split <= strlen(json); split++) {
+        StreamingColorSourceDeserializer::Result result = deserialize(json, split);
+        TEST_ASSERT_TRUE(result);
+        TEST_ASSERT_EQUAL(ColorSource::Type::Solid, result.value->getType());
+        TEST_ASSERT_EQUAL_UINT32(1234, result.value->uid);
+        RgbaColor color = static_cast<SolidColorSource*>(result.value.get())->getColor();
+        TEST_ASSERT_EQUAL_UINT8(0x10, color.R);
+        TEST_ASSERT_EQUAL_UINT8(0x20, color.G);
+        TEST_ASSERT_EQUAL_UINT8(0x30, color.B);
+    }
+}
+
+void test_deserializer_offset_list() {
+    // Long enough to take several blocks, with the last one partly filled
+    const uint16_t count = 300;
+    String json = "{\"type\":\"Gradient\",\"uid\":7,\"duration\":1000,\"gradient\":{\"colors\":[\"#000000\",\"#ffffff\"]},"
+        "\"pixelOffsets\":{\"type\":\"OffsetList\",\"offsets\":[";
+    for (uint16_t i = 0; i < count; i++) {
+        if (i > 0) json += ",";
+        json += String(i * 0.25f, 2);
+    }
+    json += "]}}";
+
+    for (size_t chunkSize : {(size_t)1, (size_t)7, (size_t)64, (size_t)json.length()}) {
+        StreamingColorSourceDeserializer::Result result = deserializeInChunks(json, chunkSize);
+        TEST_ASSERT_TRUE(result);
+        const PixelOffsetConfig& offsets = static_cast<GradientColorSource*>(result.value.get())->getPixelOffsets();
+        TEST_ASSERT_EQUAL(PixelOffsetConfig::Type::LIST, offsets.getType());
+        TEST_ASSERT_EQUAL_UINT16(count, offsets.getOffsetCount());
+        for (uint16_t i = 0; i < count; i++) {
+            TEST_ASSERT_EQUAL_FLOAT(i * 0.25f, offsets.getOffsets()[i]);
+        }
+    }
+}
+
+void test_deserializer_errors() {
+    StreamingColorSourceDeserializer::Result missing = deserialize("{\"type\":\"Solid\",\"uid\":1}", 10);
+    TEST_ASSERT_FALSE(missing);
+    TEST_ASSERT_EQUAL_STRING("Required fields missing: color", missing.error.c_str());
+
+    StreamingColorSourceDeserializer::Result invalid = deserialize("{\"type\":\"Gradient\",\"uid\":1,\"duration\":1000,"
+        "\"gradient\":{\"colors\":[\"#000000\"]},\"pixelOffsets\":{\"type\":\"OffsetList\",\"offsets\":[0,\"a\"]}}", 40);
+    TEST_ASSERT_FALSE(invalid);
+
+    // An array in place of a color must not shift the names of the colors after it
+    StreamingColorSourceDeserializer::Result nestedList = deserialize("{\"type\":\"Gradient\",\"uid\":1,\"duration\":1000,"
+        "\"gradient\":{\"colors\":[[1],\"#000000\",\"a\"]}}", 40);
+    TEST_ASSERT_FALSE(nestedList);
+    TEST_ASSERT_EQUAL_STRING("Invalid value for fields: gradient.colors.0, gradient.colors.2", nestedList.error.c_str());
+
+    StreamingColorSourceDeserializer::Result nestedPositions = deserialize("{\"type\":\"Gradient\",\"uid\":1,\"duration\":1000,"
+        "\"gradient\":{\"colors\":{\"0\":[1],\"128\":\"#000000\",\"255\":\"a\"}}}", 40);
+    TEST_ASSERT_FALSE(nestedPositions);
+    TEST_ASSERT_EQUAL_STRING("Invalid value for fields: gradient.colors.0, gradient.colors.255", nestedPositions.error.c_str());
+
+    StreamingColorSourceDeserializer::Result truncated = deserialize("{\"type\":\"Solid\",\"uid\":1,\"color\":\"#1020", 20);
+    TEST_ASSERT_FALSE(truncated);
+}
+
+void test_batch_split_anywhere() {
+    const char* json = "{\"operations\":[{\"type\":\"setBrightness\",\"brightness\":40},"
+        "{\"colorSource\":{\"type\":\"Overlay\",\"uid\":3,\"background\":{\"type\":\"Solid\",\"uid\":4,\"color\":\"#ff0000\"},"
+        "\"overlay\":{\"type\":\"Solid\",\"uid\":5,\"color\":\"#0000ff80\"}},\"type\":\"setColorSource\"},"
+        "{\"type\":\"clearColorSource\",\"ignored\":[{\"type\":\"setBrightness\"}]}],\"ignored\":{\"operations\":5}}";
+    for (size_t split = 0; split <= strlen(json); split++) {
+        BatchDeserializer::Result result = deserializeBatch(json, split);
+        TEST_ASSERT_TRUE(result);
+        TEST_ASSERT_EQUAL_UINT8(3, result.count);
+        TEST_ASSERT_EQUAL(BatchOperation::Type::SetBrightness, result.operations[0].type);
+        TEST_ASSERT_EQUAL_UINT8(40, result.operations[0].brightness);
+        TEST_ASSERT_EQUAL(BatchOperation::Type::SetColorSource, result.operations[1].type);
+        TEST_ASSERT_EQUAL(ColorSource::Type::Overlay, result.operations[1].colorSource->getType());
+        TEST_ASSERT_EQUAL_UINT32(3, result.operations[1].colorSource->uid);
+        TEST_ASSERT_EQUAL(BatchOperation::Type::ClearColorSource, result.operations[2].type);
+    }
+}
+
+void test_batch_errors() {
+    struct {
+        const char* json;
+        const char* error;
+    } batches[] = {
+        {"{}", "Required fields missing: operations"},
+        {"[{\"operations\":[]}]", "Required fields missing: operations"},
+        {"{\"operations\":{}}", "Invalid value for fields: operations"},
+        {"{\"operations\":[{\"type\":\"clearColorSource\"},5]}", "Required fields missing: operations.1.type"},
+        {"{\"operations\":[{\"type\":\"fade\"}]}", "Invalid value for fields: operations.0.type"},
+        {"{\"operations\":[{\"type\":\"setBrightness\",\"brightness\":256}]}", "Invalid value for fields: operations.0.brightness"},
+        {"{\"operations\":[{\"type\":\"setBrightness\",\"brightness\":[1]}]}", "Invalid value for fields: operations.0.brightness"},
+        {"{\"operations\":[{\"type\":\"setColorSource\"}]}", "Required fields missing: operations.0.colorSource"},
+        {"{\"operations\":[{\"type\":\"setColorSource\",\"colorSource\":\"#ff0000\"}]}", "Invalid value for fields: operations.0.colorSource"},
+        {"{\"operations\":[{\"type\":\"setColorSource\",\"colorSource\":{\"type\":\"Solid\",\"uid\":1}}]}", "operations.0.colorSource: Required fields missing: color"},
+        {"{\"operations\":[{\"type\":\"clearColorSource\"}", "Invalid JSON: Unexpected end of input"}
+    };
+    for (auto& batch : batches) {
+        BatchDeserializer::Result result = deserializeBatch(batch.json, 0);
+        TEST_ASSERT_FALSE(result);
+        TEST_ASSERT_EQUAL_STRING(batch.error, result.error.c_str());
+    }
+
+    String tooMany = "{\"operations\":[";
+    for (uint8_t i = 0; i <= BatchDeserializer::MAXIMUM_OPERATIONS; i++) {
+        tooMany += i > 0 ? ",{\"type\":\"clearColorSource\"}" : "{\"type\":\"clearColorSource\"}";
+    }
+    tooMany += "]}";
+    BatchDeserializer::Result result = deserializeBatch(tooMany.c_str(), 0);
+    TEST_ASSERT_EQUAL_STRING("Invalid value for fields: operations", result.error.c_str());
+}
+
+void test_segment_color_source() {
+    const char* json = "{\"colorSource\":{\"type\":\"Solid\",\"uid\":9,\"color\":\"#00ff00\"},\"ignored\":[{\"id\":1}],\"id\":12}";
+    for (size_t split = 0; split <= strlen(json); split++) {
+        SegmentColorSourceDeserializer::Result result = deserializeSegment(json, split);
+        TEST_ASSERT_TRUE(result);
+        TEST_ASSERT_EQUAL_UINT8(12, result.id);
+        TEST_ASSERT_EQUAL_UINT32(9, result.colorSource->uid);
+    }
+
+    struct {
+        const char* json;
+        const char* error;
+    } segments[] = {
+        {"{\"id\":1}", "Required fields missing: id, colorSource"},
+        {"{\"id\":-1,\"colorSource\":{}}", "Invalid value for fields: id"},
+        {"{\"id\":1,\"colorSource\":[]}", "Invalid value for fields: colorSource"},
+        {"{\"id\":1,\"colorSource\":{\"type\":\"Solid\",\"uid\":1}}", "colorSource: Required fields missing: color"}
+    };
+    for (auto& segment : segments) {
+        SegmentColorSourceDeserializer::Result result = deserializeSegment(segment.json, 0);
+        TEST_ASSERT_FALSE(result);
+        TEST_ASSERT_EQUAL_STRING(segment.error, result.error.c_str());
+    }
+}
+
+void test_preset() {
+    const char* json = "{\"name\":\"Green\",\"colorSource\":{\"type\":\"Solid\",\"uid\":9,\"color\":\"#00ff00\"},\"id\":12}";
+    for (size_t split = 0; split <= strlen(json); split++) {
+        PresetDeserializer::Result result = deserializePreset(json, split);
+        TEST_ASSERT_TRUE(result);
+        TEST_ASSERT_EQUAL_UINT8(12, result.id);
+        TEST_ASSERT_EQUAL_STRING("Green", result.name.c_str());
+        TEST_ASSERT_EQUAL_UINT32(9, result.colorSource->uid);
+    }
+
+    // Without a ColorSource the current ColorSource is saved
+    PresetDeserializer::Result current = deserializePreset("{\"id\":1,\"name\":\"Current\",\"colorSource\":null}", 0);
+    TEST_ASSERT_TRUE(current);
+    TEST_ASSERT_NULL(current.colorSource.get());
+
+    struct {
+        const char* json;
+        const char* error;
+    } presets[] = {
+        {"{\"id\":1}", "Required fields missing: id, name"},
+        {"{\"id\":256,\"name\":\"a\"}", "Invalid value for fields: id, name"},
+        {"{\"id\":1,\"name\":[\"a\"]}", "Invalid value for fields: id, name"},
+        {"{\"id\":1,\"name\":\"a\",\"colorSource\":[]}", "Invalid value for fields: colorSource"},
+        {"{\"id\":1,\"name\":\"a\",\"colorSource\":{\"type\":\"Solid\",\"uid\":1}}", "colorSource: Required fields missing: color"}
+    };
+    for (auto& preset : presets) {
+        PresetDeserializer::Result result = deserializePreset(preset.json, 0);
+        TEST_ASSERT_FALSE(result);
+        TEST_ASSERT_EQUAL_STRING(preset.error, result.error.c_str());
+    }
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_parser_tokens);
+    RUN_TEST(test_parser_chunk_boundaries);
+    RUN_TEST(test_parser_top_level_number);
+    RUN_TEST(test_parser_errors);
+    RUN_TEST(test_deserializer_split_anywhere);
+    RUN_TEST(test_deserializer_offset_list);
+    RUN_TEST(test_deserializer_errors);
+    RUN_TEST(test_batch_split_anywhere);
+    RUN_TEST(test_batch_errors);
+    RUN_TEST(test_segment_color_source);
+    RUN_TEST(test_preset);
+    return UNITY_END();
+}
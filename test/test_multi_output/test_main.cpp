@@ -0,0 +1,151 @@
+/**
+ * MultiOutputDriver tests
+ *
+ * Checks that pixels are mapped onto the right outputs, and that outputs are shown so that their
+ * transmissions overlap, using the simulated transmission timing of the NeoPixelBus stand-in
+ */
+#include <unity.h>
+#include <vector>
+#include <LightWeaver.h>
+#include <LightWeaver/drivers/MultiOutputDriver.h>
+#include <LightWeaver/drivers/NeoRGBDriver.h>
+#include <LightWeaver/colorSources/SolidColorSource.h>
+#include <NativeTest.h>
+
+using namespace LightWeaver;
+using NativeTest::CapturingDriver;
+
+#define STRIP_PIXEL_COUNT 300
+#define BIT_BANG_PIN 5
+// 300 RGB pixels at 800Kbps, plus the latch time
+#define STRIP_TRANSMISSION_TIME (STRIP_PIXEL_COUNT * 3 * 10 + 50)
+
+namespace {
+    typedef MultiOutputDriver<
+        DriverOutput<CapturingDriver<0>, 4>,
+        DriverOutput<CapturingDriver<1>, 3>,
+        DriverOutput<CapturingDriver<2>, 5>> RecordingMultiDriver;
+
+    typedef NeoRgbDriver<NeoGrbFeature, NeoEsp8266Dma800KbpsMethod> DmaDriver;
+    typedef NeoRgbDriver<NeoRgbFeature, NeoEsp8266AsyncUart1800KbpsMethod> AsyncUartDriver;
+    typedef NeoRgbDriver<NeoGrbFeature, NeoEsp8266BitBang800KbpsMethod> BitBangDriver;
+
+    // The blocking output is listed first, but must still be shown last
+    typedef MultiOutputDriver<
+        DriverOutput<BitBangDriver, STRIP_PIXEL_COUNT, BIT_BANG_PIN>,
+        DriverOutput<DmaDriver, STRIP_PIXEL_COUNT>,
+        DriverOutput<AsyncUartDriver, STRIP_PIXEL_COUNT>> ThreeStripDriver;
+
+    const LightWeaver::RgbColor RED{255, 0, 0};
+    const LightWeaver::RgbColor BLUE{0, 0, 255};
+
+    // Time taken by repeated shows, once the outputs are sending continuously
+    template <typename T_DRIVER>
+    uint32_t measureShowTime(T_DRIVER& driver, uint16_t frameCount) {
+        driver.loop();
+        uint64_t start = NativeClock::getMicros();
+        for (uint16_t i = 0; i < frameCount; i++) {
+            driver.loop();
+        }
+        return NativeClock::getMicros() - start;
+    }
+}
+
+void setUp() {
+    NativeTest::reset();
+    NeoTransmissionLog::transmissions.clear();
+    NeoTransmissionLog::isRecording = true;
+}
+
+void tearDown() {
+    NeoTransmissionLog::isRecording = false;
+}
+
+void test_pixel_count() {
+    TEST_ASSERT_EQUAL_UINT16(12, RecordingMultiDriver::PixelCount);
+    TEST_ASSERT_EQUAL_UINT16(3 * STRIP_PIXEL_COUNT, ThreeStripDriver::PixelCount);
+}
+
+void test_pixel_mapping() {
+    RecordingMultiDriver driver(RecordingMultiDriver::PixelCount);
+    driver.setColor(RED, 0, 1);
+    driver.setColor(RED, 5, 1);
+    driver.setColor(RED, 11, 1);
+
+    TEST_ASSERT_TRUE(CapturingDriver<0>::pixels[0] == RED);
+    TEST_ASSERT_TRUE(CapturingDriver<1>::pixels[1] == RED);
+    TEST_ASSERT_TRUE(CapturingDriver<2>::pixels[4] == RED);
+    TEST_ASSERT_TRUE(CapturingDriver<1>::pixels[0] == LightWeaver::RgbColor());
+}
+
+void test_range_across_outputs() {
+    RecordingMultiDriver driver(RecordingMultiDriver::PixelCount);
+    driver.setColor(BLUE, 2, 7);
+
+    TEST_ASSERT_TRUE(CapturingDriver<0>::pixels[1] == LightWeaver::RgbColor());
+    TEST_ASSERT_TRUE(CapturingDriver<0>::pixels[2] == BLUE);
+    TEST_ASSERT_TRUE(CapturingDriver<0>::pixels[3] == BLUE);
+    for (uint16_t i = 0; i < 3; i++) {
+        TEST_ASSERT_TRUE(CapturingDriver<1>::pixels[i] == BLUE);
+    }
+    TEST_ASSERT_TRUE(CapturingDriver<2>::pixels[0] == BLUE);
+    TEST_ASSERT_TRUE(CapturingDriver<2>::pixels[1] == BLUE);
+    TEST_ASSERT_TRUE(CapturingDriver<2>::pixels[2] == LightWeaver::RgbColor());
+}
+
+void test_core_fills_every_output() {
+    LightWeaverCoreImpl<RecordingMultiDriver> core(RecordingMultiDriver::PixelCount, 1);
+    core.setRenderBudget(0);
+    core.setup();
+    core.setColorSource(SolidColorSource(1, RgbaColor(255, 0, 0, 255)));
+    for (uint16_t i = 0; i < 50; i++) {
+        NativeClock::advanceMillis(20);
+        core.loop();
+    }
+
+    for (const LightWeaver::RgbColor& color : CapturingDriver<0>::pixels) TEST_ASSERT_TRUE(color == RED);
+    for (const LightWeaver::RgbColor& color : CapturingDriver<1>::pixels) TEST_ASSERT_TRUE(color == RED);
+    for (const LightWeaver::RgbColor& color : CapturingDriver<2>::pixels) TEST_ASSERT_TRUE(color == RED);
+}
+
+void test_transmissions_overlap() {
+    ThreeStripDriver driver(ThreeStripDriver::PixelCount);
+    driver.setup();
+    uint64_t start = NativeClock::getMicros();
+    driver.loop();
+
+    std::vector<NeoTransmission>& transmissions = NeoTransmissionLog::transmissions;
+    TEST_ASSERT_EQUAL(3, transmissions.size());
+    // The outputs sending in the background are started before the blocking output
+    for (const NeoTransmission& transmission : transmissions) {
+        TEST_ASSERT_EQUAL_UINT32(0, transmission.start - start);
+        TEST_ASSERT_EQUAL_UINT32(STRIP_TRANSMISSION_TIME, transmission.end - start);
+    }
+    TEST_ASSERT_EQUAL_UINT32(STRIP_TRANSMISSION_TIME, NativeClock::getMicros() - start);
+}
+
+void test_refresh_rate_matches_single_strip() {
+    const uint16_t frameCount = 20;
+
+    BitBangDriver single(STRIP_PIXEL_COUNT, BIT_BANG_PIN);
+    single.setup();
+    uint32_t singleTime = measureShowTime(single, frameCount);
+
+    ThreeStripDriver multi(ThreeStripDriver::PixelCount);
+    multi.setup();
+    uint32_t multiTime = measureShowTime(multi, frameCount);
+
+    TEST_ASSERT_EQUAL_UINT32(frameCount * STRIP_TRANSMISSION_TIME, singleTime);
+    TEST_ASSERT_EQUAL_UINT32(singleTime, multiTime);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_pixel_count);
+    RUN_TEST(test_pixel_mapping);
+    RUN_TEST(test_range_across_outputs);
+    RUN_TEST(test_core_fills_every_output);
+    RUN_TEST(test_transmissions_overlap);
+    RUN_TEST(test_refresh_rate_matches_single_strip);
+    return UNITY_END();
+}
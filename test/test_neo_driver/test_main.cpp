@@ -0,0 +1,194 @@
+/**
+ * NeoPixelBus driver tests
+ *
+ * Checks that showing a frame never waits for the strip, and that the frame sent is always the last
+ * complete one, using the simulated transmission timing of the NeoPixelBus stand-in. Also checks the
+ * pixels written by NeoDriverSK6812_RGBW, and the white extracted from them
+ */
+#include <unity.h>
+#include <vector>
+#include <LightWeaver.h>
+#include <LightWeaver/drivers/NeoRGBDriver.h>
+#include <LightWeaver/drivers/NeoDriverSK6812.h>
+#include <LightWeaver/colorSources/FadeColorSource.h>
+#include <LittleFS.h>
+
+using namespace LightWeaver;
+
+#define PIXEL_COUNT 600
+// 600 RGB pixels at 800Kbps, plus the latch time
+#define TRANSMISSION_TIME (PIXEL_COUNT * 3 * 10 + 50)
+
+namespace {
+    typedef NeoRgbDriver<NeoRgbFeature, NeoEsp8266Dma800KbpsMethod> DmaDriver;
+    typedef NeoDriverSK6812_RGBW<1> RgbwDriver;
+
+    const LightWeaver::RgbColor RED{255, 0, 0};
+    const LightWeaver::RgbColor GREEN{0, 255, 0};
+    const LightWeaver::RgbColor BLUE{0, 0, 255};
+
+    void assertFirstPixel(const LightWeaver::RgbColor& expected, const NeoTransmission& transmission) {
+        TEST_ASSERT_EQUAL_UINT8(expected.R, transmission.data[0]);
+        TEST_ASSERT_EQUAL_UINT8(expected.G, transmission.data[1]);
+        TEST_ASSERT_EQUAL_UINT8(expected.B, transmission.data[2]);
+    }
+
+    void assertRgbwPixel(const ::RgbwColor& expected, const NeoTransmission& transmission, uint16_t index) {
+        char message[32];
+        snprintf(message, sizeof(message), "Pixel %u", index);
+        const uint8_t* pixel = transmission.data.data() + index * sizeof(::RgbwColor);
+        TEST_ASSERT_EQUAL_UINT8_MESSAGE(expected.R, pixel[0], message);
+        TEST_ASSERT_EQUAL_UINT8_MESSAGE(expected.G, pixel[1], message);
+        TEST_ASSERT_EQUAL_UINT8_MESSAGE(expected.B, pixel[2], message);
+        TEST_ASSERT_EQUAL_UINT8_MESSAGE(expected.W, pixel[3], message);
+    }
+
+    // Shows a single pixel of the color on an RGBW strip, and checks the levels sent
+    template <uint8_t WHITE_EXTRACTION>
+    void assertRgbw(const ::RgbwColor& expected, const LightWeaver::RgbColor& color) {
+        NeoDriverSK6812_RGBW<1, WHITE_EXTRACTION> driver(1);
+        driver.setup();
+        driver.setColor(color, 0, 1);
+        driver.loop();
+        assertRgbwPixel(expected, NeoTransmissionLog::transmissions.back(), 0);
+    }
+}
+
+void setUp() {
+    NativeClock::setMicros(1000000);
+    LittleFS.format();
+    NeoTransmissionLog::transmissions.clear();
+    NeoTransmissionLog::isRecording = true;
+}
+
+void tearDown() {
+    NeoTransmissionLog::isRecording = false;
+}
+
+void test_loop_does_not_wait_for_strip() {
+    DmaDriver driver(PIXEL_COUNT);
+    driver.setup();
+    uint64_t start = NativeClock::getMicros();
+    driver.loop();
+    driver.loop();
+
+    std::vector<NeoTransmission>& transmissions = NeoTransmissionLog::transmissions;
+    TEST_ASSERT_EQUAL_UINT32(0, NativeClock::getMicros() - start);
+    TEST_ASSERT_EQUAL(1, transmissions.size());
+    TEST_ASSERT_TRUE(driver.isShowPending());
+
+    // The waiting frame is sent as soon as the strip is free
+    NativeClock::advanceMicros(TRANSMISSION_TIME - 1);
+    driver.update();
+    TEST_ASSERT_EQUAL(1, transmissions.size());
+    NativeClock::advanceMicros(1);
+    driver.update();
+    TEST_ASSERT_EQUAL(2, transmissions.size());
+    TEST_ASSERT_EQUAL_UINT32(TRANSMISSION_TIME, transmissions[1].start - start);
+    TEST_ASSERT_FALSE(driver.isShowPending());
+}
+
+void test_last_frame_replaces_waiting_frame() {
+    DmaDriver driver(PIXEL_COUNT);
+    driver.setup();
+    driver.setColor(RED);
+    driver.loop();
+    driver.setColor(GREEN);
+    driver.loop();
+    driver.setColor(BLUE);
+    driver.loop();
+
+    NativeClock::advanceMicros(TRANSMISSION_TIME);
+    driver.update();
+    driver.update();
+
+    std::vector<NeoTransmission>& transmissions = NeoTransmissionLog::transmissions;
+    TEST_ASSERT_EQUAL(2, transmissions.size());
+    assertFirstPixel(RED, transmissions[0]);
+    assertFirstPixel(BLUE, transmissions[1]);
+}
+
+void test_partial_frame_is_not_sent() {
+    DmaDriver driver(PIXEL_COUNT);
+    driver.setup();
+    driver.loop();
+    driver.setColor(BLUE);
+    driver.loop();
+    // The next frame is only partly rendered when the strip becomes free
+    driver.setColor(GREEN, 0, 1);
+
+    NativeClock::advanceMicros(TRANSMISSION_TIME);
+    driver.update();
+
+    std::vector<NeoTransmission>& transmissions = NeoTransmissionLog::transmissions;
+    TEST_ASSERT_EQUAL(2, transmissions.size());
+    assertFirstPixel(BLUE, transmissions[1]);
+}
+
+void test_core_renders_while_strip_sends() {
+    LightWeaverCoreImpl<DmaDriver> core(PIXEL_COUNT, 1);
+    core.setRenderBudget(0);
+    core.setup();
+    core.setColorSource(FadeColorSource(1, RgbaColor(255, 0, 0, 255), RgbaColor(0, 0, 255, 255), 1000, true, Easing::Linear));
+
+    uint32_t loopCount = 500;
+    for (uint32_t i = 0; i < loopCount; i++) {
+        NativeClock::advanceMillis(1);
+        uint64_t loopStart = NativeClock::getMicros();
+        core.loop();
+        TEST_ASSERT_EQUAL_UINT32(0, NativeClock::getMicros() - loopStart);
+    }
+
+    // The strip never sends two frames at once, and is never idle for long while frames are waiting
+    std::vector<NeoTransmission>& transmissions = NeoTransmissionLog::transmissions;
+    for (size_t i = 1; i < transmissions.size(); i++) {
+        TEST_ASSERT_TRUE(transmissions[i].start >= transmissions[i - 1].end);
+    }
+    uint32_t frameInterval = std::max<uint32_t>(core.getQualityGovernor().getFrameInterval() * 1000, TRANSMISSION_TIME);
+    TEST_ASSERT_TRUE(transmissions.size() >= loopCount * 1000 / (frameInterval + 1000));
+}
+
+void test_rgbw_indexed_color_writes_only_range() {
+    RgbwDriver driver(PIXEL_COUNT);
+    driver.setup();
+    driver.setColor(RED);
+    driver.setColor(BLUE, 10, 5);
+    driver.setColor(GREEN, 20, 1);
+    driver.setColor(BLUE, PIXEL_COUNT - 3, 3);
+    driver.loop();
+
+    const NeoTransmission& transmission = NeoTransmissionLog::transmissions.back();
+    TEST_ASSERT_EQUAL_UINT32(PIXEL_COUNT * sizeof(::RgbwColor), transmission.data.size());
+    for (uint16_t i = 0; i < PIXEL_COUNT; i++) {
+        if ((i >= 10 && i < 15) || i >= PIXEL_COUNT - 3) {
+            assertRgbwPixel(::RgbwColor(0, 0, 255, 0), transmission, i);
+        } else if (i == 20) {
+            assertRgbwPixel(::RgbwColor(0, 255, 0, 0), transmission, i);
+        } else {
+            assertRgbwPixel(::RgbwColor(255, 0, 0, 0), transmission, i);
+        }
+    }
+}
+
+void test_rgbw_white_extraction() {
+    const LightWeaver::RgbColor color{200, 100, 50};
+    assertRgbw<0>(::RgbwColor(200, 100, 50, 0), color);
+    // 50 * 128 / 255, rounded down
+    assertRgbw<128>(::RgbwColor(175, 75, 25, 25), color);
+    assertRgbw<255>(::RgbwColor(150, 50, 0, 50), color);
+
+    // White is moved to the white LED only
+    assertRgbw<255>(::RgbwColor(0, 0, 0, 255), LightWeaver::RgbColor(255, 255, 255));
+    assertRgbw<128>(::RgbwColor(127, 127, 127, 128), LightWeaver::RgbColor(255, 255, 255));
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_loop_does_not_wait_for_strip);
+    RUN_TEST(test_last_frame_replaces_waiting_frame);
+    RUN_TEST(test_partial_frame_is_not_sent);
+    RUN_TEST(test_core_renders_while_strip_sends);
+    RUN_TEST(test_rgbw_indexed_color_writes_only_range);
+    RUN_TEST(test_rgbw_white_extraction);
+    return UNITY_END();
+}
@@ -0,0 +1,96 @@
+/**
+ * Output LUT tests
+ *
+ * Checks the output levels produced by combining the color calibration with the brightness
+ */
+#include <unity.h>
+#include <math.h>
+#include <LightWeaver.h>
+#include <LightWeaver/OutputLut.h>
+#include <LightWeaver/colorSources/SolidColorSource.h>
+#include <NativeTest.h>
+
+using namespace LightWeaver;
+
+#define PIXEL_COUNT 4
+
+namespace {
+    typedef NativeTest::CapturingDriver<> CapturingDriver;
+
+    void assertColor(const RgbColor& expected, const RgbColor& actual) {
+        TEST_ASSERT_EQUAL_UINT8(expected.R, actual.R);
+        TEST_ASSERT_EQUAL_UINT8(expected.G, actual.G);
+        TEST_ASSERT_EQUAL_UINT8(expected.B, actual.B);
+    }
+}
+
+void setUp() {
+    NativeTest::reset();
+}
+
+void tearDown() {}
+
+void test_default_is_identity() {
+    OutputLut lut;
+    for (uint16_t i = 0; i < 256; i++) {
+        assertColor(RgbColor(i, i, i), lut.apply(RgbColor(i, i, i)));
+    }
+}
+
+void test_brightness() {
+    OutputLut lut;
+    lut.setBrightness(128);
+    assertColor(RgbColor(128, 64, 0), lut.apply(RgbColor(255, 128, 0)));
+    lut.setBrightness(0);
+    assertColor(RgbColor(0, 0, 0), lut.apply(RgbColor(255, 255, 255)));
+}
+
+void test_gamma() {
+    OutputLut lut;
+    ColorCalibration calibration;
+    calibration.gamma = 2.2f;
+    lut.setCalibration(calibration);
+    for (uint16_t i = 0; i < 256; i++) {
+        uint8_t expected = (uint8_t)(powf(i / 255.0f, 2.2f) * 255.0f + 0.5f);
+        TEST_ASSERT_UINT32_WITHIN(1, expected, lut.apply(RgbColor(i, 0, 0)).R);
+    }
+    assertColor(RgbColor(255, 255, 255), lut.apply(RgbColor(255, 255, 255)));
+}
+
+void test_white_balance_and_brightness_combine() {
+    OutputLut lut;
+    ColorCalibration calibration;
+    calibration.whiteBalance = RgbColor(255, 200, 100);
+    lut.setCalibration(calibration);
+    assertColor(RgbColor(255, 200, 100), lut.apply(RgbColor(255, 255, 255)));
+
+    lut.setBrightness(51);
+    assertColor(RgbColor(51, 40, 20), lut.apply(RgbColor(255, 255, 255)));
+}
+
+void test_core_applies_calibration() {
+    LightWeaverCoreImpl<CapturingDriver> core(PIXEL_COUNT, 1, 128);
+    core.setRenderBudget(0);
+    core.setup();
+    core.setColorSource(SolidColorSource(1, RgbaColor(255, 255, 255, 255)));
+    ColorCalibration calibration;
+    calibration.whiteBalance = RgbColor(255, 128, 0);
+    core.setColorCalibration(calibration);
+    for (uint16_t i = 0; i < 50; i++) {
+        NativeClock::advanceMillis(20);
+        core.loop();
+    }
+
+    assertColor(RgbColor(128, 64, 0), CapturingDriver::shownPixels[PIXEL_COUNT - 1]);
+    TEST_ASSERT_TRUE(core.getColorCalibration() == calibration);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_default_is_identity);
+    RUN_TEST(test_brightness);
+    RUN_TEST(test_gamma);
+    RUN_TEST(test_white_balance_and_brightness_combine);
+    RUN_TEST(test_core_applies_calibration);
+    return UNITY_END();
+}
@@ -0,0 +1,173 @@
+/**
+ * Pixel map tests
+ *
+ * Checks that logical pixels are laid out on the physical pixels of the driver as described by the
+ * spans of the map, and that the map is persisted
+ */
+#include <unity.h>
+#include <vector>
+#include <LightWeaver.h>
+#include <LightWeaver/PixelMap.h>
+#include <LightWeaver/colorSources/GradientColorSource.h>
+#include <LightWeaver/colorSources/SolidColorSource.h>
+#include <NativeTest.h>
+
+using namespace LightWeaver;
+
+#define PIXEL_COUNT 6
+#define GROUP_SIZE 2
+#define PHYSICAL_PIXEL_COUNT (PIXEL_COUNT * GROUP_SIZE)
+
+namespace {
+    typedef NativeTest::CapturingDriver<> CapturingDriver;
+
+    typedef LightWeaverCoreImpl<CapturingDriver> Core;
+
+    // Logical pixel i is shown with a red value of 10 * (i + 1), so that unset pixels stay at 0
+    RgbColor LOGICAL_COLORS[PIXEL_COUNT];
+
+    void applyMap(const PixelMap& pixelMap) {
+        CapturingDriver driver(PHYSICAL_PIXEL_COUNT);
+        pixelMap.apply(driver, PIXEL_COUNT, [](uint16_t pixel) { return LOGICAL_COLORS[pixel]; });
+    }
+
+    void assertPhysicalPixels(const uint8_t* expected) {
+        for (uint16_t i = 0; i < PHYSICAL_PIXEL_COUNT; i++) {
+            TEST_ASSERT_EQUAL_UINT8(expected[i], CapturingDriver::pixels[i].R);
+        }
+    }
+
+    void renderFrames(Core& core, uint16_t frameCount) {
+        for (uint16_t i = 0; i < frameCount; i++) {
+            NativeClock::advanceMillis(20);
+            core.loop();
+        }
+    }
+}
+
+void setUp() {
+    NativeTest::reset();
+    for (uint16_t i = 0; i < PIXEL_COUNT; i++) {
+        LOGICAL_COLORS[i] = RgbColor(10 * (i + 1), 0, 0);
+    }
+}
+
+void tearDown() {}
+
+void test_group_size() {
+    applyMap(PixelMap::withGroupSize(PIXEL_COUNT, GROUP_SIZE));
+    const uint8_t expected[] = {10, 10, 20, 20, 30, 30, 40, 40, 50, 50, 60, 60};
+    assertPhysicalPixels(expected);
+}
+
+void test_serpentine() {
+    PixelSpan spans[] = {{3, 0, 1, false}, {3, 3, 1, true}};
+    applyMap(PixelMap::withSpans(2, spans));
+    const uint8_t expected[] = {10, 20, 30, 60, 50, 40, 0, 0, 0, 0, 0, 0};
+    assertPhysicalPixels(expected);
+}
+
+void test_dead_pixels_and_uneven_groups() {
+    // Physical pixel 2 is skipped, and the second span shows each pixel on three physical pixels
+    PixelSpan spans[] = {{2, 0, 1, false}, {2, 3, 3, true}, {2, 9, 1, false}};
+    applyMap(PixelMap::withSpans(3, spans));
+    const uint8_t expected[] = {10, 20, 0, 40, 40, 40, 30, 30, 30, 50, 60, 0};
+    assertPhysicalPixels(expected);
+}
+
+void test_fits() {
+    PixelSpan pastEnd[] = {{PIXEL_COUNT, 1, GROUP_SIZE, false}};
+    PixelSpan tooLong[] = {{PIXEL_COUNT, 0, 1, false}, {1, PIXEL_COUNT, 1, false}};
+    PixelSpan empty[] = {{0, 0, 1, false}};
+    TEST_ASSERT_TRUE(PixelMap::withGroupSize(PIXEL_COUNT, GROUP_SIZE).fits(PIXEL_COUNT, PHYSICAL_PIXEL_COUNT));
+    TEST_ASSERT_FALSE(PixelMap::withSpans(1, pastEnd).fits(PIXEL_COUNT, PHYSICAL_PIXEL_COUNT));
+    TEST_ASSERT_FALSE(PixelMap::withSpans(2, tooLong).fits(PIXEL_COUNT, PHYSICAL_PIXEL_COUNT));
+    TEST_ASSERT_FALSE(PixelMap::withSpans(1, empty).fits(PIXEL_COUNT, PHYSICAL_PIXEL_COUNT));
+    TEST_ASSERT_FALSE(PixelMap::withSpans(0, nullptr).fits(PIXEL_COUNT, PHYSICAL_PIXEL_COUNT));
+}
+
+void test_core_clears_unmapped_pixels() {
+    Core core(PIXEL_COUNT, GROUP_SIZE);
+    core.setRenderBudget(0);
+    core.setup();
+    core.setColorSource(SolidColorSource(1, RgbaColor(255, 0, 0, 255)));
+    renderFrames(core, 50);
+    TEST_ASSERT_TRUE(CapturingDriver::pixels[PHYSICAL_PIXEL_COUNT - 1].R == 255);
+
+    PixelSpan spans[] = {{PIXEL_COUNT, 0, 1, true}};
+    TEST_ASSERT_TRUE(core.setPixelMap(PixelMap::withSpans(1, spans)));
+    renderFrames(core, 1);
+    for (uint16_t i = 0; i < PHYSICAL_PIXEL_COUNT; i++) {
+        TEST_ASSERT_EQUAL_UINT8(i < PIXEL_COUNT ? 255 : 0, CapturingDriver::pixels[i].R);
+    }
+
+    PixelSpan pastEnd[] = {{PIXEL_COUNT, PHYSICAL_PIXEL_COUNT, 1, false}};
+    TEST_ASSERT_FALSE(core.setPixelMap(PixelMap::withSpans(1, pastEnd)));
+    TEST_ASSERT_TRUE(core.getPixelMap() == PixelMap::withSpans(1, spans));
+}
+
+void test_core_reverses_gradient() {
+    RgbaColor colors[] = {RgbaColor(0, 0, 0, 255), RgbaColor(250, 0, 0, 255)};
+    GradientColorSource gradient(1, Gradient(ColorSet(2, colors)), 1, false, Easing::Linear, PixelOffsetConfig::withScale(1.0));
+
+    Core core(PIXEL_COUNT, 1);
+    core.setRenderBudget(0);
+    core.setup();
+    core.setColorSource(gradient);
+    renderFrames(core, 50);
+    std::vector<LightWeaver::RgbColor> forward = CapturingDriver::pixels;
+
+    PixelSpan spans[] = {{PIXEL_COUNT, 0, 1, true}};
+    core.setPixelMap(PixelMap::withSpans(1, spans));
+    renderFrames(core, 1);
+    for (uint16_t i = 0; i < PIXEL_COUNT; i++) {
+        TEST_ASSERT_EQUAL_UINT8(forward[PIXEL_COUNT - 1 - i].R, CapturingDriver::pixels[i].R);
+    }
+}
+
+void test_map_is_persisted() {
+    PixelSpan spans[] = {{3, 0, 1, false}, {3, 3, 1, true}};
+    PixelMap serpentine = PixelMap::withSpans(2, spans);
+    {
+        Core core(PIXEL_COUNT, GROUP_SIZE);
+        core.setup();
+        core.setPixelMap(serpentine);
+    }
+    {
+        Core core(PIXEL_COUNT, GROUP_SIZE);
+        core.setup();
+        TEST_ASSERT_TRUE(core.getPixelMap() == serpentine);
+        core.resetPixelMap();
+        TEST_ASSERT_TRUE(core.getPixelMap() == PixelMap::withGroupSize(PIXEL_COUNT, GROUP_SIZE));
+    }
+    {
+        Core core(PIXEL_COUNT, GROUP_SIZE);
+        core.setup();
+        TEST_ASSERT_TRUE(core.getPixelMap() == PixelMap::withGroupSize(PIXEL_COUNT, GROUP_SIZE));
+    }
+}
+
+void test_map_not_fitting_strip_is_not_restored() {
+    PixelSpan spans[] = {{PIXEL_COUNT, 0, GROUP_SIZE, true}};
+    {
+        Core core(PIXEL_COUNT, GROUP_SIZE);
+        core.setup();
+        core.setPixelMap(PixelMap::withSpans(1, spans));
+    }
+    Core core(PIXEL_COUNT, 1);
+    core.setup();
+    TEST_ASSERT_TRUE(core.getPixelMap() == PixelMap::withGroupSize(PIXEL_COUNT, 1));
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_group_size);
+    RUN_TEST(test_serpentine);
+    RUN_TEST(test_dead_pixels_and_uneven_groups);
+    RUN_TEST(test_fits);
+    RUN_TEST(test_core_clears_unmapped_pixels);
+    RUN_TEST(test_core_reverses_gradient);
+    RUN_TEST(test_map_is_persisted);
+    RUN_TEST(test_map_not_fitting_strip_is_not_restored);
+    return UNITY_END();
+}
@@ -0,0 +1,174 @@
+/**
+ * Quality governor tests
+ *
+ * Checks when the render quality is lowered and raised, and that the core only reports the
+ * time spent rendering a frame to the governor
+ */
+#include <unity.h>
+#include <LightWeaver.h>
+#include <LightWeaver/QualityGovernor.h>
+#include <LightWeaver/colorSources/SolidColorSource.h>
+#include <NativeTest.h>
+
+using namespace LightWeaver;
+
+#define PIXEL_COUNT 100
+
+namespace {
+    const uint32_t OVERRUN = QualityGovernor::TARGET_FRAME_TIME + 1;
+
+    // Takes a fixed time to evaluate each pixel, so that frames are rendered over several slices
+    class SlowColorSource : public SolidColorSource {
+        public:
+            static const uint32_t PIXEL_TIME = 100;
+
+            SlowColorSource(uint32_t uid): SolidColorSource(uid, RgbaColor(255, 255, 255, 255)) {}
+
+            virtual RgbaColor getColor() const {
+                NativeClock::advanceMicros(PIXEL_TIME);
+                return SolidColorSource::getColor();
+            }
+
+            virtual uint16_t getControlPointCount(uint16_t count) const {
+                return count;
+            }
+
+            virtual ColorSource* clone() const {
+                return new SlowColorSource(uid);
+            }
+    };
+
+    void stepDown(QualityGovernor& governor) {
+        for (uint8_t i = 0; i < QualityGovernor::OVERRUN_FRAMES; i++) {
+            governor.onFrameRendered(QualityGovernor::getTargetFrameTime(governor.getLevel()) + 1);
+        }
+    }
+
+    // Renders frames taking frameTime for duration milliseconds, one frame every 20ms
+    void renderFor(QualityGovernor& governor, uint32_t frameTime, uint32_t duration) {
+        for (uint32_t elapsed = 0; elapsed < duration; elapsed += 20) {
+            NativeClock::advanceMillis(20);
+            governor.onFrameRendered(frameTime);
+        }
+    }
+}
+
+void setUp() {
+    NativeTest::reset();
+}
+
+void tearDown() {}
+
+void test_steps_down_after_overrun_frames() {
+    QualityGovernor governor;
+    for (uint8_t i = 0; i < QualityGovernor::OVERRUN_FRAMES - 1; i++) {
+        governor.onFrameRendered(OVERRUN);
+    }
+    TEST_ASSERT_EQUAL(QualityLevel::Full, governor.getLevel());
+
+    governor.onFrameRendered(OVERRUN);
+    TEST_ASSERT_EQUAL(QualityLevel::ReducedFrameRate, governor.getLevel());
+    TEST_ASSERT_EQUAL_UINT32(OVERRUN, governor.getLastFrameTime());
+}
+
+void test_frame_within_target_resets_overruns() {
+    QualityGovernor governor;
+    for (uint8_t i = 0; i < QualityGovernor::OVERRUN_FRAMES - 1; i++) {
+        governor.onFrameRendered(OVERRUN);
+    }
+    governor.onFrameRendered(QualityGovernor::TARGET_FRAME_TIME);
+    for (uint8_t i = 0; i < QualityGovernor::OVERRUN_FRAMES - 1; i++) {
+        governor.onFrameRendered(OVERRUN);
+    }
+    TEST_ASSERT_EQUAL(QualityLevel::Full, governor.getLevel());
+}
+
+void test_recovery_hysteresis() {
+    QualityGovernor governor;
+    stepDown(governor);
+    TEST_ASSERT_EQUAL(QualityLevel::ReducedFrameRate, governor.getLevel());
+
+    // Fast enough for Full, but not below 3/4 of its target
+    uint32_t recoveryLimit = QualityGovernor::TARGET_FRAME_TIME / 4 * 3;
+    renderFor(governor, recoveryLimit, 2 * QualityGovernor::RECOVERY_INTERVAL);
+    TEST_ASSERT_EQUAL(QualityLevel::ReducedFrameRate, governor.getLevel());
+
+    renderFor(governor, recoveryLimit - 1, QualityGovernor::RECOVERY_INTERVAL + 20);
+    TEST_ASSERT_EQUAL(QualityLevel::Full, governor.getLevel());
+}
+
+void test_recovery_interval() {
+    QualityGovernor governor;
+    stepDown(governor);
+    uint32_t frameTime = QualityGovernor::TARGET_FRAME_TIME / 2;
+
+    governor.onFrameRendered(frameTime);
+    NativeClock::advanceMillis(QualityGovernor::RECOVERY_INTERVAL - 1);
+    governor.onFrameRendered(frameTime);
+    TEST_ASSERT_EQUAL(QualityLevel::ReducedFrameRate, governor.getLevel());
+
+    NativeClock::advanceMillis(1);
+    governor.onFrameRendered(frameTime);
+    TEST_ASSERT_EQUAL(QualityLevel::Full, governor.getLevel());
+}
+
+void test_slow_frame_restarts_recovery() {
+    QualityGovernor governor;
+    stepDown(governor);
+    uint32_t frameTime = QualityGovernor::TARGET_FRAME_TIME / 2;
+
+    governor.onFrameRendered(frameTime);
+    NativeClock::advanceMillis(QualityGovernor::RECOVERY_INTERVAL - 1);
+    governor.onFrameRendered(QualityGovernor::TARGET_FRAME_TIME);
+    NativeClock::advanceMillis(1);
+    governor.onFrameRendered(frameTime);
+    TEST_ASSERT_EQUAL(QualityLevel::ReducedFrameRate, governor.getLevel());
+
+    NativeClock::advanceMillis(QualityGovernor::RECOVERY_INTERVAL);
+    governor.onFrameRendered(frameTime);
+    TEST_ASSERT_EQUAL(QualityLevel::Full, governor.getLevel());
+}
+
+void test_static_is_lowest() {
+    QualityGovernor governor;
+    stepDown(governor);
+    stepDown(governor);
+    TEST_ASSERT_EQUAL(QualityLevel::Interpolated, governor.getLevel());
+    stepDown(governor);
+    TEST_ASSERT_EQUAL(QualityLevel::Static, governor.getLevel());
+
+    for (uint8_t i = 0; i < 4 * QualityGovernor::OVERRUN_FRAMES; i++) {
+        governor.onFrameRendered(UINT32_MAX);
+    }
+    TEST_ASSERT_EQUAL(QualityLevel::Static, governor.getLevel());
+    TEST_ASSERT_EQUAL_UINT8(QualityGovernor::INTERPOLATION_STRIDE, governor.getPixelStride());
+}
+
+void test_core_ignores_time_between_slices() {
+    LightWeaverCoreImpl<NativeTest::CapturingDriver<>> core(PIXEL_COUNT, 1, 255);
+    core.setRenderBudget(1000);
+    core.setup();
+    core.setColorSource(SlowColorSource(1));
+
+    // Each slice renders about 10 pixels, with 10ms of network and plugin work between slices
+    for (uint16_t i = 0; i < 200; i++) {
+        NativeClock::advanceMillis(10);
+        core.loop();
+    }
+
+    const QualityGovernor& governor = core.getQualityGovernor();
+    TEST_ASSERT_EQUAL(QualityLevel::Full, governor.getLevel());
+    TEST_ASSERT_UINT32_WITHIN(SlowColorSource::PIXEL_TIME, PIXEL_COUNT * SlowColorSource::PIXEL_TIME, governor.getLastFrameTime());
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_steps_down_after_overrun_frames);
+    RUN_TEST(test_frame_within_target_resets_overruns);
+    RUN_TEST(test_recovery_hysteresis);
+    RUN_TEST(test_recovery_interval);
+    RUN_TEST(test_slow_frame_restarts_recovery);
+    RUN_TEST(test_static_is_lowest);
+    RUN_TEST(test_core_ignores_time_between_slices);
+    return UNITY_END();
+}
@@ -0,0 +1,190 @@
+/**
+ * Render slice tests
+ *
+ * Checks that frames rendered over several loop() calls are shown even while the scene keeps
+ * changing, and that scene changes made during a frame are shown from the next frame
+ */
+#include <unity.h>
+#include <LightWeaver.h>
+#include <LightWeaver/colorSources/SolidColorSource.h>
+#include <NativeTest.h>
+
+using namespace LightWeaver;
+
+#define PIXEL_COUNT 100
+// Each slice renders about 10 pixels
+#define RENDER_BUDGET 1000
+
+namespace {
+    typedef NativeTest::CapturingDriver<> CapturingDriver;
+
+    const RgbaColor RED{255, 0, 0, 255};
+    const RgbaColor GREEN{0, 255, 0, 255};
+
+    // Takes a fixed time to evaluate each pixel, so that frames are rendered over several slices
+    class SlowColorSource : public SolidColorSource {
+        public:
+            static const uint32_t PIXEL_TIME = 100;
+
+            SlowColorSource(uint32_t uid, RgbaColor color): SolidColorSource(uid, color) {}
+
+            virtual RgbaColor getColor() const {
+                NativeClock::advanceMicros(PIXEL_TIME);
+                return SolidColorSource::getColor();
+            }
+
+            virtual uint16_t getControlPointCount(uint16_t count) const {
+                return count;
+            }
+
+            virtual ColorSource* clone() const {
+                return new SlowColorSource(uid, SolidColorSource::getColor());
+            }
+    };
+
+    typedef LightWeaverCoreImpl<CapturingDriver> Core;
+
+    void startCore(Core& core, const ColorSource& colorSource) {
+        core.setRenderBudget(0);
+        core.setup();
+        core.setColorSource(colorSource);
+        // Lets the transition from the empty strip finish before frames are sliced
+        for (uint16_t i = 0; i < 50; i++) {
+            NativeClock::advanceMillis(20);
+            core.loop();
+        }
+        core.setRenderBudget(RENDER_BUDGET);
+        CapturingDriver::frameCount = 0;
+    }
+
+    void assertColor(const RgbaColor& expected, const LightWeaver::RgbColor& actual) {
+        TEST_ASSERT_EQUAL_UINT8(expected.R, actual.R);
+        TEST_ASSERT_EQUAL_UINT8(expected.G, actual.G);
+        TEST_ASSERT_EQUAL_UINT8(expected.B, actual.B);
+    }
+}
+
+void setUp() {
+    NativeTest::reset();
+}
+
+void tearDown() {}
+
+void test_frames_are_shown_while_brightness_changes() {
+    Core core(PIXEL_COUNT, 1);
+    startCore(core, SlowColorSource(1, RED));
+
+    // A brightness request between every slice, as when a slider is dragged
+    for (uint16_t i = 0; i < 200; i++) {
+        core.setBrightness(128 + i % 2);
+        NativeClock::advanceMillis(1);
+        core.loop();
+    }
+    TEST_ASSERT_TRUE(CapturingDriver::frameCount >= 200 / (PIXEL_COUNT * SlowColorSource::PIXEL_TIME / RENDER_BUDGET + 1));
+}
+
+void test_color_source_waits_for_next_frame() {
+    Core core(PIXEL_COUNT, 1);
+    startCore(core, SlowColorSource(1, RED));
+
+    NativeClock::advanceMillis(1);
+    core.loop();
+    TEST_ASSERT_EQUAL_UINT32(0, CapturingDriver::frameCount);
+
+    core.setColorSource(SolidColorSource(2, GREEN));
+    TEST_ASSERT_EQUAL_UINT32(1, core.getColorSource()->uid);
+    while (CapturingDriver::frameCount == 0) {
+        NativeClock::advanceMillis(1);
+        core.loop();
+    }
+    // The frame in progress is finished with the ColorSource it was started with
+    assertColor(RED, CapturingDriver::shownPixels[0]);
+    assertColor(RED, CapturingDriver::shownPixels[PIXEL_COUNT - 1]);
+
+    for (uint16_t i = 0; i < 50; i++) {
+        NativeClock::advanceMillis(20);
+        core.loop();
+    }
+    TEST_ASSERT_EQUAL_UINT32(2, core.getColorSource()->uid);
+    assertColor(GREEN, CapturingDriver::shownPixels[0]);
+    assertColor(GREEN, CapturingDriver::shownPixels[PIXEL_COUNT - 1]);
+}
+
+void test_latest_color_source_is_shown() {
+    Core core(PIXEL_COUNT, 1);
+    startCore(core, SlowColorSource(1, RED));
+
+    NativeClock::advanceMillis(1);
+    core.loop();
+    core.setColorSource(SolidColorSource(2, GREEN));
+    while (CapturingDriver::frameCount == 0) {
+        NativeClock::advanceMillis(1);
+        core.loop();
+    }
+    // Set between frames, but after the ColorSource still waiting from the last frame
+    core.clearColorSource();
+    for (uint16_t i = 0; i < 50; i++) {
+        NativeClock::advanceMillis(20);
+        core.loop();
+    }
+    TEST_ASSERT_NULL(core.getColorSource());
+}
+
+void test_patch_waiting_color_source() {
+    Core core(PIXEL_COUNT, 1);
+    startCore(core, SlowColorSource(1, RED));
+
+    NativeClock::advanceMillis(1);
+    core.loop();
+    core.setColorSource(SolidColorSource(2, RED));
+    TEST_ASSERT_TRUE(core.patchColorSource(SolidColorSource(2, GREEN)));
+    for (uint16_t i = 0; i < 50; i++) {
+        NativeClock::advanceMillis(20);
+        core.loop();
+    }
+    assertColor(GREEN, CapturingDriver::shownPixels[0]);
+}
+
+void test_segment_color_source_waits_for_next_frame() {
+    Core core(PIXEL_COUNT, 1);
+    startCore(core, SlowColorSource(1, RED));
+    TEST_ASSERT_TRUE(core.setSegment(1, 0, 10));
+    TEST_ASSERT_TRUE(core.setSegmentColorSource(1, SlowColorSource(2, RED)));
+
+    NativeClock::advanceMillis(1);
+    core.loop();
+    while (CapturingDriver::frameCount == 0) {
+        NativeClock::advanceMillis(1);
+        core.loop();
+    }
+    CapturingDriver::frameCount = 0;
+    NativeClock::advanceMillis(1);
+    core.loop();
+    TEST_ASSERT_EQUAL_UINT32(0, CapturingDriver::frameCount);
+
+    TEST_ASSERT_TRUE(core.setSegmentColorSource(1, SolidColorSource(3, GREEN)));
+    TEST_ASSERT_EQUAL_UINT32(2, core.getSegment(0).colorSource->uid);
+    while (CapturingDriver::frameCount == 0) {
+        NativeClock::advanceMillis(1);
+        core.loop();
+    }
+    assertColor(RED, CapturingDriver::shownPixels[0]);
+
+    for (uint16_t i = 0; i < 50; i++) {
+        NativeClock::advanceMillis(20);
+        core.loop();
+    }
+    TEST_ASSERT_EQUAL_UINT32(3, core.getSegment(0).colorSource->uid);
+    assertColor(GREEN, CapturingDriver::shownPixels[0]);
+    assertColor(RED, CapturingDriver::shownPixels[PIXEL_COUNT - 1]);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_frames_are_shown_while_brightness_changes);
+    RUN_TEST(test_color_source_waits_for_next_frame);
+    RUN_TEST(test_latest_color_source_is_shown);
+    RUN_TEST(test_patch_waiting_color_source);
+    RUN_TEST(test_segment_color_source_waits_for_next_frame);
+    return UNITY_END();
+}
@@ -0,0 +1,176 @@
+/**
+ * Segment tests
+ *
+ * Checks that segments show their own ColorSource and brightness on their range of pixels, and that
+ * the background is unchanged around them
+ */
+#include <unity.h>
+#include <vector>
+#include <LightWeaver.h>
+#include <LightWeaver/colorSources/GradientColorSource.h>
+#include <LightWeaver/colorSources/SolidColorSource.h>
+#include <NativeTest.h>
+
+using namespace LightWeaver;
+
+#define PIXEL_COUNT 12
+
+namespace {
+    typedef NativeTest::CapturingDriver<> CapturingDriver;
+
+    typedef LightWeaverCoreImpl<CapturingDriver> Core;
+
+    const RgbaColor RED{255, 0, 0, 255};
+    const RgbaColor BLUE{0, 0, 255, 255};
+
+    // Brightens from 0 at the first pixel to 110 at the last pixel of the pixels it is shown on
+    GradientColorSource getGradient(uint32_t uid) {
+        RgbaColor colors[] = {RgbaColor(0, 0, 0, 255), RgbaColor(220, 0, 0, 255)};
+        return GradientColorSource(uid, Gradient(ColorSet(2, colors)), 1, false, Easing::Linear, PixelOffsetConfig::withScale(0.5));
+    }
+
+    // Renders until every transition is complete
+    void renderFrames(Core& core) {
+        for (uint16_t i = 0; i < 50; i++) {
+            NativeClock::advanceMillis(20);
+            core.loop();
+        }
+    }
+
+    void assertPixels(uint16_t start, uint16_t end, const RgbColor& expected) {
+        for (uint16_t i = start; i < end; i++) {
+            TEST_ASSERT_EQUAL_UINT8(expected.R, CapturingDriver::pixels[i].R);
+            TEST_ASSERT_EQUAL_UINT8(expected.G, CapturingDriver::pixels[i].G);
+            TEST_ASSERT_EQUAL_UINT8(expected.B, CapturingDriver::pixels[i].B);
+        }
+    }
+}
+
+void setUp() {
+    NativeTest::reset();
+}
+
+void tearDown() {}
+
+void test_segments_show_their_color_source() {
+    Core core(PIXEL_COUNT, 1);
+    core.setRenderBudget(0);
+    core.setup();
+    core.setColorSource(SolidColorSource(1, RED));
+    TEST_ASSERT_TRUE(core.setSegment(1, 2, 3));
+    TEST_ASSERT_TRUE(core.setSegment(2, 8, 4));
+    TEST_ASSERT_TRUE(core.setSegmentColorSource(1, std::unique_ptr<ColorSource>{new SolidColorSource(2, BLUE)}));
+    renderFrames(core);
+
+    assertPixels(0, 2, RgbColor(255, 0, 0));
+    assertPixels(2, 5, RgbColor(0, 0, 255));
+    assertPixels(5, 8, RgbColor(255, 0, 0));
+    // A segment without a ColorSource is off
+    assertPixels(8, PIXEL_COUNT, RgbColor(0, 0, 0));
+
+    TEST_ASSERT_TRUE(core.clearSegmentColorSource(1));
+    TEST_ASSERT_TRUE(core.removeSegment(2));
+    renderFrames(core);
+    assertPixels(2, 5, RgbColor(0, 0, 0));
+    assertPixels(5, PIXEL_COUNT, RgbColor(255, 0, 0));
+}
+
+void test_segment_brightness() {
+    Core core(PIXEL_COUNT, 1, 128);
+    core.setRenderBudget(0);
+    core.setup();
+    core.setColorSource(SolidColorSource(1, RED));
+    core.setSegment(1, 0, 4);
+    core.setSegmentColorSource(1, SolidColorSource(2, RED));
+    TEST_ASSERT_TRUE(core.setSegmentBrightness(1, 51));
+    renderFrames(core);
+
+    // The segment's brightness is combined with the brightness of the whole strip
+    assertPixels(0, 4, RgbColor(26, 0, 0));
+    assertPixels(4, PIXEL_COUNT, RgbColor(128, 0, 0));
+    TEST_ASSERT_EQUAL_UINT8(51, core.getSegment(0).brightness);
+}
+
+void test_background_continues_around_segments() {
+    Core core(PIXEL_COUNT, 1);
+    core.setRenderBudget(0);
+    core.setup();
+    core.setColorSource(getGradient(1));
+    renderFrames(core);
+    std::vector<LightWeaver::RgbColor> withoutSegments = CapturingDriver::pixels;
+
+    core.setSegment(1, 3, 4);
+    core.setSegmentColorSource(1, SolidColorSource(2, BLUE));
+    renderFrames(core);
+    for (uint16_t i = 0; i < PIXEL_COUNT; i++) {
+        if (i >= 3 && i < 7) continue;
+        TEST_ASSERT_UINT32_WITHIN(1, withoutSegments[i].R, CapturingDriver::pixels[i].R);
+    }
+}
+
+void test_segment_color_source_spans_the_segment() {
+    Core core(PIXEL_COUNT, 1);
+    core.setRenderBudget(0);
+    core.setup();
+    core.setSegment(1, 4, 6);
+    core.setSegmentColorSource(1, getGradient(1));
+    renderFrames(core);
+
+    TEST_ASSERT_EQUAL_UINT8(0, CapturingDriver::pixels[4].R);
+    TEST_ASSERT_EQUAL_UINT8(110, CapturingDriver::pixels[9].R);
+    for (uint16_t i = 5; i < 10; i++) {
+        TEST_ASSERT_TRUE(CapturingDriver::pixels[i].R > CapturingDriver::pixels[i - 1].R);
+    }
+}
+
+void test_segment_ranges() {
+    Core core(PIXEL_COUNT, 1);
+    core.setup();
+    TEST_ASSERT_TRUE(core.setSegment(1, 6, 2));
+    TEST_ASSERT_TRUE(core.setSegment(2, 0, 6));
+    TEST_ASSERT_FALSE(core.setSegment(3, 7, 2));
+    TEST_ASSERT_FALSE(core.setSegment(3, 10, 3));
+    TEST_ASSERT_FALSE(core.setSegment(3, 8, 0));
+    // A segment can be moved over the pixels it already covers
+    TEST_ASSERT_TRUE(core.setSegment(1, 7, 5));
+
+    TEST_ASSERT_EQUAL_UINT8(2, core.getSegmentCount());
+    TEST_ASSERT_EQUAL_UINT8(2, core.getSegment(0).id);
+    TEST_ASSERT_EQUAL_UINT8(1, core.getSegment(1).id);
+    TEST_ASSERT_EQUAL_UINT16(7, core.getSegment(1).start);
+    TEST_ASSERT_EQUAL_UINT16(5, core.getSegment(1).length);
+    TEST_ASSERT_TRUE(core.getSegment(1).isValid());
+    TEST_ASSERT_FALSE(core.getSegment(2).isValid());
+
+    TEST_ASSERT_FALSE(core.removeSegment(3));
+    TEST_ASSERT_FALSE(core.setSegmentBrightness(3, 0));
+    TEST_ASSERT_FALSE(core.setSegmentColorSource(3, SolidColorSource(1, RED)));
+    TEST_ASSERT_FALSE(core.setSegmentColorSource(3, std::unique_ptr<ColorSource>{new SolidColorSource(1, RED)}));
+}
+
+void test_every_segment_in_use() {
+    Core core(LIGHTWEAVER_MAXIMUM_SEGMENTS + 1, 1);
+    core.setRenderBudget(0);
+    core.setup();
+    core.setColorSource(SolidColorSource(1, RED));
+    for (uint8_t i = 0; i < LIGHTWEAVER_MAXIMUM_SEGMENTS; i++) {
+        TEST_ASSERT_TRUE(core.setSegment(i, i, 1));
+        TEST_ASSERT_TRUE(core.setSegmentColorSource(i, SolidColorSource(i + 2, BLUE)));
+    }
+    TEST_ASSERT_FALSE(core.setSegment(LIGHTWEAVER_MAXIMUM_SEGMENTS, LIGHTWEAVER_MAXIMUM_SEGMENTS, 1));
+    renderFrames(core);
+
+    assertPixels(0, LIGHTWEAVER_MAXIMUM_SEGMENTS, RgbColor(0, 0, 255));
+    assertPixels(LIGHTWEAVER_MAXIMUM_SEGMENTS, LIGHTWEAVER_MAXIMUM_SEGMENTS + 1, RgbColor(255, 0, 0));
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_segments_show_their_color_source);
+    RUN_TEST(test_segment_brightness);
+    RUN_TEST(test_background_continues_around_segments);
+    RUN_TEST(test_segment_color_source_spans_the_segment);
+    RUN_TEST(test_segment_ranges);
+    RUN_TEST(test_every_segment_in_use);
+    return UNITY_END();
+}
@@ -0,0 +1,150 @@
+#!/usr/bin/env python3
+"""
+Converts a LightWeaver trace dump into the Chrome trace format
+
+Download the trace from a device and open the output in chrome://tracing or https://ui.perfetto.dev
+    curl -o trace.bin http://esp-lightweaver.local/lightWeaver/trace
+    python3 tools/trace2chrome.py trace.bin > trace.json
+
+The dump format is defined by LightWeaver::Trace in lib/lightweaver-core/LightWeaver/util/Trace.h
+"""
+import argparse
+import json
+import struct
+import sys
+
+MAGIC = 0x3154574C  # "LWT1"
+HEADER = struct.Struct("<IIIII")
+RECORD = struct.Struct("<IBBH")
+
+# TraceEvent values, with the thread each event is shown on
+EVENTS = {
+    0: ("Frame", "Render"),
+    1: ("Render", "Render"),
+    2: ("Show", "Render"),
+    3: ("AnimationStarted", "Animation"),
+    4: ("AnimationStopped", "Animation"),
+    5: ("HttpCommand", "Network"),
+    6: ("WifiConnected", "Network"),
+    7: ("WifiDisconnected", "Network"),
+    8: ("WifiIPChanged", "Network"),
+}
+THREADS = ["Render", "Animation", "Network"]
+PHASES = {0: "i", 1: "B", 2: "E"}
+
+# LightWeaverHttpServer::Command values
+COMMANDS = {
+    0: "setColorSource",
+    1: "patchColorSource",
+    2: "clearColorSource",
+    3: "setBrightness",
+    4: "batch",
+    5: "presets/save",
+    6: "presets/recall",
+    7: "presets/remove",
+    8: "setPixelMap",
+    9: "setCalibration",
+    10: "segments/set",
+    11: "segments/remove",
+    12: "segments/setColorSource",
+    13: "segments/clearColorSource",
+    14: "segments/setBrightness",
+}
+
+
+def read_trace(data):
+    if len(data) < HEADER.size:
+        raise ValueError("Trace is too short")
+    magic, frequency, timestamp, record_count, dropped_count = HEADER.unpack_from(data)
+    if magic != MAGIC:
+        raise ValueError("Not a LightWeaver trace")
+    if len(data) < HEADER.size + record_count * RECORD.size:
+        raise ValueError("Trace is truncated")
+
+    records = [RECORD.unpack_from(data, HEADER.size + i * RECORD.size) for i in range(record_count)]
+    return frequency, timestamp, dropped_count, records
+
+
+def unwrap_timestamps(records, dump_timestamp):
+    """
+    Returns the time of each record in ticks before the dump was taken
+
+    The cycle counter wraps every few seconds, so times are accumulated backwards from the dump,
+    assuming no two consecutive records are more than one wrap apart
+    """
+    times = []
+    later = dump_timestamp
+    elapsed = 0
+    for record in reversed(records):
+        elapsed += (later - record[0]) & 0xFFFFFFFF
+        later = record[0]
+        times.append(-elapsed)
+    times.reverse()
+    return times
+
+
+def convert(data):
+    frequency, dump_timestamp, dropped_count, records = read_trace(data)
+    times = unwrap_timestamps(records, dump_timestamp)
+    start = times[0] if times else 0
+
+    events = []
+    for tid, name in enumerate(THREADS):
+        events.append({"name": "thread_name", "ph": "M", "pid": 0, "tid": tid, "args": {"name": name}})
+
+    # Spans that began before the oldest record only have their end in the trace, and are dropped
+    open_spans = {}
+    for (timestamp, event, phase, arg), time in zip(records, times):
+        if phase == 1:
+            open_spans[event] = open_spans.get(event, 0) + 1
+        elif phase == 2:
+            if not open_spans.get(event):
+                continue
+            open_spans[event] -= 1
+
+        name, thread = EVENTS.get(event, ("Unknown(%d)" % event, "Render"))
+        args = {"arg": arg}
+        if event == 5:
+            name = "HTTP " + COMMANDS.get(arg, "command %d" % arg)
+            args = {}
+        chrome_event = {
+            "name": name,
+            "ph": PHASES.get(phase, "i"),
+            "ts": (time - start) * 1000000.0 / frequency,
+            "pid": 0,
+            "tid": THREADS.index(thread),
+            "args": args,
+        }
+        if chrome_event["ph"] == "i":
+            chrome_event["s"] = "t"
+        events.append(chrome_event)
+
+    return {
+        "traceEvents": events,
+        "displayTimeUnit": "ms",
+        "otherData": {"droppedRecords": dropped_count},
+    }
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert a LightWeaver trace dump into the Chrome trace format")
+    parser.add_argument("input", help="trace dump downloaded from /lightWeaver/trace")
+    parser.add_argument("-o", "--output", help="output file, defaults to stdout")
+    args = parser.parse_args()
+
+    with open(args.input, "rb") as f:
+        data = f.read()
+    try:
+        trace = convert(data)
+    except ValueError as e:
+        sys.exit("%s: %s" % (args.input, e))
+
+    if args.output:
+        with open(args.output, "w") as f:
+            json.dump(trace, f)
+    else:
+        json.dump(trace, sys.stdout)
+
+
+if __name__ == "__main__":
+    main()